@@ -20,6 +20,7 @@
 #include "object-hook/hook-enchant.h"
 #include "object/object-info.h"
 #include "object/object-kind.h"
+#include "pet/pet-registry.h"
 #include "racial/racial-android.h"
 #include "specific-object/monster-ball.h"
 #include "spell-kind/spells-launcher.h"
@@ -183,12 +184,12 @@ static bool activate_whistle(player_type *user_ptr, ae_type *ae_ptr)
     MONSTER_IDX *who;
     int max_pet = 0;
     C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
-    for (pet_ctr = user_ptr->current_floor_ptr->m_max - 1; pet_ctr >= 1; pet_ctr--)
-        if (is_pet(&user_ptr->current_floor_ptr->m_list[pet_ctr]) && (user_ptr->riding != pet_ctr))
-            who[max_pet++] = pet_ctr;
+    MONSTER_NUMBER pet_num = collect_pets(user_ptr->current_floor_ptr, who);
+    for (MONSTER_NUMBER i = 0; i < pet_num; i++)
+        if (user_ptr->riding != who[i])
+            who[max_pet++] = who[i];
 
-    u16b dummy_why;
-    ang_sort(user_ptr, who, &dummy_why, max_pet, ang_sort_comp_pet, ang_sort_swap_hook);
+    sort_pet_index(user_ptr, who, max_pet);
     for (MONSTER_IDX i = 0; i < max_pet; i++) {
         pet_ctr = who[i];
         teleport_monster_to(user_ptr, pet_ctr, user_ptr->y, user_ptr->x, 100, TELEPORT_PASSIVE);
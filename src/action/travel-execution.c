@@ -1,6 +1,7 @@
 ﻿#include "action/travel-execution.h"
 #include "action/movement-execution.h"
 #include "action/run-execution.h"
+#include "action/travel-planner.h"
 #include "core/disturbance.h"
 #include "game-option/disturbance-options.h"
 #include "game-option/input-options.h"
@@ -84,6 +85,7 @@ static DIRECTION travel_test(player_type *creature_ptr, DIRECTION prev_dir)
  */
 void travel_step(player_type *creature_ptr)
 {
+    repair_travel_flow(creature_ptr);
     travel.dir = travel_test(creature_ptr, travel.dir);
     if (!travel.dir) {
         if (travel.run == 255) {
@@ -118,4 +120,5 @@ void forget_travel_flow(floor_type *floor_ptr)
             travel.cost[y][x] = MAX_SHORT;
 
     travel.y = travel.x = 0;
+    forget_travel_plan();
 }
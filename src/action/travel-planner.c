@@ -0,0 +1,371 @@
+﻿/*!
+ * @brief トラベルの経路計算 / Route planner of the travel command
+ * @date 2026/10/19
+ * @details
+ * 目標地点からの移動コストを travel.cost に書き込み、travel_step() はコストが下がる方へ進む。
+ * コストは小さな整数なので、コストごとのバケツに地点を入れて安い順に取り出す (バケツ式のダイクストラ法)。
+ * 地形ごとのコストはプレーヤーの浮遊・火炎耐性と合わせて計算ごとに一度だけ求めておく。
+ * goal_directed の時はプレーヤーまでの距離を下限として足した A* で、プレーヤーの地点が確定したら打ち切る。
+ * 歩いている間に新たに分かった地点は repair_travel_flow() で差分だけ計算し直す。
+ */
+
+#include "action/travel-planner.h"
+#include "action/travel-execution.h"
+#include "floor/cave.h"
+#include "floor/geometry.h"
+#include "grid/feature.h"
+#include "grid/grid.h"
+#include "player/player-status-flags.h"
+#include "system/floor-type-definition.h"
+#include "util/bit-flags-calculator.h"
+
+#define TRAVEL_UNABLE 9999 /*!< 壁を通る時に加えるコスト */
+#define TRAVEL_BLOCKED MAX_SHORT /*!< 通れない地点の移動コスト */
+#define TRAVEL_STEP_UNKNOWN 0 /*!< まだ移動コストを求めていない地点 */
+#define TRAVEL_QUEUE_KEYS 0x8000 /*!< 優先度付きキューのバケツの数 */
+#define TRAVEL_GRID_NUM (MAX_HGT * MAX_WID) /*!< 地点の添字の上限 */
+
+/*!
+ * @brief 経路計算の状態 / State of the current travel plan
+ */
+typedef struct travel_plan_type {
+    bool active; /*!< 経路計算の結果が有効か */
+    bool queue_ready; /*!< キューを初期化したか */
+    bool goal_directed; /*!< プレーヤーの地点が確定したら打ち切るか */
+    POSITION ty; /*!< 目標地点のY座標 */
+    POSITION tx; /*!< 目標地点のX座標 */
+    POSITION py; /*!< 前回見たプレーヤーのY座標 */
+    POSITION px; /*!< 前回見たプレーヤーのX座標 */
+    int km; /*!< 計算を始めてからプレーヤーが動いた距離 */
+    bool levitation; /*!< 計算した時に浮遊していたか */
+    bool resist_fire; /*!< 計算した時に火炎耐性があったか */
+    bool wall; /*!< 計算した時に壁の中にいたか */
+    s16b step_cost[MAX_HGT][MAX_WID]; /*!< 地点ごとの移動コスト (最初に踏み込もうとした時に求める) */
+    int queue_head[TRAVEL_QUEUE_KEYS]; /*!< バケツごとの先頭の地点 */
+    int queue_next[TRAVEL_GRID_NUM]; /*!< 同じバケツの次の地点 */
+    int queue_prev[TRAVEL_GRID_NUM]; /*!< 同じバケツの前の地点 */
+    int queue_key[TRAVEL_GRID_NUM]; /*!< 地点が入っているバケツ (-1ならキューの外) */
+    int queue_min; /*!< 空でないバケツの下限 */
+    int queue_num; /*!< キューに入っている地点の数 */
+} travel_plan_type;
+
+static travel_plan_type travel_plan;
+
+/*!
+ * @brief 地点をバケツから外す / Unlink a grid from its bucket
+ * @param g 地点の添字
+ * @return なし
+ */
+static void unlink_travel_queue(int g)
+{
+    int next = travel_plan.queue_next[g];
+    int prev = travel_plan.queue_prev[g];
+    if (prev >= 0)
+        travel_plan.queue_next[prev] = next;
+    else
+        travel_plan.queue_head[travel_plan.queue_key[g]] = next;
+
+    if (next >= 0)
+        travel_plan.queue_prev[next] = prev;
+
+    travel_plan.queue_key[g] = -1;
+    travel_plan.queue_num--;
+}
+
+/*!
+ * @brief 地点をキューに入れる / Push a grid, or move it to a cheaper bucket
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param y 地点のY座標
+ * @param x 地点のX座標
+ * @return なし
+ * @details
+ * A* の下限はプレーヤーまでのチェビシェフ距離で、どの地点も移動コストは1以上なので過大評価にならない。
+ * 計算の途中でプレーヤーが動いた分 km を足しておき、古い下限のまま入っている地点と比べられるようにする。
+ */
+static void push_travel_queue(player_type *creature_ptr, POSITION y, POSITION x)
+{
+    int key = travel.cost[y][x];
+    if (travel_plan.goal_directed)
+        key += MAX(ABS(y - creature_ptr->y), ABS(x - creature_ptr->x)) + travel_plan.km;
+
+    if (key >= TRAVEL_QUEUE_KEYS)
+        key = TRAVEL_QUEUE_KEYS - 1;
+
+    int g = y * MAX_WID + x;
+    if (travel_plan.queue_key[g] == key)
+        return;
+
+    if (travel_plan.queue_key[g] >= 0)
+        unlink_travel_queue(g);
+
+    travel_plan.queue_key[g] = key;
+    travel_plan.queue_prev[g] = -1;
+    travel_plan.queue_next[g] = travel_plan.queue_head[key];
+    if (travel_plan.queue_head[key] >= 0)
+        travel_plan.queue_prev[travel_plan.queue_head[key]] = g;
+
+    travel_plan.queue_head[key] = g;
+    travel_plan.queue_num++;
+    if (key < travel_plan.queue_min)
+        travel_plan.queue_min = key;
+}
+
+/*!
+ * @brief 最も安いバケツを探す / Find the cheapest non-empty bucket
+ * @return バケツの番号
+ * @details キューが空でない時だけ呼ぶ。
+ */
+static int peek_travel_queue(void)
+{
+    while (travel_plan.queue_head[travel_plan.queue_min] < 0)
+        travel_plan.queue_min++;
+
+    return travel_plan.queue_min;
+}
+
+/*!
+ * @brief 優先度付きキューを空にする / Empty the bucket queue
+ * @return なし
+ * @details 打ち切った計算の残りだけを外し、全てのバケツを毎回初期化することは避ける。
+ */
+static void reset_travel_queue(void)
+{
+    if (!travel_plan.queue_ready) {
+        for (int i = 0; i < TRAVEL_QUEUE_KEYS; i++)
+            travel_plan.queue_head[i] = -1;
+
+        for (int i = 0; i < TRAVEL_GRID_NUM; i++)
+            travel_plan.queue_key[i] = -1;
+
+        travel_plan.queue_ready = TRUE;
+        travel_plan.queue_num = 0;
+    }
+
+    while (travel_plan.queue_num > 0)
+        unlink_travel_queue(travel_plan.queue_head[peek_travel_queue()]);
+
+    travel_plan.queue_min = 0;
+}
+
+/*!
+ * @brief 地点の移動コストを計算する / Calculate the cost of stepping onto a grid
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y 該当地点のY座標
+ * @param x 該当地点のX座標
+ * @return コスト値 (壁なら TRAVEL_UNABLE より大きく、通れないなら TRAVEL_BLOCKED)
+ */
+static int calc_travel_step_cost(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+    if (!in_bounds(floor_ptr, y, x) || (floor_ptr->dun_level > 0 && !(g_ptr->info & CAVE_KNOWN)))
+        return TRAVEL_BLOCKED;
+
+    feature_type *f_ptr = &f_info[g_ptr->feat];
+    if (has_flag(f_ptr->flags, FF_WALL) || has_flag(f_ptr->flags, FF_CAN_DIG) || (has_flag(f_ptr->flags, FF_DOOR) && g_ptr->mimic)
+        || (!has_flag(f_ptr->flags, FF_MOVE) && has_flag(f_ptr->flags, FF_CAN_FLY) && !travel_plan.levitation))
+        return 1 + TRAVEL_UNABLE;
+
+    int cost = 1;
+    if (has_flag(f_ptr->flags, FF_AVOID_RUN))
+        cost += 1;
+
+    if (has_flag(f_ptr->flags, FF_WATER) && has_flag(f_ptr->flags, FF_DEEP) && !travel_plan.levitation)
+        cost += 5;
+
+    if (has_flag(f_ptr->flags, FF_LAVA)) {
+        int lava = 2;
+        if (!travel_plan.resist_fire)
+            lava *= 2;
+
+        if (!travel_plan.levitation)
+            lava *= 2;
+
+        if (has_flag(f_ptr->flags, FF_DEEP))
+            lava *= 2;
+
+        cost += lava;
+    }
+
+    if (g_ptr->info & (CAVE_MARK)) {
+        if (has_flag(f_ptr->flags, FF_DOOR))
+            cost += 1;
+
+        if (has_flag(f_ptr->flags, FF_TRAP))
+            cost += 10;
+    }
+
+    return cost;
+}
+
+/*!
+ * @brief 隣の地点から移動コストを更新する / Relax a grid from a neighbour of cost n
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param y 該当地点のY座標
+ * @param x 該当地点のX座標
+ * @param n 隣の地点のコスト
+ * @return なし
+ */
+static void relax_travel_grid(player_type *creature_ptr, POSITION y, POSITION x, int n)
+{
+    int add_cost = travel_plan.step_cost[y][x];
+    if (add_cost == TRAVEL_STEP_UNKNOWN) {
+        add_cost = calc_travel_step_cost(creature_ptr->current_floor_ptr, y, x);
+        travel_plan.step_cost[y][x] = (s16b)add_cost;
+    }
+
+    if (add_cost == TRAVEL_BLOCKED)
+        return;
+
+    if ((add_cost > TRAVEL_UNABLE) && (!travel_plan.wall || !(n / TRAVEL_UNABLE)))
+        return;
+
+    int cost = (n % TRAVEL_UNABLE) + add_cost;
+    if (travel.cost[y][x] <= cost)
+        return;
+
+    travel.cost[y][x] = cost;
+    push_travel_queue(creature_ptr, y, x);
+}
+
+/*!
+ * @brief キューが空になるか、プレーヤーの地点が確定するまで経路を計算する / Run the search over the queue
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void run_travel_search(player_type *creature_ptr)
+{
+    while (travel_plan.queue_num > 0) {
+        int key = peek_travel_queue();
+        if (travel_plan.goal_directed && (key >= travel.cost[creature_ptr->y][creature_ptr->x] + travel_plan.km))
+            break;
+
+        int g = travel_plan.queue_head[key];
+        unlink_travel_queue(g);
+        POSITION y = g / MAX_WID;
+        POSITION x = g % MAX_WID;
+        for (DIRECTION d = 0; d < 8; d++)
+            relax_travel_grid(creature_ptr, y + ddy_ddd[d], x + ddx_ddd[d], travel.cost[y][x]);
+    }
+}
+
+/*!
+ * @brief プレーヤーによって変わる移動コストの条件を求める / Snapshot the player-dependent cost parameters
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param levitation 浮遊しているかを返す参照ポインタ
+ * @param resist_fire 火炎耐性があるかを返す参照ポインタ
+ * @param wall 壁の中にいるかを返す参照ポインタ
+ * @return なし
+ */
+static void calc_travel_params(player_type *creature_ptr, bool *levitation, bool *resist_fire, bool *wall)
+{
+    feature_type *f_ptr = &f_info[creature_ptr->current_floor_ptr->grid_array[creature_ptr->y][creature_ptr->x].feat];
+    *levitation = creature_ptr->levitation;
+    *resist_fire = has_resist_fire(creature_ptr) != 0;
+    *wall = !has_flag(f_ptr->flags, FF_MOVE);
+}
+
+/*!
+ * @brief 目標地点までの経路を計算し直す / Plan the route to a target from scratch
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param ty 目標地点のY座標
+ * @param tx 目標地点のX座標
+ * @param goal_directed プレーヤーの地点が確定したら打ち切るならTRUE
+ * @return なし
+ */
+void plan_travel_flow(player_type *creature_ptr, POSITION ty, POSITION tx, bool goal_directed)
+{
+    floor_type *floor_ptr = creature_ptr->current_floor_ptr;
+    calc_travel_params(creature_ptr, &travel_plan.levitation, &travel_plan.resist_fire, &travel_plan.wall);
+    for (POSITION y = 0; y < floor_ptr->height; y++) {
+        for (POSITION x = 0; x < floor_ptr->width; x++) {
+            travel.cost[y][x] = MAX_SHORT;
+            travel_plan.step_cost[y][x] = TRAVEL_STEP_UNKNOWN;
+        }
+    }
+
+    reset_travel_queue();
+    travel_plan.active = TRUE;
+    travel_plan.goal_directed = goal_directed;
+    travel_plan.ty = ty;
+    travel_plan.tx = tx;
+    travel_plan.py = creature_ptr->y;
+    travel_plan.px = creature_ptr->x;
+    travel_plan.km = 0;
+    relax_travel_grid(creature_ptr, ty, tx, 0);
+    run_travel_search(creature_ptr);
+}
+
+/*!
+ * @brief 歩いている間に分かった地形を経路に反映する / Repair the route after a step
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details
+ * 視界の範囲で求めておいた移動コストを見直し、安くなった地点だけをキューに入れて計算を続ける。
+ * 高くなった地点があるか、浮遊や火炎耐性が変わった時は最初から計算し直す。
+ */
+void repair_travel_flow(player_type *creature_ptr)
+{
+    if (!travel_plan.active)
+        return;
+
+    bool levitation, resist_fire, wall;
+    calc_travel_params(creature_ptr, &levitation, &resist_fire, &wall);
+    if ((levitation != travel_plan.levitation) || (resist_fire != travel_plan.resist_fire) || (wall != travel_plan.wall)) {
+        plan_travel_flow(creature_ptr, travel_plan.ty, travel_plan.tx, travel_plan.goal_directed);
+        return;
+    }
+
+    travel_plan.km += MAX(ABS(creature_ptr->y - travel_plan.py), ABS(creature_ptr->x - travel_plan.px));
+    travel_plan.py = creature_ptr->y;
+    travel_plan.px = creature_ptr->x;
+    floor_type *floor_ptr = creature_ptr->current_floor_ptr;
+    POSITION y1 = MAX(0, creature_ptr->y - MAX_SIGHT);
+    POSITION y2 = MIN(floor_ptr->height - 1, creature_ptr->y + MAX_SIGHT);
+    POSITION x1 = MAX(0, creature_ptr->x - MAX_SIGHT);
+    POSITION x2 = MIN(floor_ptr->width - 1, creature_ptr->x + MAX_SIGHT);
+    int num = 0;
+    int changed[(MAX_SIGHT * 2 + 1) * (MAX_SIGHT * 2 + 1)];
+    for (POSITION y = y1; y <= y2; y++) {
+        for (POSITION x = x1; x <= x2; x++) {
+            if (travel_plan.step_cost[y][x] == TRAVEL_STEP_UNKNOWN)
+                continue;
+
+            int cost = calc_travel_step_cost(floor_ptr, y, x);
+            if (cost == travel_plan.step_cost[y][x])
+                continue;
+
+            if (cost > travel_plan.step_cost[y][x]) {
+                plan_travel_flow(creature_ptr, travel_plan.ty, travel_plan.tx, travel_plan.goal_directed);
+                return;
+            }
+
+            travel_plan.step_cost[y][x] = (s16b)cost;
+            changed[num++] = y * MAX_WID + x;
+        }
+    }
+
+    for (int i = 0; i < num; i++) {
+        POSITION y = changed[i] / MAX_WID;
+        POSITION x = changed[i] % MAX_WID;
+        if ((y == travel_plan.ty) && (x == travel_plan.tx))
+            relax_travel_grid(creature_ptr, y, x, 0);
+
+        for (DIRECTION d = 0; d < 8; d++) {
+            POSITION ny = y + ddy_ddd[d];
+            POSITION nx = x + ddx_ddd[d];
+            if (in_bounds(floor_ptr, ny, nx) && (travel.cost[ny][nx] < MAX_SHORT))
+                relax_travel_grid(creature_ptr, y, x, travel.cost[ny][nx]);
+        }
+    }
+
+    run_travel_search(creature_ptr);
+}
+
+/*!
+ * @brief 経路計算の結果を捨てる / Forget the current travel plan
+ * @return なし
+ */
+void forget_travel_plan(void)
+{
+    travel_plan.active = FALSE;
+}
@@ -0,0 +1,7 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+void plan_travel_flow(player_type *creature_ptr, POSITION ty, POSITION tx, bool goal_directed);
+void repair_travel_flow(player_type *creature_ptr);
+void forget_travel_plan(void);
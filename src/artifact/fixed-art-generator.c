@@ -195,6 +195,67 @@ bool create_named_art(player_type *player_ptr, ARTIFACT_IDX a_idx, POSITION y, P
     return drop_near(player_ptr, q_ptr, -1, y, x) ? TRUE : FALSE;
 }
 
+/*! ベースアイテムごとの非INSTA_ART型候補の開始位置 (max_k_idx + 1要素) / Start of each base item's candidates */
+static int *artifact_candidate_start;
+
+/*! 非INSTA_ART型候補のID、ベースアイテム内ではIDの若い順 / Non-INSTA_ART candidates, ascending a_idx per base item */
+static ARTIFACT_IDX *artifact_candidates;
+
+/*! INSTA_ART型固定アーティファクトのID / INSTA_ART artifacts in ascending a_idx */
+static ARTIFACT_IDX *insta_artifacts;
+static int num_insta_artifacts;
+
+/*!
+ * @brief 固定アーティファクトの生成候補索引を構築する / Build the (tval, sval) -> artifact candidate index
+ * @return なし
+ * @details
+ * k_infoとa_infoの読み込み後に一度だけ呼ぶ。
+ * QUESTITEMと生成済みかどうかはゲーム中に変わるため、索引には含めず生成時に判定する。
+ */
+void init_artifact_candidates(void)
+{
+    C_MAKE(artifact_candidate_start, max_k_idx + 1, int);
+    for (ARTIFACT_IDX i = 0; i < max_a_idx; i++) {
+        artifact_type *a_ptr = &a_info[i];
+        if (!a_ptr->name)
+            continue;
+
+        if (a_ptr->gen_flags & TRG_INSTA_ART) {
+            num_insta_artifacts++;
+            continue;
+        }
+
+        for (KIND_OBJECT_IDX k = 1; k < max_k_idx; k++)
+            if ((k_info[k].tval == a_ptr->tval) && (k_info[k].sval == a_ptr->sval))
+                artifact_candidate_start[k + 1]++;
+    }
+
+    for (KIND_OBJECT_IDX k = 0; k < max_k_idx; k++)
+        artifact_candidate_start[k + 1] += artifact_candidate_start[k];
+
+    int *fill;
+    C_MAKE(fill, max_k_idx, int);
+    C_MAKE(artifact_candidates, MAX(artifact_candidate_start[max_k_idx], 1), ARTIFACT_IDX);
+    C_MAKE(insta_artifacts, MAX(num_insta_artifacts, 1), ARTIFACT_IDX);
+    int num_insta = 0;
+    for (ARTIFACT_IDX i = 0; i < max_a_idx; i++) {
+        artifact_type *a_ptr = &a_info[i];
+        if (!a_ptr->name)
+            continue;
+
+        if (a_ptr->gen_flags & TRG_INSTA_ART) {
+            insta_artifacts[num_insta++] = i;
+            continue;
+        }
+
+        for (KIND_OBJECT_IDX k = 1; k < max_k_idx; k++)
+            if ((k_info[k].tval == a_ptr->tval) && (k_info[k].sval == a_ptr->sval))
+                artifact_candidates[artifact_candidate_start[k] + fill[k]++] = i;
+    }
+
+    C_KILL(fill, max_k_idx, int);
+}
+
 /*!
  * @brief 非INSTA_ART型の固定アーティファクトの生成を確率に応じて試行する。
  * Mega-Hack -- Attempt to create one of the "Special Objects"
@@ -215,26 +276,15 @@ bool make_artifact(player_type *player_ptr, object_type *o_ptr)
     if (o_ptr->number != 1)
         return FALSE;
 
-    for (ARTIFACT_IDX i = 0; i < max_a_idx; i++) {
+    for (int n = artifact_candidate_start[o_ptr->k_idx]; n < artifact_candidate_start[o_ptr->k_idx + 1]; n++) {
+        ARTIFACT_IDX i = artifact_candidates[n];
         artifact_type *a_ptr = &a_info[i];
-        if (!a_ptr->name)
-            continue;
-
         if (a_ptr->cur_num)
             continue;
 
         if (a_ptr->gen_flags & TRG_QUESTITEM)
             continue;
 
-        if (a_ptr->gen_flags & TRG_INSTA_ART)
-            continue;
-
-        if (a_ptr->tval != o_ptr->tval)
-            continue;
-
-        if (a_ptr->sval != o_ptr->sval)
-            continue;
-
         if (a_ptr->level > floor_ptr->dun_level) {
             int d = (a_ptr->level - floor_ptr->dun_level) * 2;
             if (!one_in_(d))
@@ -277,21 +327,16 @@ bool make_artifact_special(player_type *player_ptr, object_type *o_ptr)
     if (get_obj_num_hook)
         return FALSE;
 
-    /*! @note 全固定アーティファクト中からIDの若い順に生成対象とその確率を走査する / Check the artifact list (just the "specials") */
-    for (ARTIFACT_IDX i = 0; i < max_a_idx; i++) {
+    /*! @note INSTA_ART固定アーティファクト中からIDの若い順に生成対象とその確率を走査する / Check the artifact list (just the "specials") */
+    for (int n = 0; n < num_insta_artifacts; n++) {
+        ARTIFACT_IDX i = insta_artifacts[n];
         artifact_type *a_ptr = &a_info[i];
 
-        /*! @note アーティファクト名が空の不正なデータは除外する / Skip "empty" artifacts */
-        if (!a_ptr->name)
-            continue;
-
-        /*! @note 既に生成回数がカウントされたアーティファクト、QUESTITEMと非INSTA_ARTは除外 / Cannot make an artifact twice */
+        /*! @note 既に生成回数がカウントされたアーティファクトとQUESTITEMは除外 / Cannot make an artifact twice */
         if (a_ptr->cur_num)
             continue;
         if (a_ptr->gen_flags & TRG_QUESTITEM)
             continue;
-        if (!(a_ptr->gen_flags & TRG_INSTA_ART))
-            continue;
 
         /*! @note アーティファクト生成階が現在に対して足りない場合は高確率で1/(不足階層*2)を満たさないと生成リストに加えられない /
          *  XXX XXX Enforce minimum "depth" (loosely) */
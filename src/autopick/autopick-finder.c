@@ -16,6 +16,7 @@
 #include "io/input-key-acceptor.h"
 #include "main/sound-of-music.h"
 #include "object/item-use-flags.h"
+#include "object/object-info.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
 #include "util/int-char-converter.h"
@@ -47,6 +48,25 @@ int find_autopick_list(player_type *player_ptr, object_type *o_ptr)
     return -1;
 }
 
+/*!
+ * @brief 与えられたアイテムが自動拾いのリストに登録されているかを判定結果のキャッシュを使って調べる / Cached find_autopick_list()
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param o_ptr アイテムへの参照ポインタ
+ * @return 自動拾いのリストに登録されていたらその登録番号、なかったら-1
+ * @details
+ * マップ描画のように同じ床のアイテムを何度も判定する時に使う。
+ * 判定結果はアイテムの状態の版 object_state_version が進むまで使い回す。
+ */
+int find_autopick_list_cached(player_type *player_ptr, object_type *o_ptr)
+{
+    if (o_ptr->autopick_version == object_state_version)
+        return o_ptr->autopick_idx;
+
+    o_ptr->autopick_idx = (s16b)find_autopick_list(player_ptr, o_ptr);
+    o_ptr->autopick_version = object_state_version;
+    return o_ptr->autopick_idx;
+}
+
 /*
  * Choose an item for search
  */
@@ -1,10 +1,11 @@
-#pragma once
+﻿#pragma once
 
 #include "system/angband.h"
 #include "autopick/autopick-util.h"
 #include "system/object-type-definition.h"
 
 int find_autopick_list(player_type *player_ptr, object_type *o_ptr);
+int find_autopick_list_cached(player_type *player_ptr, object_type *o_ptr);
 bool get_object_for_search(player_type *player_ptr, object_type **o_handle, concptr *search_strp);
 bool get_destroyed_object_for_search(player_type *player_ptr, object_type **o_handle, concptr *search_strp);
 byte get_string_for_search(player_type *player_ptr, object_type **o_handle, concptr *search_strp);
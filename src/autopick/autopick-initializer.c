@@ -1,6 +1,7 @@
 ﻿#include "autopick/autopick-initializer.h"
 #include "autopick/autopick-entry.h"
 #include "autopick/autopick-util.h"
+#include "object/object-info.h"
 #include "system/angband.h"
 
 /*
@@ -25,4 +26,5 @@ void init_autopick(void)
 	max_autopick = 0;
 	autopick_new_entry(&entry, easy_autopick_inscription, TRUE);
 	autopick_list[max_autopick++] = entry;
+	update_object_state_version();
 }
@@ -6,6 +6,7 @@
 #include "main/sound-of-music.h"
 #include "monster-race/race-indice-types.h"
 #include "object-enchant/item-feeling.h"
+#include "object/object-info.h"
 #include "util/quarks.h"
 
 /*
@@ -99,4 +100,5 @@ void add_autopick_list(autopick_type *entry)
 
 	autopick_list[max_autopick] = *entry;
 	max_autopick++;
+	update_object_state_version();
 }
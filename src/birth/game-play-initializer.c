@@ -13,6 +13,7 @@
 #include "object/object-generator.h"
 #include "object/object-kind.h"
 #include "pet/pet-util.h"
+#include "player/player-bonus-tracker.h"
 #include "player/player-race-types.h"
 #include "system/artifact-type-definition.h"
 #include "system/floor-type-definition.h"
@@ -53,6 +54,7 @@ void player_wipe_without_name(player_type *creature_ptr)
         C_WIPE(creature_ptr->inventory_list, INVEN_TOTAL, object_type);
 
     (void)WIPE(creature_ptr, player_type);
+    invalidate_bonus_dependencies();
 
     //TODO: キャラ作成からゲーム開始までに  current_floor_ptr を参照しなければならない処理は今後整理して外す。
     creature_ptr->current_floor_ptr = &floor_info;
@@ -9,6 +9,7 @@
 #include "core/hp-mp-processor.h"
 #include "floor/cave.h"
 #include "grid/grid.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
 #include "monster-race/race-flags1.h"
@@ -98,7 +99,7 @@ static bool exe_blue_teleport_back(player_type *caster_ptr, GAME_TEXT *m_name)
 
     if ((r_ptr->flags1 & RF1_UNIQUE) || (r_ptr->flagsr & RFR_RES_ALL)) {
         if (is_original_ap_and_seen(caster_ptr, m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_TELE;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
         msg_format(_("%sには効果がなかった！", "%s is unaffected!"), m_name);
         return TRUE;
@@ -108,7 +109,7 @@ static bool exe_blue_teleport_back(player_type *caster_ptr, GAME_TEXT *m_name)
         return FALSE;
 
     if (is_original_ap_and_seen(caster_ptr, m_ptr))
-        r_ptr->r_flagsr |= RFR_RES_TELE;
+        lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
     msg_format(_("%sには耐性がある！", "%s resists!"), m_name);
     return TRUE;
@@ -16,6 +16,7 @@
 #include "dungeon/dungeon.h"
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
+#include "floor/floor-slot-list.h"
 #include "game-option/cheat-types.h"
 #include "inventory/inventory-slot-types.h"
 #include "main/sound-definitions-table.h"
@@ -279,12 +280,15 @@ bool do_cmd_attack(player_type *attacker_ptr, POSITION y, POSITION x, combat_opt
     }
 
     attacker_ptr->riding_t_m_idx = g_ptr->m_idx;
+    attacker_ptr->riding_t_m_generation = slot_generation(&attacker_ptr->current_floor_ptr->m_slots, g_ptr->m_idx);
     bool fear = FALSE;
     bool mdeath = FALSE;
+    msg_batch_begin();
     if (has_right_hand_weapon(attacker_ptr))
         exe_player_attack_to_monster(attacker_ptr, y, x, &fear, &mdeath, 0, mode);
     if (has_left_hand_weapon(attacker_ptr) && !mdeath)
         exe_player_attack_to_monster(attacker_ptr, y, x, &fear, &mdeath, 1, mode);
+    msg_batch_end();
 
     if (!mdeath) {
         if ((attacker_ptr->muta2 & MUT2_HORNS) && !mdeath)
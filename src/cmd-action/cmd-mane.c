@@ -21,6 +21,7 @@
 #include "game-option/disturbance-options.h"
 #include "game-option/text-display-options.h"
 #include "grid/grid.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "mind/mind-mage.h"
@@ -829,13 +830,13 @@ static bool use_mane(player_type *caster_ptr, int spell)
         if (r_ptr->flagsr & RFR_RES_TELE) {
             if ((r_ptr->flags1 & (RF1_UNIQUE)) || (r_ptr->flagsr & RFR_RES_ALL)) {
                 if (is_original_ap_and_seen(caster_ptr, m_ptr))
-                    r_ptr->r_flagsr |= RFR_RES_TELE;
+                    lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
                 msg_format(_("%sには効果がなかった！", "%s is unaffected!"), m_name);
 
                 break;
             } else if (r_ptr->level > randint1(100)) {
                 if (is_original_ap_and_seen(caster_ptr, m_ptr))
-                    r_ptr->r_flagsr |= RFR_RES_TELE;
+                    lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
                 msg_format(_("%sには耐性がある！", "%s resists!"), m_name);
 
                 break;
@@ -33,6 +33,7 @@
 #include "monster/monster-status.h"
 #include "monster/smart-learn-types.h"
 #include "object-hook/hook-weapon.h"
+#include "pet/pet-registry.h"
 #include "pet/pet-util.h"
 #include "player/attack-defense-types.h"
 #include "player/player-class.h"
@@ -71,7 +72,6 @@ void do_cmd_pet_dismiss(player_type *creature_ptr)
     int Dismissed = 0;
 
     MONSTER_IDX *who;
-    u16b dummy_why;
     int max_pet = 0;
     bool cu, cv;
 
@@ -84,12 +84,9 @@ void do_cmd_pet_dismiss(player_type *creature_ptr)
     C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
 
     /* Process the monsters (backwards) */
-    for (pet_ctr = creature_ptr->current_floor_ptr->m_max - 1; pet_ctr >= 1; pet_ctr--) {
-        if (is_pet(&creature_ptr->current_floor_ptr->m_list[pet_ctr]))
-            who[max_pet++] = pet_ctr;
-    }
+    max_pet = collect_pets(creature_ptr->current_floor_ptr, who);
 
-    ang_sort(creature_ptr, who, &dummy_why, max_pet, ang_sort_comp_pet_dismiss, ang_sort_swap_hook);
+    sort_pet_dismiss_index(creature_ptr, who, max_pet);
 
     /* Process the monsters (backwards) */
     for (i = 0; i < max_pet; i++) {
@@ -683,14 +680,7 @@ void do_cmd_pet(player_type *creature_ptr)
     switch (powers[i]) {
     case PET_DISMISS: /* Dismiss pets */
     {
-        /* Check pets (backwards) */
-        for (pet_ctr = creature_ptr->current_floor_ptr->m_max - 1; pet_ctr >= 1; pet_ctr--) {
-            /* Player has pet */
-            if (is_pet(&creature_ptr->current_floor_ptr->m_list[pet_ctr]))
-                break;
-        }
-
-        if (!pet_ctr) {
+        if (!count_pets(creature_ptr->current_floor_ptr)) {
             msg_print(_("ペットがいない！", "You have no pets!"));
             break;
         }
@@ -5,6 +5,7 @@
 #include "core/player-redraw-types.h"
 #include "core/show-file.h"
 #include "core/window-redrawer.h"
+#include "flavor/flavor-cache.h"
 #include "game-option/game-play-options.h"
 #include "game-option/keymap-directory-getter.h"
 #include "game-option/option-flags.h"
@@ -20,6 +21,7 @@
 #include "util/int-char-converter.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include "window/item-line-cache.h"
 #include "world/world.h"
 
 #define OPT_NUM 15
@@ -598,6 +600,8 @@ void do_cmd_options(player_type *player_ptr)
     }
 
     screen_load();
+    reset_flavor_cache();
+    forget_item_line_memos();
     player_ptr->redraw |= (PR_EQUIPPY);
 }
 
@@ -21,87 +21,232 @@ bool get_com_no_macros = FALSE;
 /* Determine if any macros have ever started with a given character */
 static bool macro__use[256];
 
-/* Find the macro (if any) which exactly matches the given pattern */
-int macro_find_exact(concptr pat)
+/*!
+ * @brief マクロのパターンの接頭辞木の節 / A node of the prefix trie over the macro patterns
+ */
+typedef struct macro_trie_node {
+    char key; /*!< 親からこの節へ進むキー */
+    int child; /*!< 最初の子 (なければ-1) */
+    int sibling; /*!< 次の兄弟 (なければ-1) */
+    int macro; /*!< この節で終わるマクロ (なければ-1) */
+    int first_longer; /*!< この節より長いパターンを持つ最初のマクロ (なければ-1) */
+} macro_trie_node;
+
+/* Prefix trie over the macro patterns, the root is node 0 */
+static macro_trie_node *macro__trie;
+static int macro__trie_num = 0;
+static int macro__trie_max = 0;
+
+/*!
+ * @brief 接頭辞木に節を追加する / Append a node to the trie
+ * @param key 親からこの節へ進むキー
+ * @return 追加した節
+ */
+static int macro_trie_make_node(char key)
 {
-    if (!macro__use[(byte)(pat[0])]) {
-        return -1;
+    if (macro__trie_num == macro__trie_max) {
+        int max = macro__trie_max ? macro__trie_max * 2 : 256;
+        macro_trie_node *trie;
+        C_MAKE(trie, max, macro_trie_node);
+        if (macro__trie) {
+            (void)C_COPY(trie, macro__trie, macro__trie_num, macro_trie_node);
+            C_KILL(macro__trie, macro__trie_max, macro_trie_node);
+        }
+
+        macro__trie = trie;
+        macro__trie_max = max;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!streq(macro__pat[i], pat))
-            continue;
+    macro_trie_node *node_ptr = &macro__trie[macro__trie_num];
+    node_ptr->key = key;
+    node_ptr->child = -1;
+    node_ptr->sibling = -1;
+    node_ptr->macro = -1;
+    node_ptr->first_longer = -1;
+    return macro__trie_num++;
+}
+
+/*!
+ * @brief 子の節を探す / Follow a key from a node
+ * @param node 節 (-1なら一致なし)
+ * @param key キー
+ * @return 子の節、なければ-1
+ */
+static int macro_trie_find_child(int node, char key)
+{
+    if ((node < 0) || (node >= macro__trie_num))
+        return -1;
 
-        return (i);
-    }
+    for (int child = macro__trie[node].child; child >= 0; child = macro__trie[child].sibling)
+        if (macro__trie[child].key == key)
+            return child;
 
     return -1;
 }
 
-/*
- * Find the first macro (if any) which contains the given pattern
+/*!
+ * @brief パターンに対応する節を探す / Find the node of a pattern
+ * @param pat パターン
+ * @return 節、なければ-1
  */
-int macro_find_check(concptr pat)
+static int macro_trie_find(concptr pat)
 {
-    if (!macro__use[(byte)(pat[0])]) {
-        return -1;
+    int node = macro__trie_num ? 0 : -1;
+    for (; *pat && (node >= 0); pat++)
+        node = macro_trie_find_child(node, *pat);
+
+    return node;
+}
+
+/*!
+ * @brief 接頭辞木にマクロを登録する / Insert a new macro into the trie
+ * @param pat パターン
+ * @param n マクロの番号
+ * @return なし
+ * @details
+ * マクロは削除されず番号は増える一方なので、各節で最初に通ったマクロが最小の番号になる。
+ */
+static void macro_trie_insert(concptr pat, int n)
+{
+    if (!macro__trie_num)
+        (void)macro_trie_make_node('\0');
+
+    int node = 0;
+    for (; *pat; pat++) {
+        if (macro__trie[node].first_longer < 0)
+            macro__trie[node].first_longer = n;
+
+        int child = macro_trie_find_child(node, *pat);
+        if (child < 0) {
+            child = macro_trie_make_node(*pat);
+            macro__trie[child].sibling = macro__trie[node].child;
+            macro__trie[node].child = child;
+        }
+
+        node = child;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat))
-            continue;
+    macro__trie[node].macro = n;
+}
 
-        return (i);
+/*!
+ * @brief 入力途中のキー列の照合を始める / Start matching the keys as they arrive
+ * @param match_ptr 照合状態への参照ポインタ
+ * @return なし
+ */
+void macro_match_start(macro_match_type *match_ptr)
+{
+    match_ptr->node = macro__trie_num ? 0 : -1;
+    match_ptr->ready = (match_ptr->node < 0) ? -1 : macro__trie[0].macro;
+}
+
+/*!
+ * @brief 照合中のキー列にキーを1つ加える / Extend the match by one key
+ * @param match_ptr 照合状態への参照ポインタ
+ * @param key 加えるキー
+ * @return なし
+ */
+void macro_match_key(macro_match_type *match_ptr, char key)
+{
+    if ((match_ptr->node == 0) && !macro__use[(byte)key]) {
+        match_ptr->node = -1;
+        match_ptr->ready = -1;
+        return;
     }
 
-    return -1;
+    match_ptr->node = macro_trie_find_child(match_ptr->node, key);
+    if ((match_ptr->node >= 0) && (macro__trie[match_ptr->node].macro >= 0))
+        match_ptr->ready = macro__trie[match_ptr->node].macro;
 }
 
-/*
- * Find the first macro (if any) which contains the given pattern and more
+/*!
+ * @brief 照合中のキー列で始まる最初のマクロを返す / macro_find_check() for the keys matched so far
+ * @param match_ptr 照合状態への参照ポインタ
+ * @return マクロの番号、なければ-1
  */
-int macro_find_maybe(concptr pat)
+int macro_match_check(macro_match_type *match_ptr)
 {
-    if (!macro__use[(byte)(pat[0])]) {
+    if (match_ptr->node < 0)
         return -1;
-    }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat))
-            continue;
-        if (streq(macro__pat[i], pat))
-            continue;
+    macro_trie_node *node_ptr = &macro__trie[match_ptr->node];
+    if ((node_ptr->macro >= 0) && ((node_ptr->first_longer < 0) || (node_ptr->macro < node_ptr->first_longer)))
+        return node_ptr->macro;
 
-        return (i);
-    }
+    return node_ptr->first_longer;
+}
 
-    return -1;
+/*!
+ * @brief 照合中のキー列より長いパターンの最初のマクロを返す / macro_find_maybe() for the keys matched so far
+ * @param match_ptr 照合状態への参照ポインタ
+ * @return マクロの番号、なければ-1
+ */
+int macro_match_maybe(macro_match_type *match_ptr)
+{
+    if (match_ptr->node < 0)
+        return -1;
+
+    return macro__trie[match_ptr->node].first_longer;
 }
 
-/*
- * Find the longest macro (if any) which starts with the given pattern
+/*!
+ * @brief パターン全体を照合する / Match state of a whole pattern
+ * @param match_ptr 照合状態への参照ポインタ
+ * @param pat パターン
+ * @return なし
  */
-int macro_find_ready(concptr pat)
+static void macro_match_string(macro_match_type *match_ptr, concptr pat)
 {
-    int t, n = -1, s = -1;
+    macro_match_start(match_ptr);
+    if (!macro__use[(byte)(pat[0])]) {
+        match_ptr->node = -1;
+        match_ptr->ready = -1;
+        return;
+    }
 
+    for (; *pat && (match_ptr->node >= 0); pat++)
+        macro_match_key(match_ptr, *pat);
+}
+
+/* Find the macro (if any) which exactly matches the given pattern */
+int macro_find_exact(concptr pat)
+{
     if (!macro__use[(byte)(pat[0])]) {
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(pat, macro__pat[i]))
-            continue;
+    int node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].macro;
+}
 
-        t = strlen(macro__pat[i]);
-        if ((n >= 0) && (s > t))
-            continue;
+/*
+ * Find the first macro (if any) which contains the given pattern
+ */
+int macro_find_check(concptr pat)
+{
+    macro_match_type match;
+    macro_match_string(&match, pat);
+    return macro_match_check(&match);
+}
 
-        n = i;
-        s = t;
-    }
+/*
+ * Find the first macro (if any) which contains the given pattern and more
+ */
+int macro_find_maybe(concptr pat)
+{
+    macro_match_type match;
+    macro_match_string(&match, pat);
+    return macro_match_maybe(&match);
+}
 
-    return (n);
+/*
+ * Find the longest macro (if any) which starts with the given pattern
+ */
+int macro_find_ready(concptr pat)
+{
+    macro_match_type match;
+    macro_match_string(&match, pat);
+    return match.ready;
 }
 
 /*
@@ -129,6 +274,7 @@ errr macro_add(concptr pat, concptr act)
     } else {
         n = macro__num++;
         macro__pat[n] = string_make(pat);
+        macro_trie_insert(pat, n);
     }
 
     macro__act[n] = string_make(act);
@@ -2,6 +2,14 @@
 
 #include "system/angband.h"
 
+/*!
+ * @brief 入力途中のキー列とマクロのパターンの照合状態 / Incremental match of the keys against the macro patterns
+ */
+typedef struct macro_match_type {
+    int node; /*!< 入力済のキー列に対応する接頭辞木の節 (一致するパターンがなければ-1) */
+    int ready; /*!< 入力済のキー列の先頭に一致する最長のマクロ (なければ-1) */
+} macro_match_type;
+
 extern bool *macro__cmd;
 extern char *macro__buf;
 
@@ -16,3 +24,7 @@ int macro_find_check(concptr pat);
 errr macro_add(concptr pat, concptr act);
 int macro_find_maybe(concptr pat);
 int macro_find_ready(concptr pat);
+void macro_match_start(macro_match_type *match_ptr);
+void macro_match_key(macro_match_type *match_ptr, char key);
+int macro_match_check(macro_match_type *match_ptr);
+int macro_match_maybe(macro_match_type *match_ptr);
@@ -42,6 +42,7 @@
 #include "object-use/read-execution.h"
 #include "object/item-tester-hooker.h"
 #include "object/item-use-flags.h"
+#include "object/object-info.h"
 #include "perception/identification.h"
 #include "perception/object-perception.h"
 #include "player-info/self-info.h"
@@ -185,6 +186,7 @@ void do_cmd_uninscribe(player_type *creature_ptr)
 
     msg_print(_("銘を消した。", "Inscription removed."));
     o_ptr->inscription = 0;
+    update_object_state_version();
     creature_ptr->update |= (PU_COMBINE);
     creature_ptr->window |= (PW_INVEN | PW_EQUIP);
     creature_ptr->update |= (PU_BONUS);
@@ -216,6 +218,7 @@ void do_cmd_inscribe(player_type *creature_ptr)
 
     if (get_string(_("銘: ", "Inscription: "), out_val, 80)) {
         o_ptr->inscription = quark_add(out_val);
+        update_object_state_version();
         creature_ptr->update |= (PU_COMBINE);
         creature_ptr->window |= (PW_INVEN | PW_EQUIP);
         creature_ptr->update |= (PU_BONUS);
@@ -4,6 +4,7 @@
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
 #include "core/window-redrawer.h"
+#include "flavor/flavor-cache.h"
 #include "io/files-util.h"
 #include "io/input-key-acceptor.h"
 #include "main/sound-of-music.h"
@@ -17,6 +18,7 @@
 #include "util/string-processor.h"
 #include "view/display-messages.h"
 #include "view/display-player.h" // 暫定。後で消す.
+#include "window/item-line-cache.h"
 #include "world/world.h"
 
 /*!
@@ -51,6 +53,8 @@ void do_cmd_redraw(player_type *creature_ptr)
 	creature_ptr->window |= (PW_INVEN | PW_EQUIP | PW_SPELL | PW_PLAYER);
 	creature_ptr->window |= (PW_MESSAGE | PW_OVERHEAD | PW_DUNGEON | PW_MONSTER | PW_OBJECT);
 
+	reset_flavor_cache();
+	forget_item_line_memos();
 	update_playtime();
 	handle_stuff(creature_ptr);
 	if (creature_ptr->prace == RACE_ANDROID) calc_android_exp(creature_ptr);
@@ -9,6 +9,7 @@
 #include "effect/effect-processor.h"
 #include "grid/grid.h"
 #include "inventory/inventory-slot-types.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
 #include "monster-race/race-flags3.h"
@@ -33,7 +34,7 @@ static void aura_fire_by_monster_attack(player_type *target_ptr, monap_type *mon
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if ((r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
+            lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
 
         return;
     }
@@ -55,7 +56,7 @@ static void aura_elec_by_monster_attack(player_type *target_ptr, monap_type *mon
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if ((r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
+            lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
 
         return;
     }
@@ -77,7 +78,7 @@ static void aura_cold_by_monster_attack(player_type *target_ptr, monap_type *mon
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if ((r_ptr->flagsr & RFR_EFF_IM_COLD_MASK) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
+            lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
 
         return;
     }
@@ -99,7 +100,7 @@ static void aura_shards_by_monster_attack(player_type *target_ptr, monap_type *m
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if ((r_ptr->flagsr & RFR_EFF_RES_SHAR_MASK) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_RES_SHAR_MASK);
+            lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_RES_SHAR_MASK);
     } else {
         HIT_POINT dam = damroll(2, 6);
         dam = mon_damage_mod(target_ptr, monap_ptr->m_ptr, dam, FALSE);
@@ -125,7 +126,7 @@ static void aura_holy_by_monster_attack(player_type *target_ptr, monap_type *mon
 
     if ((r_ptr->flagsr & RFR_RES_ALL) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_ALL;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_ALL);
 
         return;
     }
@@ -139,7 +140,7 @@ static void aura_holy_by_monster_attack(player_type *target_ptr, monap_type *mon
     }
 
     if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-        r_ptr->r_flags3 |= RF3_EVIL;
+        lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
 }
 
 static void aura_force_by_monster_attack(player_type *target_ptr, monap_type *monap_ptr)
@@ -150,7 +151,7 @@ static void aura_force_by_monster_attack(player_type *target_ptr, monap_type *mo
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if ((r_ptr->flagsr & RFR_RES_ALL) != 0) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_ALL;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_ALL);
 
         return;
     }
@@ -174,7 +175,7 @@ static void aura_shadow_by_monster_attack(player_type *target_ptr, monap_type *m
     monster_race *r_ptr = &r_info[monap_ptr->m_ptr->r_idx];
     if (((r_ptr->flagsr & RFR_RES_ALL) != 0) || ((r_ptr->flagsr & RFR_RES_DARK) != 0)) {
         if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-            r_ptr->r_flagsr |= (RFR_RES_ALL | RFR_RES_DARK);
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_ALL | RFR_RES_DARK);
 
         return;
     }
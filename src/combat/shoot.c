@@ -19,6 +19,7 @@
 #include "inventory/inventory-slot-types.h"
 #include "io/cursor.h"
 #include "io/screen-util.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "mind/mind-sniper.h"
@@ -87,7 +88,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
     case TV_BOLT: {
         if ((has_flag(flgs, TR_SLAY_ANIMAL)) && (r_ptr->flags3 & RF3_ANIMAL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_ANIMAL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_ANIMAL);
             }
             if (mult < 17)
                 mult = 17;
@@ -95,7 +96,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_ANIMAL)) && (r_ptr->flags3 & RF3_ANIMAL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_ANIMAL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_ANIMAL);
             }
             if (mult < 27)
                 mult = 27;
@@ -103,7 +104,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_EVIL)) && (r_ptr->flags3 & RF3_EVIL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_EVIL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
             }
             if (mult < 15)
                 mult = 15;
@@ -111,7 +112,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_EVIL)) && (r_ptr->flags3 & RF3_EVIL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_EVIL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
             }
             if (mult < 25)
                 mult = 25;
@@ -119,7 +120,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_HUMAN)) && (r_ptr->flags2 & RF2_HUMAN)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags2 |= RF2_HUMAN;
+                lore_race_flags(r_ptr, LORE_FLAGS2, RF2_HUMAN);
             }
             if (mult < 17)
                 mult = 17;
@@ -127,7 +128,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_HUMAN)) && (r_ptr->flags2 & RF2_HUMAN)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags2 |= RF2_HUMAN;
+                lore_race_flags(r_ptr, LORE_FLAGS2, RF2_HUMAN);
             }
             if (mult < 27)
                 mult = 27;
@@ -135,7 +136,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_UNDEAD)) && (r_ptr->flags3 & RF3_UNDEAD)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_UNDEAD;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_UNDEAD);
             }
             if (mult < 20)
                 mult = 20;
@@ -143,7 +144,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_UNDEAD)) && (r_ptr->flags3 & RF3_UNDEAD)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_UNDEAD;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_UNDEAD);
             }
             if (mult < 30)
                 mult = 30;
@@ -151,7 +152,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_DEMON)) && (r_ptr->flags3 & RF3_DEMON)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_DEMON;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_DEMON);
             }
             if (mult < 20)
                 mult = 20;
@@ -159,7 +160,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_DEMON)) && (r_ptr->flags3 & RF3_DEMON)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_DEMON;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_DEMON);
             }
             if (mult < 30)
                 mult = 30;
@@ -167,7 +168,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_ORC)) && (r_ptr->flags3 & RF3_ORC)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_ORC;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_ORC);
             }
             if (mult < 20)
                 mult = 20;
@@ -175,7 +176,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_ORC)) && (r_ptr->flags3 & RF3_ORC)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_ORC;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_ORC);
             }
             if (mult < 30)
                 mult = 30;
@@ -183,7 +184,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_TROLL)) && (r_ptr->flags3 & RF3_TROLL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_TROLL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_TROLL);
             }
 
             if (mult < 20)
@@ -192,7 +193,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_TROLL)) && (r_ptr->flags3 & RF3_TROLL)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_TROLL;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_TROLL);
             }
             if (mult < 30)
                 mult = 30;
@@ -200,7 +201,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_GIANT)) && (r_ptr->flags3 & RF3_GIANT)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_GIANT;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_GIANT);
             }
             if (mult < 20)
                 mult = 20;
@@ -208,7 +209,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_GIANT)) && (r_ptr->flags3 & RF3_GIANT)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_GIANT;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_GIANT);
             }
             if (mult < 30)
                 mult = 30;
@@ -216,7 +217,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_SLAY_DRAGON)) && (r_ptr->flags3 & RF3_DRAGON)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_DRAGON;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_DRAGON);
             }
             if (mult < 20)
                 mult = 20;
@@ -224,7 +225,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
 
         if ((has_flag(flgs, TR_KILL_DRAGON)) && (r_ptr->flags3 & RF3_DRAGON)) {
             if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= RF3_DRAGON;
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_DRAGON);
             }
             if (mult < 30)
                 mult = 30;
@@ -236,7 +237,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
             /* Notice immunity */
             if (r_ptr->flagsr & RFR_EFF_IM_ACID_MASK) {
                 if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                    r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_ACID_MASK);
+                    lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_ACID_MASK);
                 }
             } else {
                 if (mult < 17)
@@ -248,7 +249,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
             /* Notice immunity */
             if (r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK) {
                 if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                    r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
+                    lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
                 }
             } else {
                 if (mult < 17)
@@ -260,7 +261,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
             /* Notice immunity */
             if (r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK) {
                 if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                    r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
+                    lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
                 }
             }
             /* Otherwise, take the damage */
@@ -269,7 +270,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
                     if (mult < 25)
                         mult = 25;
                     if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                        r_ptr->r_flags3 |= RF3_HURT_FIRE;
+                        lore_race_flags(r_ptr, LORE_FLAGS3, RF3_HURT_FIRE);
                     }
                 } else if (mult < 17)
                     mult = 17;
@@ -280,7 +281,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
             /* Notice immunity */
             if (r_ptr->flagsr & RFR_EFF_IM_COLD_MASK) {
                 if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                    r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
+                    lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
                 }
             }
             /* Otherwise, take the damage */
@@ -289,7 +290,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
                     if (mult < 25)
                         mult = 25;
                     if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                        r_ptr->r_flags3 |= RF3_HURT_COLD;
+                        lore_race_flags(r_ptr, LORE_FLAGS3, RF3_HURT_COLD);
                     }
                 } else if (mult < 17)
                     mult = 17;
@@ -300,7 +301,7 @@ static MULTIPLY calc_shot_damage_with_slay(player_type *sniper_ptr, object_type
             /* Notice immunity */
             if (r_ptr->flagsr & RFR_EFF_IM_POIS_MASK) {
                 if (is_original_ap_and_seen(sniper_ptr, m_ptr)) {
-                    r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_POIS_MASK);
+                    lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_POIS_MASK);
                 }
             }
             /* Otherwise, take the damage */
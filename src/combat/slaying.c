@@ -1,6 +1,7 @@
 ﻿#include "combat/slaying.h"
 #include "artifact/fixed-art-types.h"
 #include "core/player-redraw-types.h"
+#include "lore/lore-journal.h"
 #include "mind/mind-samurai.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
@@ -106,7 +107,7 @@ MULTIPLY mult_brand(player_type *player_ptr, MULTIPLY mult, const BIT_FLAGS *flg
         /* Notice immunity */
         if (r_ptr->flagsr & p->resist_mask) {
             if (is_original_ap_and_seen(player_ptr, m_ptr)) {
-                r_ptr->r_flagsr |= (r_ptr->flagsr & p->resist_mask);
+                lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & p->resist_mask);
             }
 
             continue;
@@ -115,7 +116,7 @@ MULTIPLY mult_brand(player_type *player_ptr, MULTIPLY mult, const BIT_FLAGS *flg
         /* Otherwise, take the damage */
         if (r_ptr->flags3 & p->hurt_flag) {
             if (is_original_ap_and_seen(player_ptr, m_ptr)) {
-                r_ptr->r_flags3 |= p->hurt_flag;
+                lore_race_flags(r_ptr, LORE_FLAGS3, p->hurt_flag);
             }
 
             mult = MAX(mult, 50);
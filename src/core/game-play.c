@@ -86,6 +86,7 @@
 #include "view/display-messages.h"
 #include "view/display-player.h"
 #include "window/main-window-util.h"
+#include "wizard/wizard-generation-benchmark.h"
 #include "wizard/wizard-special-process.h"
 #include "world/world.h"
 
@@ -417,6 +418,11 @@ void play_game(player_type *player_ptr, bool new_game, bool browsing_movie)
     if (new_game)
         player_outfit(player_ptr);
 
+    if (arg_generation_floors > 0) {
+        profile_floor_generation(player_ptr, arg_generation_floors, arg_generation_depth);
+        quit(NULL);
+    }
+
     init_io(player_ptr);
     if (player_ptr->chp < 0)
         player_ptr->is_dead = TRUE;
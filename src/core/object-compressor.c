@@ -10,8 +10,11 @@
 #include "system/floor-type-definition.h"
 #include "system/monster-type-definition.h"
 #include "system/object-type-definition.h"
+#include "util/usec-timer.h"
 #include "view/display-messages.h"
 
+slot_compaction_type object_compaction; /*!< アイテム配列の圧縮の計測結果 */
+
 /*!
  * @brief グローバルオブジェクト配列に対し指定範囲のオブジェクトを整理してIDの若い順に寄せる /
  * Move an object from index i1 to index i2 in the object list
@@ -52,6 +55,7 @@ static void compact_objects_aux(floor_type *floor_ptr, OBJECT_IDX i1, OBJECT_IDX
 
     floor_ptr->o_list[i2] = floor_ptr->o_list[i1];
     object_wipe(o_ptr);
+    move_slot(&floor_ptr->o_slots, i1, i2);
 }
 
 /*!
@@ -70,9 +74,15 @@ static void compact_objects_aux(floor_type *floor_ptr, OBJECT_IDX i1, OBJECT_IDX
  *\n
  * After "compacting" (if needed), we "reorder" the objects into a more\n
  * compact order, and we reset the allocation info, and the "live" array.\n
+ *\n
+ * 空き枠は o_pop() が使い回すので、毎ターン詰める必要はない。
+ * 配列が溢れそうな時とセーブの前にだけ呼び、かかった時間を object_compaction に累計する。
  */
 void compact_objects(player_type *player_ptr, int size)
 {
+    double start = get_usec_time();
+    int deleted = 0;
+    int moved = 0;
     object_type *o_ptr;
     if (size) {
         msg_print(_("アイテム情報を圧縮しています...", "Compacting objects..."));
@@ -116,6 +126,7 @@ void compact_objects(player_type *player_ptr, int size)
 
             delete_object_idx(player_ptr, i);
             num++;
+            deleted++;
         }
     }
 
@@ -124,7 +135,13 @@ void compact_objects(player_type *player_ptr, int size)
         if (o_ptr->k_idx)
             continue;
 
+        if (i != floor_ptr->o_max - 1)
+            moved++;
+
         compact_objects_aux(floor_ptr, floor_ptr->o_max - 1, i);
         floor_ptr->o_max--;
     }
+
+    forget_free_slots(&floor_ptr->o_slots);
+    record_slot_compaction(&object_compaction, deleted, moved, start);
 }
@@ -1,5 +1,8 @@
 #pragma once
 
 #include "system/angband.h"
+#include "floor/floor-slot-list.h"
+
+extern slot_compaction_type object_compaction;
 
 void compact_objects(player_type *owner_ptr, int size);
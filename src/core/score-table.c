@@ -0,0 +1,179 @@
+﻿/*!
+ * @brief ハイスコアファイルの読み込みと挿入 / In-memory table of the high score file
+ * @date 2026/10/19
+ * @details
+ * scores.raw は得点の降順に並んだ固定長レコードの列である。
+ * ファイルはロックを取った上でまとめて読み込み、挿入位置は二分探索で求め、
+ * 押し出されるレコードは1回の書き込みで書き戻す。
+ * 種族ごとの表示のために、読み込み時に種族別の順位の連結リストを作る。
+ * 複数のプレイヤーが同時にゲームを終えても、追加は書き込みロックの中で最新の内容を読み直してから行う。
+ */
+
+#include "core/score-table.h"
+#include "player/player-race-types.h"
+#include "util/angband-files.h"
+
+/*!
+ * @brief 読み込んだハイスコア / The high score file loaded into memory
+ */
+typedef struct score_table_type {
+    int num; /*!< 読み込んだレコード数 */
+    high_score entries[MAX_HISCORES]; /*!< 順位順のレコード */
+    long points[MAX_HISCORES]; /*!< 順位ごとの得点 */
+    s16b race_first[MAX_RACES]; /*!< 種族ごとの最上位の順位 (なければ-1) */
+    s16b race_next[MAX_HISCORES]; /*!< 同じ種族の次の順位 (なければ-1) */
+} score_table_type;
+
+static score_table_type score_table;
+
+/*!
+ * @brief 得点と種族別の索引を作り直す / Rebuild the parsed points and the per-race lists
+ * @return なし
+ */
+static void index_score_table(void)
+{
+    s16b race_last[MAX_RACES];
+    for (int i = 0; i < MAX_RACES; i++) {
+        score_table.race_first[i] = -1;
+        race_last[i] = -1;
+    }
+
+    for (int i = 0; i < score_table.num; i++) {
+        high_score *score = &score_table.entries[i];
+        score_table.points[i] = atol(score->pts);
+        score_table.race_next[i] = -1;
+        int race = atoi(score->p_r);
+        if ((race < 0) || (race >= MAX_RACES))
+            continue;
+
+        if (race_last[race] < 0)
+            score_table.race_first[race] = (s16b)i;
+        else
+            score_table.race_next[race_last[race]] = (s16b)i;
+
+        race_last[race] = (s16b)i;
+    }
+}
+
+/*!
+ * @brief ロック済のハイスコアファイルを読み込む / Read the whole file while it is locked
+ * @param fd ハイスコアファイルのファイルディスクリプタ
+ * @return エラーコード
+ */
+static errr read_score_table(int fd)
+{
+    score_table.num = 0;
+    off_t size = lseek(fd, 0, SEEK_END);
+    if ((size < 0) || fd_seek(fd, 0))
+        return 1;
+
+    int num = MIN((int)(size / (off_t)sizeof(high_score)), MAX_HISCORES);
+    if ((num > 0) && fd_read(fd, (char *)score_table.entries, num * sizeof(high_score)))
+        return 1;
+
+    score_table.num = num;
+    index_score_table();
+    return 0;
+}
+
+/*!
+ * @brief ハイスコアファイルを読み込む / Load the high score file under a shared lock
+ * @param fd ハイスコアファイルのファイルディスクリプタ
+ * @return エラーコード
+ */
+errr load_score_table(int fd)
+{
+    score_table.num = 0;
+    if (fd < 0)
+        return -1;
+
+    if (fd_lock(fd, F_RDLCK))
+        return 1;
+
+    errr err = read_score_table(fd);
+    (void)fd_lock(fd, F_UNLCK);
+    return err;
+}
+
+/*!
+ * @brief 読み込んだレコード数を返す / Number of the loaded scores
+ * @return レコード数
+ */
+int count_score_table(void) { return score_table.num; }
+
+/*!
+ * @brief 指定順位のレコードを返す / The score at the given rank
+ * @param rank 順位 (0が最上位)
+ * @return レコードへの参照ポインタ
+ */
+high_score *get_score_table_entry(int rank) { return &score_table.entries[rank]; }
+
+/*!
+ * @brief 新しいスコアが入る順位を二分探索で求める / Just determine where a new score *would* be placed
+ * @param score スコア情報参照ポインタ
+ * @return 順位 (同点なら既存のスコアの後ろ)
+ */
+int find_score_table_slot(high_score *score)
+{
+    long my_score = atol(score->pts);
+    int lo = 0;
+    int hi = score_table.num;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (my_score > score_table.points[mid])
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    return MIN(lo, MAX_HISCORES - 1);
+}
+
+/*!
+ * @brief 書き込みロック中のハイスコアファイルにスコアを挿入する / Actually place an entry into the high score file
+ * @param fd ハイスコアファイルのファイルディスクリプタ (呼び出し側で書き込みロックを取っていること)
+ * @param score スコア情報参照ポインタ
+ * @return 挿入した順位、失敗したら-1
+ * @details 他のプロセスが追加したスコアを失わないよう、挿入の直前にファイルを読み直す。
+ */
+int add_score_table_entry(int fd, high_score *score)
+{
+    if (read_score_table(fd))
+        return -1;
+
+    int slot = find_score_table_slot(score);
+    int num = MIN(score_table.num + 1, MAX_HISCORES);
+    if (num - slot > 1)
+        (void)memmove(&score_table.entries[slot + 1], &score_table.entries[slot], (num - slot - 1) * sizeof(high_score));
+
+    score_table.entries[slot] = *score;
+    score_table.num = num;
+    index_score_table();
+    if (fd_seek(fd, (huge)slot * sizeof(high_score)))
+        return -1;
+
+    if (fd_write(fd, (char *)&score_table.entries[slot], (num - slot) * sizeof(high_score)))
+        return -1;
+
+    return slot;
+}
+
+/*!
+ * @brief 種族の最上位の順位を返す / Best rank of the race
+ * @param race 種族ID
+ * @return 順位、その種族のスコアがなければ-1
+ */
+int get_first_race_score(int race)
+{
+    if ((race < 0) || (race >= MAX_RACES))
+        return -1;
+
+    return score_table.race_first[race];
+}
+
+/*!
+ * @brief 同じ種族の次の順位を返す / Next rank of the same race
+ * @param rank 順位
+ * @return 順位、なければ-1
+ */
+int get_next_race_score(int rank) { return score_table.race_next[rank]; }
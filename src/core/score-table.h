@@ -0,0 +1,12 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "core/scores.h"
+
+errr load_score_table(int fd);
+int count_score_table(void);
+high_score *get_score_table_entry(int rank);
+int find_score_table_slot(high_score *score);
+int add_score_table_entry(int fd, high_score *score);
+int get_first_race_score(int race);
+int get_next_race_score(int rank);
@@ -13,6 +13,7 @@
 #include "core/scores.h"
 #include "cmd-io/cmd-dump.h"
 #include "core/asking-player.h"
+#include "core/score-table.h"
 #include "core/turn-compensator.h"
 #include "dungeon/dungeon.h"
 #include "game-option/birth-options.h"
@@ -46,108 +47,33 @@
 int highscore_fd = -1;
 
 /*!
- * @brief i番目のスコア情報にバッファ位置をシークする / Seek score 'i' in the highscore file
- * @param i スコア情報ID
- * @return 問題がなければ0を返す
- */
-static int highscore_seek(int i)
-{
-	/* Seek for the requested record */
-	return (fd_seek(highscore_fd, (huge)(i) * sizeof(high_score)));
-}
-
-
-/*!
- * @brief 所定ポインタからスコア情報を読み取る / Read one score from the highscore file
- * @param score スコア情報参照ポインタ
- * @return エラーコード
- */
-static errr highscore_read(high_score *score)
-{
-	/* Read the record, note failure */
-	return (fd_read(highscore_fd, (char*)(score), sizeof(high_score)));
-}
-
-
-/*!
- * @brief 所定ポインタへスコア情報を書き込む / Write one score to the highscore file
- * @param score スコア情報参照ポインタ
- * @return エラーコード(問題がなければ0を返す)
- */
-static int highscore_write(high_score *score)
-{
-	/* Write the record, note failure */
-	return (fd_write(highscore_fd, (char*)(score), sizeof(high_score)));
-}
-
-
-/*!
- * @brief スコア情報を全て得るまで繰り返し取得する / Just determine where a new score *would* be placed
+ * @brief 新しいスコアが入る順位を求める / Just determine where a new score *would* be placed
  * @param score スコア情報参照ポインタ
- * @return 正常ならば(MAX_HISCORES - 1)、問題があれば-1を返す
+ * @return 正常ならば入る順位、問題があれば-1を返す
  */
 static int highscore_where(high_score *score)
 {
 	/* Paranoia -- it may not have opened */
 	if (highscore_fd < 0) return -1;
 
-	/* Go to the start of the highscore file */
-	if (highscore_seek(0)) return -1;
-
-	/* Read until we get to a higher score */
-	high_score the_score;
-	int my_score = atoi(score->pts);
-	for (int i = 0; i < MAX_HISCORES; i++)
-	{
-		int old_score;
-		if (highscore_read(&the_score)) return (i);
-		old_score = atoi(the_score.pts);
-		if (my_score > old_score) return (i);
-	}
+	if (load_score_table(highscore_fd)) return -1;
 
-	/* The "last" entry is always usable */
-	return MAX_HISCORES - 1;
+	return find_score_table_slot(score);
 }
 
 
 /*!
- * @brief スコア情報をバッファの末尾に追加する / Actually place an entry into the high score file
+ * @brief スコア情報をスコアファイルに挿入する / Actually place an entry into the high score file
  * @param score スコア情報参照ポインタ
  * @return 正常ならば書き込んだスロット位置、問題があれば-1を返す / Return the location (0 is best) or -1 on "failure"
+ * @details 呼び出し側でスコアファイルの書き込みロックを取っておくこと。
  */
 static int highscore_add(high_score *score)
 {
 	/* Paranoia -- it may not have opened */
 	if (highscore_fd < 0) return -1;
 
-	/* Determine where the score should go */
-	int slot = highscore_where(score);
-
-	/* Hack -- Not on the list */
-	if (slot < 0) return -1;
-
-	/* Hack -- prepare to dump the new score */
-	high_score the_score = (*score);
-
-	/* Slide all the scores down one */
-	bool done = FALSE;
-	high_score tmpscore;
-	for (int i = slot; !done && (i < MAX_HISCORES); i++)
-	{
-		/* Read the old guy, note errors */
-		if (highscore_seek(i)) return -1;
-		if (highscore_read(&tmpscore)) done = TRUE;
-
-		/* Back up and dump the score we were holding */
-		if (highscore_seek(i)) return -1;
-		if (highscore_write(&the_score)) return -1;
-
-		/* Hack -- Save the old score, for the next pass */
-		the_score = tmpscore;
-	}
-
-	/* Return location used */
-	return slot;
+	return add_score_table_entry(highscore_fd, score);
 }
 
 
@@ -191,14 +117,9 @@ void display_scores_aux(int from, int to, int note, high_score *score)
 	if (to > MAX_HISCORES) to = MAX_HISCORES;
 
 
-	/* Seek to the beginning */
-	if (highscore_seek(0)) return;
-
 	/* Hack -- Count the high scores */
-	for (i = 0; i < MAX_HISCORES; i++)
-	{
-		if (highscore_read(&the_score)) break;
-	}
+	if (load_score_table(highscore_fd)) return;
+	i = count_score_table();
 
 	/* Hack -- allow "fake" entry to be last */
 	if ((note == i) && score) i++;
@@ -248,8 +169,8 @@ void display_scores_aux(int from, int to, int note, high_score *score)
 			else
 			{
 				/* Read the proper record */
-				if (highscore_seek(j)) break;
-				if (highscore_read(&the_score)) break;
+				if (j >= count_score_table()) break;
+				the_score = *get_score_table_entry(j);
 			}
 
 			/* Extract the race/class */
@@ -666,20 +587,20 @@ void show_highclass(player_type *current_player_ptr)
 		return;
 	}
 
-	if (highscore_seek(0)) return;
-
-	high_score the_score;
-	for (int i = 0; i < MAX_HISCORES; i++)
-		if (highscore_read(&the_score)) break;
+	if (load_score_table(highscore_fd))
+	{
+		(void)fd_close(highscore_fd);
+		highscore_fd = -1;
+		return;
+	}
 
 	int m = 0;
 	int j = 0;
 	PLAYER_LEVEL clev = 0;
 	int pr;
-	while ((m < 9) && (j < MAX_HISCORES))
+	while ((m < 9) && (j < count_score_table()))
 	{
-		if (highscore_seek(j)) break;
-		if (highscore_read(&the_score)) break;
+		high_score the_score = *get_score_table_entry(j);
 		pr = atoi(the_score.p_r);
 		clev = (PLAYER_LEVEL)atoi(the_score.cur_lev);
 
@@ -725,7 +646,7 @@ void show_highclass(player_type *current_player_ptr)
  */
 void race_score(player_type *current_player_ptr, int race_num)
 {
-	register int i = 0, j, m = 0;
+	int j, m = 0;
 	int pr, clev, lastlev;
 	high_score the_score;
 	char buf[1024], out_val[256], tmp_str[80];
@@ -747,40 +668,35 @@ void race_score(player_type *current_player_ptr, int race_num)
 		return;
 	}
 
-	if (highscore_seek(0)) return;
-
-	for (i = 0; i < MAX_HISCORES; i++)
+	if (load_score_table(highscore_fd))
 	{
-		if (highscore_read(&the_score)) break;
+		(void)fd_close(highscore_fd);
+		highscore_fd = -1;
+		return;
 	}
 
 	m = 0;
-	j = 0;
 
-	while ((m < 10) || (j < MAX_HISCORES))
+	/* Walk the scores of the race only */
+	for (j = get_first_race_score(race_num); (m < 10) && (j >= 0); j = get_next_race_score(j))
 	{
-		if (highscore_seek(j)) break;
-		if (highscore_read(&the_score)) break;
+		the_score = *get_score_table_entry(j);
 		pr = atoi(the_score.p_r);
 		clev = atoi(the_score.cur_lev);
 
-		if (pr == race_num)
-		{
 #ifdef JP
 		sprintf(out_val, "   %3d) %sの%s (レベル %2d)",
 			    (m + 1), race_info[pr].title, 
 				the_score.who,clev);
 #else
-			sprintf(out_val, "%3d) %s the %s (Level %3d)",
-			    (m + 1), the_score.who,
+		sprintf(out_val, "%3d) %s the %s (Level %3d)",
+		    (m + 1), the_score.who,
 			race_info[pr].title, clev);
 #endif
 
-			prt(out_val, (m + 7), 0);
-			m++;
-			lastlev = clev;
-		}
-		j++;
+		prt(out_val, (m + 7), 0);
+		m++;
+		lastlev = clev;
 	}
 
 	/* add player if qualified */
@@ -0,0 +1,362 @@
+﻿/*!
+ * @brief ヘルプ・スポイラーファイルの行索引 / Line-offset index of the files shown by show_file()
+ * @date 2026/10/19
+ * @details
+ * 表示対象の行 ("***** " で始まる制御行を除いた行) ごとにファイル内の位置を記録し、
+ * 任意の行へはfseek()1回で移動できるようにする。
+ * 制御行に書かれたメニューの選択肢とタグも索引を作る時に一緒に読み取る。
+ * libディレクトリのファイルは最近表示したものをいくつか保持し、
+ * 更新時刻と大きさが変わっていなければ次に開いた時に再利用する。
+ */
+
+#include "core/show-file-index.h"
+#include "core/show-file.h"
+#include "util/angband-files.h"
+#include "util/string-processor.h"
+#include <sys/stat.h>
+
+#define SHOW_FILE_INDEX_CACHE 4 /*!< 保持する索引の数 */
+
+/*!
+ * @brief ファイル内のタグ / A "***** <tag>" line
+ */
+typedef struct show_file_tag_type {
+    concptr name; /*!< タグ名 */
+    int line; /*!< タグの直後の行 */
+} show_file_tag_type;
+
+/*!
+ * @brief ファイルの行索引 / Offsets of the displayed lines of a file
+ */
+struct show_file_index_type {
+    char path[1024]; /*!< ファイルのパス */
+    bool cached; /*!< 保持対象か */
+    int users; /*!< 表示中のshow_file()の数 */
+    u32b last_used; /*!< 最後に使われた時刻 */
+    off_t bytes; /*!< 索引を作った時のファイルの大きさ */
+    time_t mtime; /*!< 索引を作った時のファイルの更新時刻 */
+
+    int lines; /*!< 表示対象の行数 */
+    int max_lines; /*!< offsetsの確保数 */
+    long *offsets; /*!< 各行の開始位置 */
+
+    int tag_num; /*!< タグの数 */
+    int max_tags; /*!< tagsの確保数 */
+    show_file_tag_type *tags; /*!< タグの一覧 */
+
+    bool menu; /*!< メニューの選択肢を含むか */
+    char hook[SHOW_FILE_MAX_HOOKS][32]; /*!< 選択肢ごとの移動先のファイル名 */
+};
+
+static show_file_index_type *index_cache[SHOW_FILE_INDEX_CACHE];
+static u32b index_clock = 0;
+
+/*!
+ * @brief 索引を解放する / Free an index
+ * @param index_ptr 索引への参照ポインタ
+ * @return なし
+ */
+static void kill_show_file_index(show_file_index_type *index_ptr)
+{
+    for (int i = 0; i < index_ptr->tag_num; i++)
+        string_free(index_ptr->tags[i].name);
+
+    if (index_ptr->tags)
+        C_KILL(index_ptr->tags, index_ptr->max_tags, show_file_tag_type);
+
+    if (index_ptr->offsets)
+        C_KILL(index_ptr->offsets, index_ptr->max_lines, long);
+
+    KILL(index_ptr, show_file_index_type);
+}
+
+/*!
+ * @brief 行の開始位置を追加する / Append the offset of a displayed line
+ * @param index_ptr 索引への参照ポインタ
+ * @param offset 行の開始位置
+ * @return なし
+ */
+static void add_show_file_line(show_file_index_type *index_ptr, long offset)
+{
+    if (index_ptr->lines == index_ptr->max_lines) {
+        int max_lines = index_ptr->max_lines ? index_ptr->max_lines * 2 : 256;
+        long *offsets;
+        C_MAKE(offsets, max_lines, long);
+        if (index_ptr->offsets) {
+            (void)C_COPY(offsets, index_ptr->offsets, index_ptr->lines, long);
+            C_KILL(index_ptr->offsets, index_ptr->max_lines, long);
+        }
+
+        index_ptr->offsets = offsets;
+        index_ptr->max_lines = max_lines;
+    }
+
+    index_ptr->offsets[index_ptr->lines++] = offset;
+}
+
+/*!
+ * @brief タグを追加する / Append a tag
+ * @param index_ptr 索引への参照ポインタ
+ * @param name タグ名
+ * @return なし
+ */
+static void add_show_file_tag(show_file_index_type *index_ptr, concptr name)
+{
+    if (index_ptr->tag_num == index_ptr->max_tags) {
+        int max_tags = index_ptr->max_tags ? index_ptr->max_tags * 2 : 16;
+        show_file_tag_type *tags;
+        C_MAKE(tags, max_tags, show_file_tag_type);
+        if (index_ptr->tags) {
+            (void)C_COPY(tags, index_ptr->tags, index_ptr->tag_num, show_file_tag_type);
+            C_KILL(index_ptr->tags, index_ptr->max_tags, show_file_tag_type);
+        }
+
+        index_ptr->tags = tags;
+        index_ptr->max_tags = max_tags;
+    }
+
+    show_file_tag_type *tag_ptr = &index_ptr->tags[index_ptr->tag_num++];
+    tag_ptr->name = string_make(name);
+    tag_ptr->line = index_ptr->lines;
+}
+
+/*!
+ * @brief 制御行を読み取る / Process a "***** " line
+ * @param index_ptr 索引への参照ポインタ
+ * @param str 制御行の文字列
+ * @return なし
+ */
+static void parse_show_file_control(show_file_index_type *index_ptr, char *str)
+{
+    if ((str[6] == '[') && isalpha(str[7])) {
+        int k = str[7] - 'A';
+        index_ptr->menu = TRUE;
+        if ((k >= 0) && (k < SHOW_FILE_MAX_HOOKS) && (str[8] == ']') && (str[9] == ' ')) {
+            strncpy(index_ptr->hook[k], str + 10, 31);
+            index_ptr->hook[k][31] = '\0';
+        }
+
+        return;
+    }
+
+    if (str[6] != '<')
+        return;
+
+    size_t len = strlen(str);
+    if (str[len - 1] != '>')
+        return;
+
+    str[len - 1] = '\0';
+    add_show_file_tag(index_ptr, str + 7);
+}
+
+/*!
+ * @brief ファイルを1回読んで索引を作る / Build the index in a single pass over the file
+ * @param fff 開いたファイル
+ * @param path ファイルのパス
+ * @return 作った索引への参照ポインタ
+ */
+static show_file_index_type *make_show_file_index(FILE *fff, concptr path)
+{
+    show_file_index_type *index_ptr;
+    MAKE(index_ptr, show_file_index_type);
+    angband_strcpy(index_ptr->path, path, sizeof(index_ptr->path));
+
+    char buf[1024];
+    rewind(fff);
+    while (TRUE) {
+        long offset = ftell(fff);
+        if (angband_fgets(fff, buf, sizeof(buf)))
+            break;
+
+        if (prefix(buf, "***** "))
+            parse_show_file_control(index_ptr, buf);
+        else
+            add_show_file_line(index_ptr, offset);
+    }
+
+    return index_ptr;
+}
+
+/*!
+ * @brief 保持する索引の空きを作る / Find a cache slot, evicting the least recently used index
+ * @return 空いた位置、全て表示中なら-1
+ */
+static int find_show_file_cache_slot(void)
+{
+    int slot = -1;
+    for (int i = 0; i < SHOW_FILE_INDEX_CACHE; i++) {
+        show_file_index_type *index_ptr = index_cache[i];
+        if (!index_ptr)
+            return i;
+
+        if (index_ptr->users)
+            continue;
+
+        if ((slot < 0) || (index_ptr->last_used < index_cache[slot]->last_used))
+            slot = i;
+    }
+
+    if (slot >= 0) {
+        kill_show_file_index(index_cache[slot]);
+        index_cache[slot] = NULL;
+    }
+
+    return slot;
+}
+
+/*!
+ * @brief ファイルの索引を得る / Get the index of an opened file
+ * @param fff 開いたファイル
+ * @param path ファイルのパス
+ * @param cacheable 閉じた後も保持するか (一時ファイルでは保持しない)
+ * @return 索引への参照ポインタ。使い終わったらclose_show_file_index()で返す
+ */
+show_file_index_type *open_show_file_index(FILE *fff, concptr path, bool cacheable)
+{
+    struct stat file_stat;
+    if (!cacheable || stat(path, &file_stat))
+        return make_show_file_index(fff, path);
+
+    for (int i = 0; i < SHOW_FILE_INDEX_CACHE; i++) {
+        show_file_index_type *index_ptr = index_cache[i];
+        if (!index_ptr || !streq(index_ptr->path, path))
+            continue;
+
+        if ((index_ptr->bytes == file_stat.st_size) && (index_ptr->mtime == file_stat.st_mtime)) {
+            index_ptr->users++;
+            index_ptr->last_used = ++index_clock;
+            return index_ptr;
+        }
+
+        if (index_ptr->users)
+            return make_show_file_index(fff, path);
+
+        kill_show_file_index(index_ptr);
+        index_cache[i] = NULL;
+    }
+
+    show_file_index_type *index_ptr = make_show_file_index(fff, path);
+    int slot = find_show_file_cache_slot();
+    if (slot < 0)
+        return index_ptr;
+
+    index_ptr->cached = TRUE;
+    index_ptr->users = 1;
+    index_ptr->last_used = ++index_clock;
+    index_ptr->bytes = file_stat.st_size;
+    index_ptr->mtime = file_stat.st_mtime;
+    index_cache[slot] = index_ptr;
+    return index_ptr;
+}
+
+/*!
+ * @brief 索引の使用を終える / Release an index obtained by open_show_file_index()
+ * @param index_ptr 索引への参照ポインタ
+ * @return なし
+ */
+void close_show_file_index(show_file_index_type *index_ptr)
+{
+    if (index_ptr->cached) {
+        index_ptr->users--;
+        return;
+    }
+
+    kill_show_file_index(index_ptr);
+}
+
+/*!
+ * @brief 表示対象の行数を返す / Number of the displayed lines
+ * @param index_ptr 索引への参照ポインタ
+ * @return 行数
+ */
+int count_show_file_lines(show_file_index_type *index_ptr) { return index_ptr->lines; }
+
+/*!
+ * @brief タグの行を返す / Line of the tag
+ * @param index_ptr 索引への参照ポインタ
+ * @param tag タグ名
+ * @return タグの直後の行、なければ-1
+ */
+int find_show_file_tag(show_file_index_type *index_ptr, concptr tag)
+{
+    int line = -1;
+    for (int i = 0; i < index_ptr->tag_num; i++)
+        if (streq(index_ptr->tags[i].name, tag))
+            line = index_ptr->tags[i].line;
+
+    return line;
+}
+
+/*!
+ * @brief メニューの選択肢の移動先を返す / File name of the menu entry
+ * @param index_ptr 索引への参照ポインタ
+ * @param key 選択肢の番号 ('A'からの差)
+ * @return ファイル名、選択肢がなければNULL
+ */
+concptr get_show_file_hook(show_file_index_type *index_ptr, int key)
+{
+    if (!index_ptr->menu || (key < 0) || (key >= SHOW_FILE_MAX_HOOKS) || !index_ptr->hook[key][0])
+        return NULL;
+
+    return index_ptr->hook[key];
+}
+
+/*!
+ * @brief 指定行の先頭へ移動する / Seek to the start of a displayed line
+ * @param fff 開いたファイル
+ * @param index_ptr 索引への参照ポインタ
+ * @param line 行
+ * @return 移動できたらTRUE、行がファイルの範囲外ならFALSE
+ */
+bool seek_show_file_line(FILE *fff, show_file_index_type *index_ptr, int line)
+{
+    if ((line < 0) || (line >= index_ptr->lines))
+        return FALSE;
+
+    return fseek(fff, index_ptr->offsets[line], SEEK_SET) == 0;
+}
+
+/*!
+ * @brief 制御行を飛ばして次の表示対象の行を読む / Read the next displayed line
+ * @param fff 開いたファイル
+ * @param buf 読み込み先
+ * @param n 読み込み先の大きさ
+ * @return エラーコード
+ */
+errr read_show_file_line(FILE *fff, char *buf, huge n)
+{
+    while (TRUE) {
+        if (angband_fgets(fff, buf, n))
+            return 1;
+
+        if (!prefix(buf, "***** "))
+            return 0;
+    }
+}
+
+/*!
+ * @brief 指定行以降で文字列を含む最初の行を探す / Find the first line from the given one that contains the string
+ * @param fff 開いたファイル
+ * @param index_ptr 索引への参照ポインタ
+ * @param line 探し始める行
+ * @param find 探す文字列 (小文字)
+ * @return 見つかった行、なければ-1
+ */
+int search_show_file(FILE *fff, show_file_index_type *index_ptr, int line, concptr find)
+{
+    if (!seek_show_file_line(fff, index_ptr, line))
+        return -1;
+
+    char buf[1024];
+    for (; line < index_ptr->lines; line++) {
+        if (read_show_file_line(fff, buf, sizeof(buf)))
+            break;
+
+        str_tolower(buf);
+        if (angband_strstr(buf, find))
+            return line;
+    }
+
+    return -1;
+}
@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+#define SHOW_FILE_MAX_HOOKS 68 /*!< メニューの選択肢の最大数 */
+
+typedef struct show_file_index_type show_file_index_type;
+
+show_file_index_type *open_show_file_index(FILE *fff, concptr path, bool cacheable);
+void close_show_file_index(show_file_index_type *index_ptr);
+int count_show_file_lines(show_file_index_type *index_ptr);
+int find_show_file_tag(show_file_index_type *index_ptr, concptr tag);
+concptr get_show_file_hook(show_file_index_type *index_ptr, int key);
+bool seek_show_file_line(FILE *fff, show_file_index_type *index_ptr, int line);
+errr read_show_file_line(FILE *fff, char *buf, huge n);
+int search_show_file(FILE *fff, show_file_index_type *index_ptr, int line, concptr find);
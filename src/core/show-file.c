@@ -1,5 +1,6 @@
 ﻿#include "core/show-file.h"
 #include "core/asking-player.h"
+#include "core/show-file-index.h"
 #include "io/files-util.h"
 #include "io/input-key-acceptor.h"
 #include "main/sound-of-music.h"
@@ -136,12 +137,6 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 	char caption[128];
 	strcpy(caption, "");
 
-	char hook[68][32];
-	for (int i = 0; i < 68; i++)
-	{
-		hook[i][0] = '\0';
-	}
-
 	char filename[1024];
 	strcpy(filename, name);
 	int n = strlen(filename);
@@ -201,96 +196,38 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 		return TRUE;
 	}
 
-	int skey;
-	int next = 0;
-	int size = 0;
-	int back = 0;
-	bool menu = FALSE;
-	char buf[1024];
-	bool reverse = (line < 0);
-	while (TRUE)
+	show_file_index_type *index_ptr = open_show_file_index(fff, path, what == NULL);
+	int size = count_show_file_lines(index_ptr);
+	if (tag)
 	{
-		char *str = buf;
-		if (angband_fgets(fff, buf, sizeof(buf))) break;
-		if (!prefix(str, "***** "))
-		{
-			next++;
-			continue;
-		}
-
-		if ((str[6] == '[') && isalpha(str[7]))
-		{
-			int k = str[7] - 'A';
-			menu = TRUE;
-			if ((str[8] == ']') && (str[9] == ' '))
-			{
-				strncpy(hook[k], str + 10, 31);
-				hook[k][31] = '\0';
-			}
-
-			continue;
-		}
-
-		if (str[6] != '<') continue;
-
-		size_t len = strlen(str);
-		if (str[len - 1] == '>')
-		{
-			str[len - 1] = '\0';
-			if (tag && streq(str + 7, tag)) line = next;
-		}
+		int tag_line = find_show_file_tag(index_ptr, tag);
+		if (tag_line >= 0) line = tag_line;
 	}
 
-	size = next;
+	int skey;
+	char buf[1024];
+	bool reverse = (line < 0);
 	int rows = hgt - 4;
 	if (line == -1)
 		line = ((size - 1) / rows)*rows;
 
 	term_clear();
 
-	concptr find = NULL;
+	concptr shower = NULL;
 	while (TRUE)
 	{
 		if (line >= size - rows)
 			line = size - rows;
 		if (line < 0) line = 0;
 
-		if (next > line)
-		{
-			angband_fclose(fff);
-			fff = angband_fopen(path, "r");
-			if (!fff) return FALSE;
-
-			next = 0;
-		}
-
-		while (next < line)
-		{
-			if (angband_fgets(fff, buf, sizeof(buf))) break;
-			if (prefix(buf, "***** ")) continue;
-			next++;
-		}
-
 		int row_count = 0;
-		concptr shower = NULL;
-		for (int i = 0; i < rows; i++)
+		if (seek_show_file_line(fff, index_ptr, line))
 		{
-			concptr str = buf;
-			if (!i) line = next;
-			if (angband_fgets(fff, buf, sizeof(buf))) break;
-			if (prefix(buf, "***** ")) continue;
-			next++;
-			if (find && !i)
+			for (; row_count < rows; row_count++)
 			{
-				char lc_buf[1024];
-				strcpy(lc_buf, str);
-				str_tolower(lc_buf);
-				if (!angband_strstr(lc_buf, find)) continue;
+				if (read_show_file_line(fff, buf, sizeof(buf))) break;
+				show_file_aux_line(buf, row_count + 2, shower);
 			}
-
-			find = NULL;
-			show_file_aux_line(str, i + 2, shower);
-			row_count++;
 		}
 
 		while (row_count < rows)
@@ -299,14 +236,6 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 			row_count++;
 		}
 
-		if (find)
-		{
-			bell();
-			line = back;
-			find = NULL;
-			continue;
-		}
-
 		if (show_version)
 		{
 			prt(format(_("[変愚蛮怒 %d.%d.%d, %s, %d/%d]", "[Hengband %d.%d.%d, %s, Line %d/%d]"),
@@ -367,11 +296,11 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 			{
 				if (finder_str[0])
 				{
-					find = finder_str;
-					back = line;
-					line = line + 1;
 					str_tolower(finder_str);
 					shower = finder_str;
+					int found = search_show_file(fff, index_ptr, line + 1, finder_str);
+					if (found < 0) bell();
+					else line = found;
 				}
 				else shower = NULL;
 			}
@@ -447,18 +376,16 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 			break;
 		}
 
-		if (menu)
-		{
-			int key = -1;
-			if (!(skey & SKEY_MASK) && isalpha(skey))
-				key = skey - 'A';
+		int key = -1;
+		if (!(skey & SKEY_MASK) && isalpha(skey))
+			key = skey - 'A';
 
-			if ((key > -1) && hook[key][0])
-			{
-				/* Recurse on that file */
-				if (!show_file(creature_ptr, TRUE, hook[key], NULL, 0, mode))
-					skey = 'q';
-			}
+		concptr hook = get_show_file_hook(index_ptr, key);
+		if (hook)
+		{
+			/* Recurse on that file */
+			if (!show_file(creature_ptr, TRUE, hook, NULL, 0, mode))
+				skey = 'q';
 		}
 
 		if (skey == '|')
@@ -503,6 +430,7 @@ bool show_file(player_type *creature_ptr, bool show_version, concptr name, concp
 		if (skey == 'q') break;
 	}
 
+	close_show_file_index(index_ptr);
 	angband_fclose(fff);
 	return (skey != 'q');
 }
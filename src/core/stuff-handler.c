@@ -1,6 +1,7 @@
 ﻿#include "core/stuff-handler.h"
 #include "core/player-redraw-types.h"
 #include "core/player-update-types.h"
+#include "core/turn-profiler.h"
 #include "core/window-redrawer.h"
 
 /*!
@@ -10,12 +11,14 @@
  */
 void handle_stuff(player_type* player_ptr)
 {
+    TURN_PROFILE_BEGIN(TPS_HANDLE_STUFF);
     if (player_ptr->update)
         update_creature(player_ptr);
     if (player_ptr->redraw)
         redraw_stuff(player_ptr);
     if (player_ptr->window)
         window_stuff(player_ptr);
+    TURN_PROFILE_END(TPS_HANDLE_STUFF);
 }
 
 /*
@@ -0,0 +1,166 @@
+﻿/*!
+ * @brief ターン処理の計測 / Profiling of the game turns
+ * @date 2026/10/19
+ * @details
+ * configure の --enable-profiler (TURN_PROFILER) を指定した時だけ組み込まれる。
+ * 指定しなければ計測用のマクロは空になり、本体の処理には何も残らない。
+ * 各区分の時間は入れ子の区分を含み、キー入力を待っていた時間は含まない。
+ */
+
+#include "core/turn-profiler.h"
+
+#ifdef TURN_PROFILER
+#include "core/window-redrawer.h"
+#include "term/z-form.h"
+#include "util/usec-timer.h"
+
+/*!
+ * ターン処理の計測結果 / Statistics collected since the last reset
+ */
+turn_profile_type turn_profile;
+
+/*!
+ * 計測結果の見出し / Column titles of the table
+ */
+const concptr turn_profile_header = "section             calls    avg us    max us   us/turn  share";
+
+/*!
+ * 計測区分の表示名 / Names of the sections
+ */
+static const concptr turn_profile_section_names[MAX_TPS] = {
+    "process_player",
+    "process_monsters",
+    "process_world",
+    "handle_stuff",
+    " calc_bonuses",
+    " update_view",
+    " update_lite",
+    " update_mon_lite",
+    " update_flow",
+    " update_monsters",
+    "term_fresh",
+    "generate_floor",
+};
+
+/*!
+ * @brief キー入力待ちを除いた経過時間を返す / Get the time excluding the waits for keypresses
+ * @return 任意の起点からの経過時間
+ */
+static double get_active_usec(void) { return get_usec_time() - turn_profile.idle_usec; }
+
+/*!
+ * @brief 計測結果を消去する / Reset the statistics
+ * @return なし
+ * @details 計測中の区分の深さとキー入力待ちの累計は残し、計測中の区分は消去した時点からの時間だけを数える。
+ */
+void reset_turn_profile(void)
+{
+    int depth[MAX_TPS];
+    double idle_usec = turn_profile.idle_usec;
+    (void)C_COPY(depth, turn_profile.depth, MAX_TPS, int);
+    (void)WIPE(&turn_profile, turn_profile_type);
+    (void)C_COPY(turn_profile.depth, depth, MAX_TPS, int);
+    turn_profile.idle_usec = idle_usec;
+    turn_profile.reset_idle_usec = idle_usec;
+    turn_profile.reset_usec = get_active_usec();
+}
+
+/*!
+ * @brief 計測を始めてからキー入力待ちを除いた経過時間を返す / Get the busy time since the reset
+ * @return 経過時間。計測を始めていなければ0
+ */
+static double get_busy_usec(void)
+{
+    if (turn_profile.reset_usec == 0)
+        return 0;
+
+    return get_active_usec() - turn_profile.reset_usec;
+}
+
+/*!
+ * @brief 区分の計測を始める / Begin to time a section
+ * @param section 計測区分
+ * @return 開始時刻
+ */
+double begin_turn_profile(turn_profile_section section)
+{
+    if (turn_profile.reset_usec == 0)
+        reset_turn_profile();
+
+    turn_profile.depth[section]++;
+    return get_active_usec();
+}
+
+/*!
+ * @brief 区分の計測を終えて累計する / Finish timing a section
+ * @param section 計測区分
+ * @param start begin_turn_profile()の返り値
+ * @return なし
+ * @details 同じ区分が入れ子になった時は一番外側だけを数える。
+ */
+void end_turn_profile(turn_profile_section section, double start)
+{
+    if (--turn_profile.depth[section] > 0)
+        return;
+
+    double usec = get_active_usec() - MAX(start, turn_profile.reset_usec);
+    turn_profile.calls[section]++;
+    turn_profile.total_usec[section] += usec;
+    if (usec > turn_profile.max_usec[section])
+        turn_profile.max_usec[section] = usec;
+}
+
+/*!
+ * @brief キー入力待ちの計測を始める / Begin to wait for a keypress
+ * @return 開始時刻
+ */
+double begin_turn_profile_idle(void) { return get_usec_time(); }
+
+/*!
+ * @brief キー入力待ちの時間を計測中の区分から差し引く / Exclude the wait for a keypress from the open sections
+ * @param start begin_turn_profile_idle()の返り値
+ * @return なし
+ */
+void end_turn_profile_idle(double start) { turn_profile.idle_usec += get_usec_time() - start; }
+
+/*!
+ * @brief ゲームターンを数え、一定間隔でサブウィンドウを描き直させる / Count a game turn
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+void tick_turn_profile(player_type *player_ptr)
+{
+    if (++turn_profile.count[TPC_GAME_TURN] % TURN_PROFILE_REFRESH == 0)
+        player_ptr->window |= PW_TURN_PROFILE;
+}
+
+/*!
+ * @brief 計測期間と計数の要約を書式化する / Format the summary of the counters
+ * @param buf 書式化先のバッファ
+ * @param max バッファの大きさ
+ * @return なし
+ */
+void format_turn_profile_summary(char *buf, uint max)
+{
+    strnfmt(buf, max, "%lu game turns, %lu monster moves, %.1f ms busy, %.1f ms idle", (unsigned long)turn_profile.count[TPC_GAME_TURN],
+        (unsigned long)turn_profile.count[TPC_MONSTER_MOVE], get_busy_usec() / 1000, (turn_profile.idle_usec - turn_profile.reset_idle_usec) / 1000);
+}
+
+/*!
+ * @brief 区分ごとの計測結果を1行に書式化する / Format a row of the table
+ * @param section 計測区分
+ * @param buf 書式化先のバッファ
+ * @param max バッファの大きさ
+ * @return なし
+ * @details share はキー入力待ちを除いた計測期間に占める割合で、入れ子の区分は親の区分にも含まれる。
+ */
+void format_turn_profile_line(turn_profile_section section, char *buf, uint max)
+{
+    double busy = get_busy_usec();
+    u32b calls = turn_profile.calls[section];
+    u32b turns = turn_profile.count[TPC_GAME_TURN];
+    double total = turn_profile.total_usec[section];
+    strnfmt(buf, max, "%-16s %8lu %9.1f %9.1f %9.2f %5.1f%%", turn_profile_section_names[section], (unsigned long)calls, calls ? total / calls : 0.0,
+        turn_profile.max_usec[section], turns ? total / turns : 0.0, busy > 0 ? total * 100 / busy : 0.0);
+}
+#endif
@@ -0,0 +1,75 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+#ifdef TURN_PROFILER
+/*!
+ * @brief ターン処理の計測区分 / Sections of a game turn timed by the profiler
+ */
+typedef enum turn_profile_section {
+    TPS_PROCESS_PLAYER = 0, /*!< process_player() */
+    TPS_PROCESS_MONSTERS = 1, /*!< process_monsters() */
+    TPS_PROCESS_WORLD = 2, /*!< process_world() */
+    TPS_HANDLE_STUFF = 3, /*!< handle_stuff() */
+    TPS_CALC_BONUSES = 4, /*!< PU_BONUS による calc_bonuses() */
+    TPS_UPDATE_VIEW = 5, /*!< PU_VIEW による update_view() */
+    TPS_UPDATE_LITE = 6, /*!< PU_LITE による update_lite() */
+    TPS_UPDATE_MON_LITE = 7, /*!< PU_MON_LITE による update_mon_lite() */
+    TPS_UPDATE_FLOW = 8, /*!< PU_FLOW による update_flow() */
+    TPS_UPDATE_MONSTERS = 9, /*!< PU_DISTANCE/PU_MONSTERS による update_monsters() */
+    TPS_TERM_FRESH = 10, /*!< term_fresh() */
+    TPS_GENERATE_FLOOR = 11, /*!< generate_floor() */
+    MAX_TPS = 12,
+} turn_profile_section;
+
+/*!
+ * @brief ターン処理の計数区分 / Events counted by the profiler
+ */
+typedef enum turn_profile_counter {
+    TPC_GAME_TURN = 0, /*!< ゲームターン */
+    TPC_MONSTER_MOVE = 1, /*!< process_monster() を呼んだ回数 */
+    MAX_TPC = 2,
+} turn_profile_counter;
+
+#define TURN_PROFILE_REFRESH 10 /*!< サブウィンドウを描き直す間隔 (ゲームターン) */
+
+/*!
+ * @brief ターン処理の計測結果 / Accumulated statistics of the game turns
+ */
+typedef struct turn_profile_type {
+    double reset_usec; /*!< 計測を始めた時刻 (キー入力待ちを除いた時計) */
+    double idle_usec; /*!< キー入力を待っていた累計時間 */
+    double reset_idle_usec; /*!< 計測を始めた時点の idle_usec */
+    int depth[MAX_TPS]; /*!< 区分ごとの入れ子の深さ */
+    u32b calls[MAX_TPS]; /*!< 区分ごとの呼び出し回数 */
+    double total_usec[MAX_TPS]; /*!< 区分ごとの累計時間 */
+    double max_usec[MAX_TPS]; /*!< 区分ごとの1回あたりの最長時間 */
+    u32b count[MAX_TPC]; /*!< 計数区分ごとの回数 */
+} turn_profile_type;
+
+extern turn_profile_type turn_profile;
+extern const concptr turn_profile_header;
+
+void reset_turn_profile(void);
+double begin_turn_profile(turn_profile_section section);
+void end_turn_profile(turn_profile_section section, double start);
+double begin_turn_profile_idle(void);
+void end_turn_profile_idle(double start);
+void tick_turn_profile(player_type *player_ptr);
+void format_turn_profile_summary(char *buf, uint max);
+void format_turn_profile_line(turn_profile_section section, char *buf, uint max);
+
+#define TURN_PROFILE_BEGIN(S) double turn_profile_start_##S = begin_turn_profile(S)
+#define TURN_PROFILE_END(S) end_turn_profile(S, turn_profile_start_##S)
+#define TURN_PROFILE_IDLE_BEGIN() double turn_profile_idle_start = begin_turn_profile_idle()
+#define TURN_PROFILE_IDLE_END() end_turn_profile_idle(turn_profile_idle_start)
+#define TURN_PROFILE_COUNT(C) (turn_profile.count[(C)]++)
+#define TURN_PROFILE_TICK(P) tick_turn_profile(P)
+#else
+#define TURN_PROFILE_BEGIN(S)
+#define TURN_PROFILE_END(S)
+#define TURN_PROFILE_IDLE_BEGIN()
+#define TURN_PROFILE_IDLE_END()
+#define TURN_PROFILE_COUNT(C)
+#define TURN_PROFILE_TICK(P)
+#endif
@@ -289,4 +289,11 @@ void window_stuff(player_type *player_ptr)
         player_ptr->window &= ~(PW_OBJECT);
         fix_object(player_ptr);
     }
+
+#ifdef TURN_PROFILER
+    if (player_ptr->window & (PW_TURN_PROFILE)) {
+        player_ptr->window &= ~(PW_TURN_PROFILE);
+        fix_turn_profile();
+    }
+#endif
 }
@@ -14,6 +14,7 @@ typedef enum window_redraw_type {
     PW_OBJECT = 0x00000200L, /*!<サブウィンドウ描画フラグ: アイテムの知識 / Display object recall */
     PW_DUNGEON = 0x00000400L, /*!<サブウィンドウ描画フラグ: ダンジョンの地形 / Display dungeon view */
     PW_SNAPSHOT = 0x00000800L, /*!<サブウィンドウ描画フラグ: 記念写真 / Display snap-shot */
+    PW_TURN_PROFILE = 0x00001000L, /*!<サブウィンドウ描画フラグ: ターン処理の計測結果 / Display turn profile */
 } window_redraw_type;
 
 void redraw_window(void);
@@ -9,6 +9,7 @@
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
 #include "core/turn-compensator.h"
+#include "core/turn-profiler.h"
 #include "core/window-redrawer.h"
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
@@ -20,6 +21,7 @@
 #include "io/cursor.h"
 #include "io/input-key-requester.h"
 #include "io/write-diary.h"
+#include "lore/lore-journal.h"
 #include "market/arena.h"
 #include "mind/mind-ninja.h"
 #include "monster-race/monster-race.h"
@@ -155,16 +157,12 @@ void process_dungeon(player_type *player_ptr, bool load_game)
         if ((floor_ptr->m_cnt + 32 > current_world_ptr->max_m_idx) && !player_ptr->phase_out)
             compact_monsters(player_ptr, 64);
 
-        if ((floor_ptr->m_cnt + 32 < floor_ptr->m_max) && !player_ptr->phase_out)
-            compact_monsters(player_ptr, 0);
-
         if (floor_ptr->o_cnt + 32 > current_world_ptr->max_o_idx)
             compact_objects(player_ptr, 64);
 
-        if (floor_ptr->o_cnt + 32 < floor_ptr->o_max)
-            compact_objects(player_ptr, 0);
-
+        TURN_PROFILE_BEGIN(TPS_PROCESS_PLAYER);
         process_player(player_ptr);
+        TURN_PROFILE_END(TPS_PROCESS_PLAYER);
         process_upkeep_with_speed(player_ptr);
         handle_stuff(player_ptr);
 
@@ -175,7 +173,9 @@ void process_dungeon(player_type *player_ptr, bool load_game)
         if (!player_ptr->playing || player_ptr->is_dead)
             break;
 
+        TURN_PROFILE_BEGIN(TPS_PROCESS_MONSTERS);
         process_monsters(player_ptr);
+        TURN_PROFILE_END(TPS_PROCESS_MONSTERS);
         handle_stuff(player_ptr);
 
         move_cursor_relative(player_ptr->y, player_ptr->x);
@@ -185,7 +185,10 @@ void process_dungeon(player_type *player_ptr, bool load_game)
         if (!player_ptr->playing || player_ptr->is_dead)
             break;
 
+        TURN_PROFILE_BEGIN(TPS_PROCESS_WORLD);
         process_world(player_ptr);
+        TURN_PROFILE_END(TPS_PROCESS_WORLD);
+        flush_lore_journal(player_ptr);
         handle_stuff(player_ptr);
 
         move_cursor_relative(player_ptr->y, player_ptr->x);
@@ -196,6 +199,7 @@ void process_dungeon(player_type *player_ptr, bool load_game)
             break;
 
         current_world_ptr->game_turn++;
+        TURN_PROFILE_TICK(player_ptr);
         if (current_world_ptr->dungeon_turn < current_world_ptr->dungeon_turn_limit) {
             if (!player_ptr->wild_mode || wild_regen)
                 current_world_ptr->dungeon_turn++;
@@ -26,6 +26,7 @@
 #include "object-enchant/item-apply-magic.h"
 #include "object-enchant/trg-types.h"
 #include "object/object-generator.h"
+#include "object/object-info.h"
 #include "player/player-personalities-types.h"
 #include "player/player-status.h"
 #include "system/artifact-type-definition.h"
@@ -120,6 +121,7 @@ void complete_quest(player_type *player_ptr, QUEST_IDX quest_num)
 
     q_ptr->status = QUEST_STATUS_COMPLETED;
     q_ptr->complev = player_ptr->lev;
+    update_object_state_version();
     update_playtime();
     q_ptr->comptime = current_world_ptr->play_time;
 
@@ -2,6 +2,7 @@
 #include "dungeon/quest.h"
 #include "effect/effect-monster-util.h"
 #include "effect/spells-effect-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race-hook.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
@@ -268,7 +269,7 @@ process_result effect_monster_domination(player_type *caster_ptr, effect_monster
     if ((em_ptr->r_ptr->flags1 & (RF1_UNIQUE | RF1_QUESTOR)) || (em_ptr->r_ptr->flags3 & RF3_NO_CONF)
         || (em_ptr->r_ptr->level > randint1((em_ptr->dam - 10) < 1 ? 1 : (em_ptr->dam - 10)) + 10)) {
         if (((em_ptr->r_ptr->flags3 & RF3_NO_CONF) != 0) && is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flags3 |= (RF3_NO_CONF);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 
         em_ptr->do_conf = 0;
         effect_monster_domination_corrupted(caster_ptr, em_ptr);
@@ -316,7 +317,7 @@ static bool effect_monster_crusade_domination(player_type *caster_ptr, effect_mo
     set_pet(caster_ptr, em_ptr->m_ptr);
     (void)set_monster_fast(caster_ptr, em_ptr->g_ptr->m_idx, monster_fast_remaining(em_ptr->m_ptr) + 100);
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= RF3_GOOD;
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_GOOD);
 
     return TRUE;
 }
@@ -334,7 +335,7 @@ process_result effect_monster_crusade(player_type *caster_ptr, effect_monster_ty
     if ((em_ptr->r_ptr->flags3 & RF3_NO_FEAR) == 0)
         em_ptr->do_fear = randint1(90) + 10;
     else if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= RF3_NO_FEAR;
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_FEAR);
 
     em_ptr->dam = 0;
     return PROCESS_CONTINUE;
@@ -1,5 +1,6 @@
 ﻿#include "effect/effect-monster-evil.h"
 #include "effect/effect-monster-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race-hook.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
@@ -13,14 +14,14 @@ static bool effect_monster_away_resist(player_type *caster_ptr, effect_monster_t
 
 	if ((em_ptr->r_ptr->flags1 & (RF1_UNIQUE)) || (em_ptr->r_ptr->flagsr & RFR_RES_ALL))
 	{
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flagsr |= RFR_RES_TELE;
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 		em_ptr->note = _("には効果がなかった。", " is unaffected.");
 		return TRUE;
 	}
 
 	if (em_ptr->r_ptr->level > randint1(100))
 	{
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flagsr |= RFR_RES_TELE;
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 		em_ptr->note = _("には耐性がある！", " resists!");
 		return TRUE;
 	}
@@ -43,7 +44,7 @@ process_result effect_monster_away_undead(player_type *caster_ptr, effect_monste
 	{
 		if (em_ptr->seen) em_ptr->obvious = TRUE;
 		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-			em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
+			lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
 
 		em_ptr->do_dist = em_ptr->dam;
 	}
@@ -67,7 +68,7 @@ process_result effect_monster_away_evil(player_type *caster_ptr, effect_monster_
 	{
 		if (em_ptr->seen) em_ptr->obvious = TRUE;
 		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-			em_ptr->r_ptr->r_flags3 |= (RF3_EVIL);
+			lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_EVIL);
 
 		em_ptr->do_dist = em_ptr->dam;
 	}
@@ -103,7 +104,7 @@ process_result effect_monster_turn_undead(player_type *caster_ptr, effect_monste
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
 
 	em_ptr->do_fear = damroll(3, (em_ptr->dam / 2)) + 1;
 	if (em_ptr->r_ptr->level > randint1((em_ptr->dam - 10) < 1 ? 1 : (em_ptr->dam - 10)) + 10)
@@ -129,7 +130,7 @@ process_result effect_monster_turn_evil(player_type *caster_ptr, effect_monster_
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_EVIL);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_EVIL);
 
 	em_ptr->do_fear = damroll(3, (em_ptr->dam / 2)) + 1;
 	if (em_ptr->r_ptr->level > randint1((em_ptr->dam - 10) < 1 ? 1 : (em_ptr->dam - 10)) + 10)
@@ -175,7 +176,7 @@ process_result effect_monster_disp_undead(player_type *caster_ptr, effect_monste
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
 	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-		em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
+		lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
 
 	em_ptr->note = _("は身震いした。", " shudders.");
 	em_ptr->note_dies = _("はドロドロに溶けた！", " dissolves!");
@@ -194,7 +195,7 @@ process_result effect_monster_disp_evil(player_type *caster_ptr, effect_monster_
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_EVIL);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_EVIL);
 
 	em_ptr->note = _("は身震いした。", " shudders.");
 	em_ptr->note_dies = _("はドロドロに溶けた！", " dissolves!");
@@ -213,7 +214,7 @@ process_result effect_monster_disp_good(player_type *caster_ptr, effect_monster_
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_GOOD);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_GOOD);
 
 	em_ptr->note = _("は身震いした。", " shudders.");
 	em_ptr->note_dies = _("はドロドロに溶けた！", " dissolves!");
@@ -249,7 +250,7 @@ process_result effect_monster_disp_demon(player_type *caster_ptr, effect_monster
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_DEMON);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_DEMON);
 
 	em_ptr->note = _("は身震いした。", " shudders.");
 	em_ptr->note_dies = _("はドロドロに溶けた！", " dissolves!");
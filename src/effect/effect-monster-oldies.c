@@ -1,6 +1,7 @@
 ﻿#include "effect/effect-monster-oldies.h"
 #include "core/player-redraw-types.h"
 #include "effect/effect-monster-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/race-flags3.h"
@@ -221,7 +222,7 @@ process_result effect_monster_old_sleep(player_type *caster_ptr, effect_monster_
 	{
 		if (em_ptr->r_ptr->flags3 & RF3_NO_SLEEP)
 		{
-			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_NO_SLEEP);
+			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_SLEEP);
 		}
 
 		em_ptr->note = _("には効果がなかった。", " is unaffected.");
@@ -253,7 +254,7 @@ process_result effect_monster_old_conf(player_type *caster_ptr, effect_monster_t
 	{
 		if (em_ptr->r_ptr->flags3 & (RF3_NO_CONF))
 		{
-			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_NO_CONF);
+			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 		}
 
 		em_ptr->do_conf = 0;
@@ -3,6 +3,7 @@
 #include "core/window-redrawer.h"
 #include "effect/effect-monster-util.h"
 #include "floor/line-of-sight.h"
+#include "lore/lore-journal.h"
 #include "mind/mind-mirror-master.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
@@ -23,7 +24,7 @@ static bool effect_monster_psi_empty_mind(player_type *caster_ptr, effect_monste
 	em_ptr->dam = 0;
 	em_ptr->note = _("には完全な耐性がある！", " is immune.");
 	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-		em_ptr->r_ptr->r_flags2 |= (RF2_EMPTY_MIND);
+		lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_EMPTY_MIND);
 
 	return TRUE;
 }
@@ -1,5 +1,6 @@
 ﻿#include "effect/effect-monster-resist-hurt.h"
 #include "effect/effect-monster-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
 #include "monster-race/race-flags1.h"
@@ -28,7 +29,7 @@ process_result effect_monster_acid(player_type *caster_ptr, effect_monster_type
     em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
     em_ptr->dam /= 9;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_IM_ACID);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_ACID);
 
     return PROCESS_CONTINUE;
 }
@@ -44,7 +45,7 @@ process_result effect_monster_elec(player_type *caster_ptr, effect_monster_type
     em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
     em_ptr->dam /= 9;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_IM_ELEC);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_ELEC);
 
     return PROCESS_CONTINUE;
 }
@@ -58,7 +59,7 @@ process_result effect_monster_fire(player_type *caster_ptr, effect_monster_type
         em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
         em_ptr->dam /= 9;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_IM_FIRE);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_FIRE);
 
         return PROCESS_CONTINUE;
     }
@@ -69,7 +70,7 @@ process_result effect_monster_fire(player_type *caster_ptr, effect_monster_type
     em_ptr->note = _("はひどい痛手をうけた。", " is hit hard.");
     em_ptr->dam *= 2;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= (RF3_HURT_FIRE);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_FIRE);
 
     return PROCESS_CONTINUE;
 }
@@ -83,7 +84,7 @@ process_result effect_monster_cold(player_type *caster_ptr, effect_monster_type
         em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
         em_ptr->dam /= 9;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_IM_COLD);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_COLD);
 
         return PROCESS_CONTINUE;
     }
@@ -94,7 +95,7 @@ process_result effect_monster_cold(player_type *caster_ptr, effect_monster_type
     em_ptr->note = _("はひどい痛手をうけた。", " is hit hard.");
     em_ptr->dam *= 2;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= (RF3_HURT_COLD);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_COLD);
 
     return PROCESS_CONTINUE;
 }
@@ -110,7 +111,7 @@ process_result effect_monster_pois(player_type *caster_ptr, effect_monster_type
     em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
     em_ptr->dam /= 9;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_IM_POIS);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_POIS);
 
     return PROCESS_CONTINUE;
 }
@@ -125,7 +126,7 @@ process_result effect_monster_nuke(player_type *caster_ptr, effect_monster_type
         em_ptr->dam *= 3;
         em_ptr->dam /= randint1(6) + 6;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_IM_POIS);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_POIS);
 
         return PROCESS_CONTINUE;
     }
@@ -147,7 +148,7 @@ process_result effect_monster_hell_fire(player_type *caster_ptr, effect_monster_
     em_ptr->note = _("はひどい痛手をうけた。", " is hit hard.");
     em_ptr->dam *= 2;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= RF3_GOOD;
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_GOOD);
 
     return PROCESS_CONTINUE;
 }
@@ -167,7 +168,7 @@ process_result effect_monster_holy_fire(player_type *caster_ptr, effect_monster_
     em_ptr->dam *= 2;
     em_ptr->note = _("はひどい痛手をうけた。", " is hit hard.");
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= RF3_EVIL;
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_EVIL);
 
     return PROCESS_CONTINUE;
 }
@@ -184,7 +185,7 @@ process_result effect_monster_plasma(player_type *caster_ptr, effect_monster_typ
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_PLAS);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_PLAS);
 
     return PROCESS_CONTINUE;
 }
@@ -198,7 +199,7 @@ static bool effect_monster_nether_resist(player_type *caster_ptr, effect_monster
         em_ptr->note = _("には完全な耐性がある！", " is immune.");
         em_ptr->dam = 0;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
     } else {
         em_ptr->note = _("には耐性がある。", " resists.");
         em_ptr->dam *= 3;
@@ -206,7 +207,7 @@ static bool effect_monster_nether_resist(player_type *caster_ptr, effect_monster
     }
 
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_NETH);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_NETH);
 
     return TRUE;
 }
@@ -222,7 +223,7 @@ process_result effect_monster_nether(player_type *caster_ptr, effect_monster_typ
     em_ptr->note = _("はいくらか耐性を示した。", " resists somewhat.");
     em_ptr->dam /= 2;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= (RF3_EVIL);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_EVIL);
 
     return PROCESS_CONTINUE;
 }
@@ -245,7 +246,7 @@ process_result effect_monster_water(player_type *caster_ptr, effect_monster_type
     }
 
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_WATE);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_WATE);
 
     return PROCESS_CONTINUE;
 }
@@ -260,13 +261,13 @@ process_result effect_monster_chaos(player_type *caster_ptr, effect_monster_type
         em_ptr->dam *= 3;
         em_ptr->dam /= randint1(6) + 6;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_RES_CHAO);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_CHAO);
     } else if ((em_ptr->r_ptr->flags3 & RF3_DEMON) && one_in_(3)) {
         em_ptr->note = _("はいくらか耐性を示した。", " resists somewhat.");
         em_ptr->dam *= 3;
         em_ptr->dam /= randint1(6) + 6;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flags3 |= (RF3_DEMON);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_DEMON);
     } else {
         em_ptr->do_polymorph = TRUE;
         em_ptr->do_conf = (5 + randint1(11) + em_ptr->r) / (em_ptr->r + 1);
@@ -287,7 +288,7 @@ process_result effect_monster_shards(player_type *caster_ptr, effect_monster_typ
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_SHAR);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_SHAR);
 
     return PROCESS_CONTINUE;
 }
@@ -303,7 +304,7 @@ process_result effect_monster_rocket(player_type *caster_ptr, effect_monster_typ
     em_ptr->note = _("はいくらか耐性を示した。", " resists somewhat.");
     em_ptr->dam /= 2;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_SHAR);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_SHAR);
 
     return PROCESS_CONTINUE;
 }
@@ -322,7 +323,7 @@ process_result effect_monster_sound(player_type *caster_ptr, effect_monster_type
     em_ptr->dam *= 2;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_SOUN);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_SOUN);
 
     return PROCESS_CONTINUE;
 }
@@ -341,7 +342,7 @@ process_result effect_monster_confusion(player_type *caster_ptr, effect_monster_
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= (RF3_NO_CONF);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 
     return PROCESS_CONTINUE;
 }
@@ -358,7 +359,7 @@ process_result effect_monster_disenchant(player_type *caster_ptr, effect_monster
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_DISE);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_DISE);
 
     return PROCESS_CONTINUE;
 }
@@ -375,7 +376,7 @@ process_result effect_monster_nexus(player_type *caster_ptr, effect_monster_type
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_NEXU);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_NEXU);
 
     return PROCESS_CONTINUE;
 }
@@ -394,7 +395,7 @@ process_result effect_monster_force(player_type *caster_ptr, effect_monster_type
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_WALL);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_WALL);
 
     return PROCESS_CONTINUE;
 }
@@ -410,7 +411,7 @@ process_result effect_monster_inertial(player_type *caster_ptr, effect_monster_t
         em_ptr->dam *= 3;
         em_ptr->dam /= randint1(6) + 6;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_RES_INER);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_INER);
 
         return PROCESS_CONTINUE;
     }
@@ -440,7 +441,7 @@ process_result effect_monster_time(player_type *caster_ptr, effect_monster_type
     em_ptr->dam *= 3;
     em_ptr->dam /= randint1(6) + 6;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_TIME);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_TIME);
 
     return PROCESS_CONTINUE;
 }
@@ -455,7 +456,7 @@ static bool effect_monster_gravity_resist_teleport(player_type *caster_ptr, effe
 
     if (em_ptr->r_ptr->flags1 & (RF1_UNIQUE)) {
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= RFR_RES_TELE;
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
         em_ptr->note = _("には効果がなかった。", " is unaffected!");
         return TRUE;
@@ -465,7 +466,7 @@ static bool effect_monster_gravity_resist_teleport(player_type *caster_ptr, effe
         return FALSE;
 
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= RFR_RES_TELE;
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
     em_ptr->note = _("には耐性がある！", " resists!");
     return TRUE;
@@ -506,7 +507,7 @@ process_result effect_monster_gravity(player_type *caster_ptr, effect_monster_ty
         em_ptr->dam /= randint1(6) + 6;
         em_ptr->do_dist = 0;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_RES_GRAV);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_GRAV);
 
         return PROCESS_CONTINUE;
     }
@@ -525,7 +526,7 @@ process_result effect_monster_disintegration(player_type *caster_ptr, effect_mon
         return PROCESS_CONTINUE;
 
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flags3 |= (RF3_HURT_ROCK);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_ROCK);
 
     em_ptr->note = _("の皮膚がただれた！", " loses some skin!");
     em_ptr->note_dies = _("は蒸発した！", " evaporates!");
@@ -543,12 +544,12 @@ process_result effect_monster_icee_bolt(player_type *caster_ptr, effect_monster_
         em_ptr->note = _("にはかなり耐性がある！", " resists a lot.");
         em_ptr->dam /= 9;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flagsr |= (RFR_IM_COLD);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_IM_COLD);
     } else if (em_ptr->r_ptr->flags3 & (RF3_HURT_COLD)) {
         em_ptr->note = _("はひどい痛手をうけた。", " is hit hard.");
         em_ptr->dam *= 2;
         if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-            em_ptr->r_ptr->r_flags3 |= (RF3_HURT_COLD);
+            lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_COLD);
     }
 
     return PROCESS_CONTINUE;
@@ -2,6 +2,7 @@
 #include "core/hp-mp-processor.h"
 #include "core/player-redraw-types.h"
 #include "effect/effect-monster-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/race-flags2.h"
@@ -77,7 +78,7 @@ process_result effect_monster_mind_blast(player_type *caster_ptr, effect_monster
 	{
 		if (em_ptr->r_ptr->flags3 & (RF3_NO_CONF))
 		{
-			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_NO_CONF);
+			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 		}
 
 		em_ptr->note = _("には効果がなかった。", " is unaffected.");
@@ -85,13 +86,13 @@ process_result effect_monster_mind_blast(player_type *caster_ptr, effect_monster
 	}
 	else if (em_ptr->r_ptr->flags2 & RF2_EMPTY_MIND)
 	{
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags2 |= (RF2_EMPTY_MIND);
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_EMPTY_MIND);
 		em_ptr->note = _("には完全な耐性がある！", " is immune.");
 		em_ptr->dam = 0;
 	}
 	else if (em_ptr->r_ptr->flags2 & RF2_WEIRD_MIND)
 	{
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags2 |= (RF2_WEIRD_MIND);
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_WEIRD_MIND);
 		em_ptr->note = _("には耐性がある。", " resists.");
 		em_ptr->dam /= 3;
 	}
@@ -120,7 +121,7 @@ process_result effect_monster_brain_smash(player_type *caster_ptr, effect_monste
 		if (em_ptr->r_ptr->flags3 & (RF3_NO_CONF))
 		{
 			if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-				em_ptr->r_ptr->r_flags3 |= (RF3_NO_CONF);
+				lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 		}
 
 		em_ptr->note = _("には効果がなかった。", " is unaffected.");
@@ -129,7 +130,7 @@ process_result effect_monster_brain_smash(player_type *caster_ptr, effect_monste
 	else if (em_ptr->r_ptr->flags2 & RF2_EMPTY_MIND)
 	{
 		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-			em_ptr->r_ptr->r_flags2 |= (RF2_EMPTY_MIND);
+			lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_EMPTY_MIND);
 
 		em_ptr->note = _("には完全な耐性がある！", " is immune.");
 		em_ptr->dam = 0;
@@ -137,7 +138,7 @@ process_result effect_monster_brain_smash(player_type *caster_ptr, effect_monste
 	else if (em_ptr->r_ptr->flags2 & RF2_WEIRD_MIND)
 	{
 		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-			em_ptr->r_ptr->r_flags2 |= (RF2_WEIRD_MIND);
+			lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_WEIRD_MIND);
 
 		em_ptr->note = _("には耐性がある！", " resists!");
 		em_ptr->dam /= 3;
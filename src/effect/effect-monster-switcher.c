@@ -17,6 +17,7 @@
 #include "effect/effect-monster-resist-hurt.h"
 #include "effect/effect-monster-spirit.h"
 #include "effect/effect-monster-util.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/race-flags2.h"
@@ -44,9 +45,9 @@ process_result effect_monster_hypodynamia(player_type *caster_ptr, effect_monste
 
 	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
 	{
-		if (em_ptr->r_ptr->flags3 & RF3_DEMON) em_ptr->r_ptr->r_flags3 |= (RF3_DEMON);
-		if (em_ptr->r_ptr->flags3 & RF3_UNDEAD) em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
-		if (em_ptr->r_ptr->flags3 & RF3_NONLIVING) em_ptr->r_ptr->r_flags3 |= (RF3_NONLIVING);
+		if (em_ptr->r_ptr->flags3 & RF3_DEMON) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_DEMON);
+		if (em_ptr->r_ptr->flags3 & RF3_UNDEAD) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
+		if (em_ptr->r_ptr->flags3 & RF3_NONLIVING) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NONLIVING);
 	}
 
 	em_ptr->note = _("には効果がなかった。", " is unaffected.");
@@ -65,9 +66,9 @@ process_result effect_monster_death_ray(player_type *caster_ptr, effect_monster_
 	{
 		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
 		{
-			if (em_ptr->r_ptr->flags3 & RF3_DEMON) em_ptr->r_ptr->r_flags3 |= (RF3_DEMON);
-			if (em_ptr->r_ptr->flags3 & RF3_UNDEAD) em_ptr->r_ptr->r_flags3 |= (RF3_UNDEAD);
-			if (em_ptr->r_ptr->flags3 & RF3_NONLIVING) em_ptr->r_ptr->r_flags3 |= (RF3_NONLIVING);
+			if (em_ptr->r_ptr->flags3 & RF3_DEMON) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_DEMON);
+			if (em_ptr->r_ptr->flags3 & RF3_UNDEAD) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
+			if (em_ptr->r_ptr->flags3 & RF3_NONLIVING) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NONLIVING);
 		}
 
 		em_ptr->note = _("には完全な耐性がある！", " is immune.");
@@ -100,7 +101,7 @@ process_result effect_monster_kill_wall(player_type *caster_ptr, effect_monster_
 
 	if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_HURT_ROCK);
+	if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_ROCK);
 
 	em_ptr->note = _("の皮膚がただれた！", " loses some skin!");
 	em_ptr->note_dies = _("はドロドロに溶けた！", " dissolves!");
@@ -147,7 +148,7 @@ process_result effect_monster_engetsu(player_type *caster_ptr, effect_monster_ty
 		em_ptr->note = _("には効果がなかった。", " is unaffected.");
 		em_ptr->dam = 0;
 		em_ptr->skipped = TRUE;
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags2 |= (RF2_EMPTY_MIND);
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS2, RF2_EMPTY_MIND);
 		return PROCESS_CONTINUE;
 	}
 
@@ -199,7 +200,7 @@ process_result effect_monster_engetsu(player_type *caster_ptr, effect_monster_ty
 		{
 			if (em_ptr->r_ptr->flags3 & RF3_NO_SLEEP)
 			{
-				if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_NO_SLEEP);
+				if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_NO_SLEEP);
 			}
 
 			em_ptr->note = _("には効果がなかった。", " is unaffected.");
@@ -247,7 +248,7 @@ process_result effect_monster_photo(player_type *caster_ptr, effect_monster_type
 	{
 		if (em_ptr->seen) em_ptr->obvious = TRUE;
 
-		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) em_ptr->r_ptr->r_flags3 |= (RF3_HURT_LITE);
+		if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr)) lore_race_flags(em_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_LITE);
 
 		em_ptr->note = _("は光に身をすくめた！", " cringes from the light!");
 		em_ptr->note_dies = _("は光を受けてしぼんでしまった！", " shrivels away in the light!");
@@ -15,6 +15,7 @@
 #include "floor/floor-object.h"
 #include "game-option/play-record-options.h"
 #include "io/write-diary.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "monster-floor/monster-death.h"
@@ -99,7 +100,7 @@ static process_result process_monster_perfect_resistance(player_type *caster_ptr
     em_ptr->note = _("には完全な耐性がある！", " is immune.");
     em_ptr->dam = 0;
     if (is_original_ap_and_seen(caster_ptr, em_ptr->m_ptr))
-        em_ptr->r_ptr->r_flagsr |= (RFR_RES_ALL);
+        lore_race_flags(em_ptr->r_ptr, LORE_FLAGSR, RFR_RES_ALL);
 
     if (em_ptr->effect_type == GF_LITE_WEAK || em_ptr->effect_type == GF_KILL_WALL)
         em_ptr->skipped = TRUE;
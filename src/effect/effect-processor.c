@@ -12,6 +12,7 @@
 #include "grid/feature-flag-types.h"
 #include "io/cursor.h"
 #include "io/screen-util.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "monster-race/monster-race.h"
@@ -586,6 +587,7 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
         project_m_x = 0;
         project_m_y = 0;
         dist = 0;
+        msg_batch_begin();
         for (int i = 0; i < grids; i++) {
             int effective_dist;
             if (gm[dist + 1] == i)
@@ -623,7 +625,7 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
                     }
 
                     if (is_original_ap_and_seen(caster_ptr, m_ptr))
-                        ref_ptr->r_flags2 |= RF2_REFLECTING;
+                        lore_race_flags(ref_ptr, LORE_FLAGS2, RF2_REFLECTING);
 
                     if (player_bold(caster_ptr, y, x) || one_in_(2))
                         flag &= ~(PROJECT_PLAYER);
@@ -701,6 +703,8 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
                 notice = TRUE;
         }
 
+        msg_batch_end();
+
         /* Player affected one monster (without "jumping") */
         if (!who && (project_m_n == 1) && !jump) {
             x = project_m_x;
@@ -0,0 +1,201 @@
+﻿/*!
+ * @brief アイテム表記のキャッシュ / Cache of object descriptions
+ * @date 2026/10/19
+ * @details
+ * describe_flavor() の結果を、表記に関わるアイテムのフィールドと表記オプションの組で覚えておく。
+ * 鑑定・強化・充填・銘の変化はそれらのフィールドを照合して検出する。
+ * ベースアイテムの鑑定、表示オプション、プレーヤーの能力値のように
+ * アイテムの外で変わるものは reset_flavor_cache() で世代を進めてまとめて捨てる。
+ */
+
+#include "flavor/flavor-cache.h"
+#include "inventory/inventory-slot-types.h"
+#include "object/tval-types.h"
+#include "player-info/base-status-types.h"
+#include "player/player-classes-types.h"
+#include "player/player-status.h"
+#include "specific-object/bow.h"
+#include "system/floor-type-definition.h"
+#include "system/object-type-definition.h"
+#include "util/string-processor.h"
+
+#define FLAVOR_CACHE_SIZE 512 /*!< キャッシュする表記の数 */
+
+/*!
+ * @brief キャッシュした表記 / A cached description
+ */
+typedef struct flavor_cache_entry {
+    u32b stamp; /*!< 表記を作った時の世代 (0なら空き) */
+    flavor_cache_key key; /*!< 表記を作った時の照合値 */
+    GAME_TEXT name[MAX_NLEN]; /*!< アイテムの表記 */
+} flavor_cache_entry;
+
+bool use_flavor_cache = TRUE; /*!< キャッシュを使うか (性能計測用) */
+flavor_cache_stats_type flavor_cache_stats; /*!< キャッシュの統計 */
+
+static u32b flavor_cache_stamp = 1; /*!< キャッシュの世代 */
+static flavor_cache_entry flavor_cache[FLAVOR_CACHE_SIZE]; /*!< キャッシュ本体 */
+
+/*!
+ * @brief 照合に使う値を加える / Append a value to the key
+ * @param key_ptr 照合値への参照ポインタ
+ * @param value 加える値
+ * @return なし
+ */
+static void add_flavor_key(flavor_cache_key *key_ptr, s32b value)
+{
+    if (key_ptr->num < FLAVOR_CACHE_KEY_MAX)
+        key_ptr->values[key_ptr->num++] = value;
+}
+
+/*!
+ * @brief 表記に関わるアイテムのフィールドを加える / Append the fields of an object the description depends on
+ * @param key_ptr 照合値への参照ポインタ
+ * @param o_ptr アイテムへの参照ポインタ
+ * @return なし
+ * @details 置き場所や重なり、自動拾いのキャッシュのように表記に現れないフィールドは除く。
+ */
+static void add_flavor_key_object(flavor_cache_key *key_ptr, object_type *o_ptr)
+{
+    add_flavor_key(key_ptr, o_ptr->k_idx);
+    add_flavor_key(key_ptr, o_ptr->pval);
+    add_flavor_key(key_ptr, o_ptr->discount);
+    add_flavor_key(key_ptr, o_ptr->number);
+    add_flavor_key(key_ptr, o_ptr->weight);
+    add_flavor_key(key_ptr, o_ptr->name1);
+    add_flavor_key(key_ptr, o_ptr->name2);
+    add_flavor_key(key_ptr, o_ptr->xtra3);
+    add_flavor_key(key_ptr, o_ptr->xtra4);
+    add_flavor_key(key_ptr, o_ptr->xtra5);
+    add_flavor_key(key_ptr, o_ptr->to_h);
+    add_flavor_key(key_ptr, o_ptr->to_d);
+    add_flavor_key(key_ptr, o_ptr->to_a);
+    add_flavor_key(key_ptr, o_ptr->ac);
+    add_flavor_key(key_ptr, o_ptr->dd);
+    add_flavor_key(key_ptr, o_ptr->ds);
+    add_flavor_key(key_ptr, o_ptr->timeout);
+    add_flavor_key(key_ptr, o_ptr->ident);
+    add_flavor_key(key_ptr, o_ptr->feeling);
+    add_flavor_key(key_ptr, o_ptr->inscription);
+    add_flavor_key(key_ptr, o_ptr->art_name);
+    for (int i = 0; i < TR_FLAG_SIZE; i++)
+        add_flavor_key(key_ptr, (s32b)o_ptr->art_flags[i]);
+
+    add_flavor_key(key_ptr, (s32b)o_ptr->curse_flags);
+}
+
+/*!
+ * @brief 表記に関わるアイテムの外の状態を加える / Append the state outside the object the description depends on
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param key_ptr 照合値への参照ポインタ
+ * @param o_ptr アイテムへの参照ポインタ
+ * @return なし
+ * @details
+ * クエストの対象かどうかと、弾・スパイクの威力表示に使う射撃武器とプレーヤーの能力だけを見る。
+ * 集中度や射撃の熟練度は PU_BONUS を伴わずに変わることがあるので、ここで照合する。
+ */
+static void add_flavor_key_context(player_type *player_ptr, flavor_cache_key *key_ptr, object_type *o_ptr)
+{
+    add_flavor_key(key_ptr, player_ptr->current_floor_ptr->inside_quest);
+    object_type *bow_ptr = &player_ptr->inventory_list[INVEN_BOW];
+    bool ammo = (bow_ptr->k_idx != 0) && (o_ptr->tval == bow_tval_ammo(bow_ptr));
+    if (!ammo && ((player_ptr->pclass != CLASS_NINJA) || (o_ptr->tval != TV_SPIKE)))
+        return;
+
+    if (ammo) {
+        add_flavor_key(key_ptr, bow_ptr->sval);
+        add_flavor_key(key_ptr, bow_ptr->to_h);
+        add_flavor_key(key_ptr, bow_ptr->to_d);
+        add_flavor_key(key_ptr, bow_ptr->ident);
+        add_flavor_key(key_ptr, player_ptr->weapon_exp[0][bow_ptr->sval]);
+        add_flavor_key(key_ptr, player_ptr->skill_thb);
+        add_flavor_key(key_ptr, player_ptr->to_h_b);
+    }
+
+    add_flavor_key(key_ptr, player_ptr->num_fire);
+    add_flavor_key(key_ptr, player_ptr->xtra_might);
+    add_flavor_key(key_ptr, player_ptr->stat_ind[A_STR]);
+    add_flavor_key(key_ptr, player_ptr->concent);
+    add_flavor_key(key_ptr, player_ptr->lev);
+    add_flavor_key(key_ptr, player_ptr->mighty_throw);
+}
+
+/*!
+ * @brief 照合値からキャッシュの置き場所を決める / Get the slot of a key
+ * @param key_ptr 照合値への参照ポインタ
+ * @return キャッシュの添字
+ */
+static int get_flavor_cache_slot(flavor_cache_key *key_ptr)
+{
+    u32b hash = 2166136261UL;
+    for (int i = 0; i < key_ptr->num; i++) {
+        hash ^= (u32b)key_ptr->values[i];
+        hash *= 16777619UL;
+    }
+
+    return hash % FLAVOR_CACHE_SIZE;
+}
+
+/*!
+ * @brief キャッシュの世代を進めて全ての表記を捨てる / Invalidate all cached descriptions
+ * @return なし
+ * @details ベースアイテムの鑑定、表示オプション、プレーヤーの状態が変わった時に呼ぶ。
+ */
+void reset_flavor_cache(void)
+{
+    flavor_cache_stamp++;
+    if (flavor_cache_stamp == 0)
+        flavor_cache_stamp = 1;
+
+    flavor_cache_stats.reset++;
+}
+
+/*!
+ * @brief キャッシュから表記を探す / Look up a cached description
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param o_ptr アイテムへの参照ポインタ
+ * @param mode 表記に関するオプション指定
+ * @param buf 見つかった時に表記を返すための文字列参照ポインタ
+ * @param key_ptr 見つからなかった時に save_flavor_cache() へ渡す照合値を返す
+ * @return 見つかったらTRUE
+ */
+bool load_flavor_cache(player_type *player_ptr, object_type *o_ptr, BIT_FLAGS mode, char *buf, flavor_cache_key *key_ptr)
+{
+    if (!use_flavor_cache)
+        return FALSE;
+
+    key_ptr->num = 0;
+    add_flavor_key(key_ptr, (s32b)mode);
+    add_flavor_key_object(key_ptr, o_ptr);
+    add_flavor_key_context(player_ptr, key_ptr, o_ptr);
+    flavor_cache_entry *entry = &flavor_cache[get_flavor_cache_slot(key_ptr)];
+    if ((entry->stamp != flavor_cache_stamp) || (entry->key.num != key_ptr->num)
+        || memcmp(entry->key.values, key_ptr->values, sizeof(s32b) * key_ptr->num)) {
+        flavor_cache_stats.miss++;
+        return FALSE;
+    }
+
+    flavor_cache_stats.hit++;
+    angband_strcpy(buf, entry->name, MAX_NLEN);
+    return TRUE;
+}
+
+/*!
+ * @brief 作った表記をキャッシュに入れる / Store a freshly built description
+ * @param key_ptr load_flavor_cache() が返した照合値
+ * @param buf アイテムの表記
+ * @return なし
+ */
+void save_flavor_cache(flavor_cache_key *key_ptr, concptr buf)
+{
+    if (!use_flavor_cache)
+        return;
+
+    flavor_cache_entry *entry = &flavor_cache[get_flavor_cache_slot(key_ptr)];
+    if (entry->stamp == flavor_cache_stamp)
+        flavor_cache_stats.evict++;
+
+    entry->stamp = flavor_cache_stamp;
+    entry->key = *key_ptr;
+    angband_strcpy(entry->name, buf, MAX_NLEN);
+}
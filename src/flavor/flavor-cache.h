@@ -0,0 +1,31 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+#define FLAVOR_CACHE_KEY_MAX 48 /*!< 照合に使う値の最大数 */
+
+/*!
+ * @brief アイテム表記のキャッシュの照合に使う値 / Key of a cached object description
+ * @details 表記に関わるアイテムのフィールドとプレーヤー・フロアの状態、表記オプションをそのまま並べる。
+ */
+typedef struct flavor_cache_key {
+    int num; /*!< 並べた値の数 */
+    s32b values[FLAVOR_CACHE_KEY_MAX]; /*!< 照合に使う値 */
+} flavor_cache_key;
+
+/*!
+ * @brief アイテム表記のキャッシュの統計 / Statistics of the description cache
+ */
+typedef struct flavor_cache_stats_type {
+    u32b hit; /*!< キャッシュから返した回数 */
+    u32b miss; /*!< 表記を作り直した回数 */
+    u32b evict; /*!< 別のアイテムの表記を追い出した回数 */
+    u32b reset; /*!< キャッシュ全体を捨てた回数 */
+} flavor_cache_stats_type;
+
+extern bool use_flavor_cache;
+extern flavor_cache_stats_type flavor_cache_stats;
+
+void reset_flavor_cache(void);
+bool load_flavor_cache(player_type *player_ptr, object_type *o_ptr, BIT_FLAGS mode, char *buf, flavor_cache_key *key_ptr);
+void save_flavor_cache(flavor_cache_key *key_ptr, concptr buf);
@@ -8,6 +8,7 @@
 #include "cmd-item/cmd-smith.h"
 #include "combat/shoot.h"
 #include "flavor/flag-inscriptions-table.h"
+#include "flavor/flavor-cache.h"
 #include "flavor/flavor-util.h"
 #include "flavor/named-item-describer.h"
 #include "flavor/object-flavor-types.h"
@@ -466,14 +467,14 @@ static void decide_item_feeling(flavor_type *flavor_ptr)
 }
 
 /*!
- * @brief オブジェクトの各表記を返すメイン関数 / Creates a description of the item "o_ptr", and stores it in "out_val".
+ * @brief キャッシュを使わずにオブジェクトの表記を作る / Build the description of the item "o_ptr" from scratch
  * @param player_ptr プレーヤーへの参照ポインタ
  * @param buf 表記を返すための文字列参照ポインタ
  * @param o_ptr 特性短縮表記を得たいオブジェクト構造体の参照ポインタ
  * @param mode 表記に関するオプション指定
- * @return 現在クエスト達成目的のアイテムならばTRUEを返す
+ * @return なし
  */
-void describe_flavor(player_type *player_ptr, char *buf, object_type *o_ptr, BIT_FLAGS mode)
+static void describe_flavor_aux(player_type *player_ptr, char *buf, object_type *o_ptr, BIT_FLAGS mode)
 {
     flavor_type tmp_flavor;
     flavor_type *flavor_ptr = initialize_flavor_type(&tmp_flavor, buf, o_ptr, mode);
@@ -511,3 +512,22 @@ void describe_flavor(player_type *player_ptr, char *buf, object_type *o_ptr, BIT
     display_item_fake_inscription(flavor_ptr);
     angband_strcpy(flavor_ptr->buf, flavor_ptr->tmp_val, MAX_NLEN);
 }
+
+/*!
+ * @brief オブジェクトの各表記を返すメイン関数 / Creates a description of the item "o_ptr", and stores it in "out_val".
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param buf 表記を返すための文字列参照ポインタ
+ * @param o_ptr 特性短縮表記を得たいオブジェクト構造体の参照ポインタ
+ * @param mode 表記に関するオプション指定
+ * @return なし
+ * @details 同じ状態のアイテムを同じ指定で表記し直す時は、キャッシュした表記を返す。
+ */
+void describe_flavor(player_type *player_ptr, char *buf, object_type *o_ptr, BIT_FLAGS mode)
+{
+    flavor_cache_key key;
+    if (load_flavor_cache(player_ptr, o_ptr, mode, buf, &key))
+        return;
+
+    describe_flavor_aux(player_ptr, buf, o_ptr, mode);
+    save_flavor_cache(&key, buf);
+}
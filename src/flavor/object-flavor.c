@@ -12,6 +12,7 @@
 #include "flavor/object-flavor.h"
 #include "cmd-item/cmd-smith.h"
 #include "flavor/flag-inscriptions-table.h"
+#include "flavor/flavor-cache.h"
 #include "flavor/flavor-util.h"
 #include "flavor/object-flavor-types.h"
 #include "game-option/text-display-options.h"
@@ -260,6 +261,8 @@ void flavor_init(void)
 
         k_ptr->easy_know = object_easy_know(i);
     }
+
+    reset_flavor_cache();
 }
 
 /*!
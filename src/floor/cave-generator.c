@@ -5,6 +5,7 @@
 #include "floor/dungeon-tunnel-util.h"
 #include "floor/floor-allocation-types.h"
 #include "floor/floor-streams.h"
+#include "floor/generation-profiler.h"
 #include "floor/geometry.h"
 #include "floor/object-allocator.h"
 #include "floor/tunnel-generator.h"
@@ -176,24 +177,38 @@ static void make_doors(player_type *player_ptr, dun_data_type *dd_ptr, dt_type *
 
 static bool make_one_floor(player_type *player_ptr, dun_data_type *dd_ptr, dungeon_type *d_ptr)
 {
-    if (!generate_rooms(player_ptr, dd_ptr)) {
+    double start = begin_gen_stage();
+    bool is_generated = generate_rooms(player_ptr, dd_ptr);
+    if (is_generated)
+        place_cave_contents(player_ptr, dd_ptr, d_ptr);
+
+    end_gen_stage(GEN_STAGE_ROOMS, start);
+    if (!is_generated) {
         *dd_ptr->why = _("部屋群の生成に失敗", "Failed to generate rooms");
         return FALSE;
     }
 
-    place_cave_contents(player_ptr, dd_ptr, d_ptr);
     dt_type tmp_dt;
     dt_type *dt_ptr = initialize_dt_type(&tmp_dt);
-    if (!make_centers(player_ptr, dd_ptr, d_ptr, dt_ptr))
+    start = begin_gen_stage();
+    is_generated = make_centers(player_ptr, dd_ptr, d_ptr, dt_ptr);
+    if (is_generated)
+        make_doors(player_ptr, dd_ptr, dt_ptr);
+
+    end_gen_stage(GEN_STAGE_TUNNELS, start);
+    if (!is_generated)
         return FALSE;
 
-    make_doors(player_ptr, dd_ptr, dt_ptr);
-    if (!alloc_stairs(player_ptr, feat_down_stair, rand_range(3, 4), 3)) {
+    start = begin_gen_stage();
+    bool is_down_allocated = alloc_stairs(player_ptr, feat_down_stair, rand_range(3, 4), 3);
+    bool is_up_allocated = is_down_allocated && alloc_stairs(player_ptr, feat_up_stair, rand_range(1, 2), 3);
+    end_gen_stage(GEN_STAGE_STAIRS, start);
+    if (!is_down_allocated) {
         *dd_ptr->why = _("下り階段生成に失敗", "Failed to generate down stairs.");
         return FALSE;
     }
 
-    if (!alloc_stairs(player_ptr, feat_up_stair, rand_range(1, 2), 3)) {
+    if (!is_up_allocated) {
         *dd_ptr->why = _("上り階段生成に失敗", "Failed to generate up stairs.");
         return FALSE;
     }
@@ -205,13 +220,19 @@ static bool switch_making_floor(player_type *player_ptr, dun_data_type *dd_ptr,
 {
     if (d_ptr->flags1 & DF1_MAZE) {
         floor_type *floor_ptr = player_ptr->current_floor_ptr;
+        double start = begin_gen_stage();
         build_maze_vault(player_ptr, floor_ptr->width / 2 - 1, floor_ptr->height / 2 - 1, floor_ptr->width - 4, floor_ptr->height - 4, FALSE);
-        if (!alloc_stairs(player_ptr, feat_down_stair, rand_range(2, 3), 3)) {
+        end_gen_stage(GEN_STAGE_ROOMS, start);
+        start = begin_gen_stage();
+        bool is_down_allocated = alloc_stairs(player_ptr, feat_down_stair, rand_range(2, 3), 3);
+        bool is_up_allocated = is_down_allocated && alloc_stairs(player_ptr, feat_up_stair, 1, 3);
+        end_gen_stage(GEN_STAGE_STAIRS, start);
+        if (!is_down_allocated) {
             *dd_ptr->why = _("迷宮ダンジョンの下り階段生成に失敗", "Failed to alloc up stairs in maze dungeon.");
             return FALSE;
         }
 
-        if (!alloc_stairs(player_ptr, feat_up_stair, 1, 3)) {
+        if (!is_up_allocated) {
             *dd_ptr->why = _("迷宮ダンジョンの上り階段生成に失敗", "Failed to alloc down stairs in maze dungeon.");
             return FALSE;
         }
@@ -295,10 +316,13 @@ static void decide_dungeon_data_allocation(player_type *player_ptr, dun_data_typ
 
 static bool allocate_dungeon_data(player_type *player_ptr, dun_data_type *dd_ptr, dungeon_type *d_ptr)
 {
+    double start = begin_gen_stage();
     dd_ptr->alloc_monster_num += randint1(8);
     for (dd_ptr->alloc_monster_num = dd_ptr->alloc_monster_num + dd_ptr->alloc_object_num; dd_ptr->alloc_monster_num > 0; dd_ptr->alloc_monster_num--)
         (void)alloc_monster(player_ptr, 0, PM_ALLOW_SLEEP, summon_specific);
 
+    end_gen_stage(GEN_STAGE_MONSTERS, start);
+    start = begin_gen_stage();
     alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_TRAP, randint1(dd_ptr->alloc_object_num));
     if (!(d_ptr->flags1 & DF1_NO_CAVE))
         alloc_object(player_ptr, ALLOC_SET_CORR, ALLOC_TYP_RUBBLE, randint1(dd_ptr->alloc_object_num));
@@ -311,7 +335,11 @@ static bool allocate_dungeon_data(player_type *player_ptr, dun_data_type *dd_ptr
     alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_OBJECT, randnor(DUN_AMT_ITEM, 3));
     alloc_object(player_ptr, ALLOC_SET_BOTH, ALLOC_TYP_GOLD, randnor(DUN_AMT_GOLD, 3));
     floor_ptr->object_level = floor_ptr->base_level;
-    if (alloc_guardian(player_ptr, TRUE))
+    end_gen_stage(GEN_STAGE_OBJECTS, start);
+    start = begin_gen_stage();
+    bool is_guardian_allocated = alloc_guardian(player_ptr, TRUE);
+    end_gen_stage(GEN_STAGE_MONSTERS, start);
+    if (is_guardian_allocated)
         return TRUE;
 
     *dd_ptr->why = _("ダンジョンの主配置に失敗", "Failed to place a dungeon guardian");
@@ -360,14 +388,21 @@ bool cave_gen(player_type *player_ptr, concptr *why)
         msg_print_wizard(player_ptr, CHEAT_DUNGEON, _("アリーナレベルを生成。", "Arena level."));
     }
 
+    double start = begin_gen_stage();
     check_arena_floor(player_ptr, dd_ptr);
     gen_caverns_and_lakes(player_ptr, d_ptr, dd_ptr);
+    end_gen_stage(GEN_STAGE_LAYOUT, start);
     if (!switch_making_floor(player_ptr, dd_ptr, d_ptr))
         return FALSE;
 
+    start = begin_gen_stage();
     make_aqua_streams(player_ptr, dd_ptr, d_ptr);
+    end_gen_stage(GEN_STAGE_STREAMERS, start);
+    start = begin_gen_stage();
     make_perm_walls(player_ptr);
-    if (!check_place_necessary_objects(player_ptr, dd_ptr))
+    bool is_placed = check_place_necessary_objects(player_ptr, dd_ptr);
+    end_gen_stage(GEN_STAGE_PLAYER, start);
+    if (!is_placed)
         return FALSE;
 
     decide_dungeon_data_allocation(player_ptr, dd_ptr, d_ptr);
@@ -375,5 +410,6 @@ bool cave_gen(player_type *player_ptr, concptr *why)
         return FALSE;
 
     decide_grid_glowing(floor_ptr, dd_ptr, d_ptr);
+    generation_profile.room_num = dd_ptr->cent_n;
     return TRUE;
 }
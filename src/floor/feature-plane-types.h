@@ -0,0 +1,14 @@
+﻿#pragma once
+
+/*!
+ * @brief 地形フラグのビット平面の種別 / Planes of the feature flag bitplanes
+ */
+typedef enum feat_plane_type {
+    FEAT_PLANE_TRAP = 0, /*!< トラップ / FF_TRAP */
+    FEAT_PLANE_DOOR = 1, /*!< ドア / FF_DOOR */
+    FEAT_PLANE_STAIRS = 2, /*!< 階段 / FF_STAIRS */
+    FEAT_PLANE_HAS_GOLD = 3, /*!< 財宝を含む鉱脈 / FF_HAS_GOLD */
+    MAX_FEAT_PLANE = 4,
+} feat_plane_type;
+
+#define FEAT_PLANE_WORDS ((MAX_WID + 31) / 32) /*!< ビット平面の1行あたりの語数 */
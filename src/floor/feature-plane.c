@@ -0,0 +1,104 @@
+﻿/*!
+ * @brief 地形フラグのビット平面 / Bitplanes of frequently queried feature flags
+ * @date 2026/10/19
+ * @details
+ * トラップ・ドア・階段・財宝の鉱脈を1グリッド1ビットで持ち、感知がフロア全体を走査せずに
+ * 範囲内の該当グリッドだけを拾えるようにする。
+ * cave_set_feat() による地形変化はその場で反映し、生成や一括変化の後は invalidate_feat_planes() で
+ * 作り直させる (テレポート先索引と同じ扱い)。
+ */
+
+#include "floor/feature-plane.h"
+#include "grid/feature.h"
+#include "grid/grid.h"
+#include "system/floor-type-definition.h"
+#include "util/bit-flags-calculator.h"
+
+/*!
+ * @brief ビット平面に対応する地形フラグ / Feature flag of each plane
+ */
+static const feature_flag_type feat_plane_flags[MAX_FEAT_PLANE] = {
+    FF_TRAP,
+    FF_DOOR,
+    FF_STAIRS,
+    FF_HAS_GOLD,
+};
+
+/*!
+ * @brief 1グリッドのビットを地形に合わせる
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y Y座標
+ * @param x X座標
+ * @return なし
+ */
+static void set_feat_plane_bits(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    feature_type *f_ptr = &f_info[floor_ptr->grid_array[y][x].feat];
+    u32b bit = 1UL << (x % 32);
+    for (int plane = 0; plane < MAX_FEAT_PLANE; plane++) {
+        u32b *word = &floor_ptr->feat_plane[plane][y][x / 32];
+        if (has_flag(f_ptr->flags, feat_plane_flags[plane]))
+            *word |= bit;
+        else
+            *word &= ~bit;
+    }
+}
+
+/*!
+ * @brief 現在の地形からビット平面を作り直す
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ */
+static void build_feat_planes(floor_type *floor_ptr)
+{
+    for (int plane = 0; plane < MAX_FEAT_PLANE; plane++)
+        for (POSITION y = 0; y < MAX_HGT; y++)
+            for (int i = 0; i < FEAT_PLANE_WORDS; i++)
+                floor_ptr->feat_plane[plane][y][i] = 0;
+
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        for (POSITION x = 0; x < floor_ptr->width; x++)
+            set_feat_plane_bits(floor_ptr, y, x);
+
+    floor_ptr->feat_plane_ready = TRUE;
+}
+
+/*!
+ * @brief ビット平面を破棄し、次の参照時に作り直させる / Forget the bitplanes so that they are rebuilt on demand
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ * @details フロアの生成や一括した地形変化の後に呼ぶ。
+ */
+void invalidate_feat_planes(floor_type *floor_ptr) { floor_ptr->feat_plane_ready = FALSE; }
+
+/*!
+ * @brief 1グリッドの地形変化をビット平面に反映する / Reflect a terrain change of a grid into the bitplanes
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y Y座標
+ * @param x X座標
+ * @return なし
+ */
+void update_feat_planes(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    if (!floor_ptr->feat_plane_ready)
+        return;
+    if ((y < 0) || (y >= floor_ptr->height) || (x < 0) || (x >= floor_ptr->width))
+        return;
+
+    set_feat_plane_bits(floor_ptr, y, x);
+}
+
+/*!
+ * @brief ビット平面の1行を返す / Get a row of a bitplane
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param plane ビット平面の種別
+ * @param y Y座標
+ * @return X座標 x のビットが (x / 32) 語目の (x % 32) ビット目にある配列
+ */
+u32b *get_feat_plane_row(floor_type *floor_ptr, feat_plane_type plane, POSITION y)
+{
+    if (!floor_ptr->feat_plane_ready)
+        build_feat_planes(floor_ptr);
+
+    return floor_ptr->feat_plane[plane][y];
+}
@@ -0,0 +1,11 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "floor/floor-base-definitions.h"
+#include "floor/feature-plane-types.h"
+
+typedef struct floor_type floor_type;
+
+void invalidate_feat_planes(floor_type *floor_ptr);
+void update_feat_planes(floor_type *floor_ptr, POSITION y, POSITION x);
+u32b *get_feat_plane_row(floor_type *floor_ptr, feat_plane_type plane, POSITION y);
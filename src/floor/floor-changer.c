@@ -4,6 +4,7 @@
 #include "dungeon/quest-monster-placer.h"
 #include "dungeon/quest.h"
 #include "effect/effect-characteristics.h"
+#include "floor/feature-plane.h"
 #include "floor/floor-generator.h"
 #include "floor/floor-mode-changer.h"
 #include "floor/floor-object.h"
@@ -35,12 +36,14 @@
 #include "monster/monster-update.h"
 #include "object-hook/hook-checker.h"
 #include "object-hook/hook-enchant.h"
+#include "pet/pet-registry.h"
 #include "spell-kind/spells-floor.h"
 #include "system/artifact-type-definition.h"
 #include "system/floor-type-definition.h"
 #include "system/object-type-definition.h"
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
+#include "window/overhead-map.h"
 #include "world/world.h"
 
 /*!
@@ -153,6 +156,7 @@ static void place_pet(player_type *master_ptr)
     }
 
     (void)C_WIPE(party_mon, MAX_PARTY_MON, monster_type);
+    invalidate_pet_registry(master_ptr->current_floor_ptr);
 }
 
 /*!
@@ -203,6 +207,7 @@ static void check_visited_floor(player_type *creature_ptr, saved_floor_type *sf_
     if (creature_ptr->change_floor_mode & (CFM_DOWN | CFM_UP))
         g_ptr->feat = feat_ground_type[randint0(100)];
 
+    update_feat_planes(creature_ptr->current_floor_ptr, creature_ptr->y, creature_ptr->x);
     g_ptr->special = 0;
 }
 
@@ -321,6 +326,7 @@ static void update_new_floor_feature(player_type *creature_ptr, saved_floor_type
         g_ptr->feat = (creature_ptr->change_floor_mode & CFM_SHAFT) ? feat_state(creature_ptr, feat_up_stair, FF_SHAFT) : feat_up_stair;
 
     g_ptr->mimic = 0;
+    update_feat_planes(creature_ptr->current_floor_ptr, creature_ptr->y, creature_ptr->x);
     g_ptr->special = creature_ptr->floor_id;
 }
 
@@ -380,6 +386,7 @@ void change_floor(player_type *creature_ptr)
     panel_col_max = 0;
     creature_ptr->ambush_flag = FALSE;
     update_floor(creature_ptr);
+    invalidate_overhead_map();
     place_pet(creature_ptr);
     forget_travel_flow(creature_ptr->current_floor_ptr);
     update_unique_artifact(creature_ptr->current_floor_ptr, new_floor_id);
@@ -10,13 +10,17 @@
  */
 
 #include "floor/floor-generator.h"
+#include "core/turn-profiler.h"
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
 #include "floor/cave-generator.h"
+#include "floor/feature-plane.h"
 #include "floor/floor-events.h"
 #include "floor/floor-save.h" // todo precalc_cur_num_of_pet() が依存している、違和感.
 #include "floor/floor-util.h"
+#include "floor/generation-profiler.h"
+#include "floor/teleport-index.h"
 #include "floor/wild.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-types.h"
@@ -37,9 +41,11 @@
 #include "monster/monster-status.h"
 #include "monster/monster-update.h"
 #include "monster/monster-util.h"
+#include "pet/pet-registry.h"
 #include "system/building-type-definition.h"
 #include "system/floor-type-definition.h"
 #include "system/system-variables.h"
+#include "target/projection-path-calculator.h"
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
 #include "wizard/wizard-messages.h"
@@ -216,7 +222,7 @@ static void generate_gambling_arena(player_type *creature_ptr)
     player_place(creature_ptr, y, x);
     for (MONSTER_IDX i = 0; i < 4; i++) {
         place_monster_aux(creature_ptr, 0, creature_ptr->y + 8 + (i / 2) * 4, creature_ptr->x - 2 + (i % 2) * 4, battle_mon[i], (PM_NO_KAGE | PM_NO_PET));
-        set_friendly(&floor_ptr->m_list[floor_ptr->grid_array[creature_ptr->y + 8 + (i / 2) * 4][creature_ptr->x - 2 + (i % 2) * 4].m_idx]);
+        set_friendly(creature_ptr, &floor_ptr->m_list[floor_ptr->grid_array[creature_ptr->y + 8 + (i / 2) * 4][creature_ptr->x - 2 + (i % 2) * 4].m_idx]);
     }
 
     for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
@@ -329,6 +335,7 @@ void clear_cave(player_type *player_ptr)
 {
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     (void)C_WIPE(floor_ptr->o_list, floor_ptr->o_max, object_type);
+    reset_slot_list(&floor_ptr->o_slots, floor_ptr->o_max);
     floor_ptr->o_max = 1;
     floor_ptr->o_cnt = 0;
 
@@ -336,11 +343,12 @@ void clear_cave(player_type *player_ptr)
         r_info[i].cur_num = 0;
 
     (void)C_WIPE(floor_ptr->m_list, floor_ptr->m_max, monster_type);
+    reset_slot_list(&floor_ptr->m_slots, floor_ptr->m_max);
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
-    for (int i = 0; i < MAX_MTIMED; i++)
-        floor_ptr->mproc_max[i] = 0;
+    mproc_clear(floor_ptr);
 
+    reset_pet_registry(floor_ptr);
     precalc_cur_num_of_pet(player_ptr);
     for (POSITION y = 0; y < MAX_HGT; y++) {
         for (POSITION x = 0; x < MAX_WID; x++) {
@@ -357,6 +365,9 @@ void clear_cave(player_type *player_ptr)
         }
     }
 
+    invalidate_teleport_index(floor_ptr);
+    invalidate_feat_planes(floor_ptr);
+    invalidate_projection_cache();
     floor_ptr->base_level = floor_ptr->dun_level;
     floor_ptr->monster_level = floor_ptr->base_level;
     floor_ptr->object_level = floor_ptr->base_level;
@@ -373,10 +384,14 @@ void generate_floor(player_type *player_ptr)
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     floor_ptr->dungeon_idx = player_ptr->dungeon_idx;
     set_floor_and_wall(floor_ptr->dungeon_idx);
+    TURN_PROFILE_BEGIN(TPS_GENERATE_FLOOR);
+    double floor_start = begin_gen_stage();
     for (int num = 0; TRUE; num++) {
         bool okay = TRUE;
         concptr why = NULL;
+        double start = begin_gen_stage();
         clear_cave(player_ptr);
+        end_gen_stage(GEN_STAGE_CLEAR, start);
         player_ptr->x = player_ptr->y = 0;
         if (floor_ptr->inside_arena)
             generate_challenge_arena(player_ptr);
@@ -403,7 +418,8 @@ void generate_floor(player_type *player_ptr)
         if (okay)
             break;
 
-        if (why)
+        record_generation_retry(why);
+        if (why && !generation_profile.active)
             msg_format(_("生成やり直し(%s)", "Generation restarted (%s)"), why);
 
         wipe_o_list(floor_ptr);
@@ -413,4 +429,6 @@ void generate_floor(player_type *player_ptr)
     glow_deep_lava_and_bldg(player_ptr);
     player_ptr->enter_dungeon = FALSE;
     wipe_generate_random_floor_flags(floor_ptr);
+    end_gen_floor(floor_start);
+    TURN_PROFILE_END(TPS_GENERATE_FLOOR);
 }
@@ -26,6 +26,7 @@
 #include "monster/monster-status.h"
 #include "object-hook/hook-checker.h"
 #include "object-hook/hook-enchant.h"
+#include "pet/pet-registry.h"
 #include "pet/pet-util.h"
 #include "player/special-defense-types.h"
 #include "save/floor-writer.h"
@@ -79,15 +80,21 @@ static void sweep_preserving_pet(player_type *master_ptr)
     if (master_ptr->wild_mode || master_ptr->current_floor_ptr->inside_arena || master_ptr->phase_out)
         return;
 
-    for (MONSTER_IDX i = master_ptr->current_floor_ptr->m_max - 1, party_monster_num = 1; (i >= 1) && (party_monster_num < MAX_PARTY_MON); i--) {
+    MONSTER_IDX *who;
+    C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    MONSTER_NUMBER max_pet = collect_pets(master_ptr->current_floor_ptr, who);
+    for (MONSTER_NUMBER j = 0, party_monster_num = 1; (j < max_pet) && (party_monster_num < MAX_PARTY_MON); j++) {
+        MONSTER_IDX i = who[j];
         monster_type *m_ptr = &master_ptr->current_floor_ptr->m_list[i];
-        if (!monster_is_valid(m_ptr) || !is_pet(m_ptr) || (i == master_ptr->riding) || check_pet_preservation_conditions(master_ptr, m_ptr))
+        if ((i == master_ptr->riding) || check_pet_preservation_conditions(master_ptr, m_ptr))
             continue;
 
         (void)COPY(&party_mon[party_monster_num], &master_ptr->current_floor_ptr->m_list[i], monster_type);
         party_monster_num++;
         delete_monster_idx(master_ptr, i);
     }
+
+    C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
 }
 
 static void record_pet_diary(player_type *master_ptr)
@@ -95,15 +102,21 @@ static void record_pet_diary(player_type *master_ptr)
     if (!record_named_pet)
         return;
 
-    for (MONSTER_IDX i = master_ptr->current_floor_ptr->m_max - 1; i >= 1; i--) {
+    MONSTER_IDX *who;
+    C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    MONSTER_NUMBER max_pet = collect_pets(master_ptr->current_floor_ptr, who);
+    for (MONSTER_NUMBER j = 0; j < max_pet; j++) {
+        MONSTER_IDX i = who[j];
         monster_type *m_ptr = &master_ptr->current_floor_ptr->m_list[i];
         GAME_TEXT m_name[MAX_NLEN];
-        if (!monster_is_valid(m_ptr) || !is_pet(m_ptr) || !m_ptr->nickname || (master_ptr->riding == i))
+        if (!m_ptr->nickname || (master_ptr->riding == i))
             continue;
 
         monster_desc(master_ptr, m_name, m_ptr, MD_ASSUME_VISIBLE | MD_INDEF_VISIBLE);
         exe_write_diary(master_ptr, DIARY_NAMED_PET, RECORD_NAMED_PET_MOVED, m_name);
     }
+
+    C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
 }
 
 /*!
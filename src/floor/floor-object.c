@@ -186,6 +186,7 @@ void delete_all_items_from_floor(player_type *player_ptr, POSITION y, POSITION x
         o_ptr = &floor_ptr->o_list[this_o_idx];
         next_o_idx = o_ptr->next_o_idx;
         object_wipe(o_ptr);
+        release_slot(&floor_ptr->o_slots, this_o_idx);
         floor_ptr->o_cnt--;
     }
 
@@ -255,6 +256,7 @@ void delete_object_idx(player_type *player_ptr, OBJECT_IDX o_idx)
     }
 
     object_wipe(j_ptr);
+    release_slot(&floor_ptr->o_slots, o_idx);
     floor_ptr->o_cnt--;
 }
 
@@ -545,6 +547,7 @@ OBJECT_IDX drop_near(player_type *owner_ptr, object_type *j_ptr, PERCENTAGE chan
         j_ptr->ix = bx;
         j_ptr->held_m_idx = 0;
         j_ptr->next_o_idx = g_ptr->o_idx;
+        j_ptr->autopick_version = 0; /* 持ち歩く間の呪い等の変化は版に現れないので判定し直す */
 
         g_ptr->o_idx = o_idx;
         done = TRUE;
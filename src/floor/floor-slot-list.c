@@ -0,0 +1,162 @@
+﻿/*!
+ * @brief アイテム・モンスター配列の空き枠の管理 / Free-lists for the object and monster arrays of a floor
+ * @date 2026/10/19
+ * @details
+ * o_pop()・m_pop() が空き枠を配列の先頭から探さずに済むよう、削除で空いた枠の添字を積んでおく。
+ * 枠ごとの世代で使用中か空きかを覚え、同じ枠を二重に空けて一覧を壊すことを防ぐ。
+ * 世代は覚えておいた添字が削除・再利用で別の住人を指していないかの確認にも使う。
+ * 配列を詰める圧縮は一覧を捨てるので、圧縮の後は forget_free_slots() を呼ぶ。
+ */
+
+#include "floor/floor-slot-list.h"
+#include "util/usec-timer.h"
+
+/*!
+ * @brief 空き枠の一覧を確保する / Allocate a free-list
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param max 配列の大きさ
+ * @return なし
+ */
+void make_slot_list(slot_list_type *slots, int max)
+{
+    C_MAKE(slots->free_list, max, s16b);
+    C_MAKE(slots->generation, max, u16b);
+    slots->free_num = 0;
+}
+
+/*!
+ * @brief 空き枠の一覧を解放する / Free a free-list
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param max 配列の大きさ
+ * @return なし
+ */
+void kill_slot_list(slot_list_type *slots, int max)
+{
+    C_KILL(slots->generation, max, u16b);
+    C_KILL(slots->free_list, max, s16b);
+    slots->free_num = 0;
+}
+
+/*!
+ * @brief 配列を空にした時に一覧を初期化する / Reset a free-list when the whole array is wiped
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param used 空にする前の使用範囲 (o_max・m_max)
+ * @return なし
+ */
+void reset_slot_list(slot_list_type *slots, int used)
+{
+    for (int i = 1; i < used; i++) {
+        if (slots->generation[i] & 1)
+            slots->generation[i]++;
+    }
+
+    slots->free_num = 0;
+}
+
+/*!
+ * @brief 空き枠を1つ取り出して使用中にする / Pop a free slot
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @return 空き枠の添字。空き枠がなければ0
+ */
+s16b pop_free_slot(slot_list_type *slots)
+{
+    if (slots->free_num == 0)
+        return 0;
+
+    s16b idx = slots->free_list[--slots->free_num];
+    occupy_slot(slots, idx);
+    return idx;
+}
+
+/*!
+ * @brief 枠を使用中にする / Mark a slot as used
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param idx 枠の添字
+ * @return なし
+ */
+void occupy_slot(slot_list_type *slots, s16b idx)
+{
+    if (!(slots->generation[idx] & 1))
+        slots->generation[idx]++;
+}
+
+/*!
+ * @brief 枠を空けて一覧に積む / Release a slot to the free-list
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param idx 枠の添字
+ * @return 積んだらTRUE。既に空いていた枠ならFALSE
+ */
+bool release_slot(slot_list_type *slots, s16b idx)
+{
+    if ((idx <= 0) || !(slots->generation[idx] & 1))
+        return FALSE;
+
+    slots->generation[idx]++;
+    slots->free_list[slots->free_num++] = idx;
+    return TRUE;
+}
+
+/*!
+ * @brief 圧縮で移動した枠の世代を付け替える / Follow an entry moved by the compaction
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param from 移動元の添字
+ * @param to 移動先の添字
+ * @return なし
+ */
+void move_slot(slot_list_type *slots, s16b from, s16b to)
+{
+    occupy_slot(slots, to);
+    if (slots->generation[from] & 1)
+        slots->generation[from]++;
+}
+
+/*!
+ * @brief 圧縮で空き枠がなくなった時に一覧を捨てる / Drop the free-list after the array is compacted
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @return なし
+ */
+void forget_free_slots(slot_list_type *slots) { slots->free_num = 0; }
+
+/*!
+ * @brief 枠の今の世代を返す / Current generation of a slot
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param idx 枠の添字
+ * @return 世代
+ * @details
+ * 添字を後で使うために覚える時、一緒に覚えておく。
+ */
+u16b slot_generation(slot_list_type *slots, s16b idx) { return slots->generation[idx]; }
+
+/*!
+ * @brief 覚えておいた添字と世代の組がまだ同じ住人を指すか調べる / Check whether a saved (index, generation) pair is still valid
+ * @param slots 空き枠の一覧への参照ポインタ
+ * @param idx 覚えておいた添字
+ * @param generation 添字と一緒に覚えておいた世代
+ * @return 枠が使用中で、覚えた後に空けられも使い直されもしていなければTRUE
+ */
+bool is_slot_current(slot_list_type *slots, s16b idx, u16b generation)
+{
+    if (idx <= 0)
+        return FALSE;
+
+    return (generation & 1) && (slots->generation[idx] == generation);
+}
+
+/*!
+ * @brief 圧縮1回分の計測結果を累計する / Accumulate the statistics of one compaction
+ * @param stat_ptr 計測結果の累計先
+ * @param deleted 削除した数
+ * @param moved 移動した数
+ * @param start 圧縮を始めた時刻
+ * @return なし
+ */
+void record_slot_compaction(slot_compaction_type *stat_ptr, int deleted, int moved, double start)
+{
+    double usec = get_usec_time() - start;
+    stat_ptr->count++;
+    stat_ptr->deleted += deleted;
+    stat_ptr->moved += moved;
+    stat_ptr->usec += usec;
+    if (usec > stat_ptr->max_usec)
+        stat_ptr->max_usec = usec;
+}
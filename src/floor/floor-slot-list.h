@@ -0,0 +1,38 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+/*!
+ * @brief アイテム・モンスター配列の空き枠の一覧 / Free-list and generations of the slots of o_list or m_list
+ * @details
+ * 世代は枠を使い始める時と空ける時に1つずつ進め、奇数なら使用中、偶数なら空きを表す。
+ * 添字を覚えておく時は世代も一緒に覚え、使う前に is_slot_current() で同じ枠の同じ住人かを確かめる。
+ */
+typedef struct slot_list_type {
+    s16b *free_list; /*!< 空き枠の添字のスタック [配列の大きさ] */
+    s16b free_num; /*!< 空き枠の数 */
+    u16b *generation; /*!< 枠ごとの世代 [配列の大きさ] */
+} slot_list_type;
+
+/*!
+ * @brief 配列の圧縮の計測結果 / Accumulated statistics of the compaction of o_list or m_list
+ */
+typedef struct slot_compaction_type {
+    int count; /*!< 圧縮した回数 */
+    int deleted; /*!< 圧縮のために削除した数 */
+    int moved; /*!< 詰めるために移動した数 */
+    double usec; /*!< 圧縮にかかった累計時間 */
+    double max_usec; /*!< 1回あたりの最長時間 */
+} slot_compaction_type;
+
+void make_slot_list(slot_list_type *slots, int max);
+void kill_slot_list(slot_list_type *slots, int max);
+void reset_slot_list(slot_list_type *slots, int used);
+s16b pop_free_slot(slot_list_type *slots);
+void occupy_slot(slot_list_type *slots, s16b idx);
+bool release_slot(slot_list_type *slots, s16b idx);
+void move_slot(slot_list_type *slots, s16b from, s16b to);
+void forget_free_slots(slot_list_type *slots);
+u16b slot_generation(slot_list_type *slots, s16b idx);
+bool is_slot_current(slot_list_type *slots, s16b idx, u16b generation);
+void record_slot_compaction(slot_compaction_type *stat_ptr, int deleted, int moved, double start);
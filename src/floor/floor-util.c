@@ -146,6 +146,7 @@ void wipe_o_list(floor_type *floor_ptr)
         object_wipe(o_ptr);
     }
 
+    reset_slot_list(&floor_ptr->o_slots, floor_ptr->o_max);
     floor_ptr->o_max = 1;
     floor_ptr->o_cnt = 0;
 }
@@ -0,0 +1,117 @@
+﻿/*!
+ * @brief フロア生成の計測 / Profiling of the floor generation
+ * @date 2026/10/19
+ * @details
+ * 計測中でなければ各区分の開始・終了は判定1回で戻るため、通常のフロア生成には影響しない。
+ */
+
+#include "floor/generation-profiler.h"
+#include "util/usec-timer.h"
+
+/*!
+ * フロア生成の計測結果 / Statistics collected while the profile is active
+ */
+generation_profile_type generation_profile;
+
+/*!
+ * 計測区分の表示名 / Names of the stages
+ */
+const concptr gen_stage_names[MAX_GEN_STAGE] = {
+    "clear_cave",
+    "caverns/lakes",
+    "rooms",
+    "tunnels/doors",
+    "stairs",
+    "streamers",
+    "player/quest",
+    "monsters",
+    "objects",
+};
+
+/*!
+ * @brief 計測結果を消去して計測を始める / Reset the statistics and start profiling
+ * @return なし
+ */
+void start_generation_profile(void)
+{
+    (void)WIPE(&generation_profile, generation_profile_type);
+    generation_profile.active = TRUE;
+}
+
+/*!
+ * @brief 計測を止める / Stop profiling
+ * @return なし
+ */
+void stop_generation_profile(void) { generation_profile.active = FALSE; }
+
+/*!
+ * @brief 区分の計測を始める / Begin to time a stage
+ * @return 開始時刻。計測中でなければ0
+ */
+double begin_gen_stage(void)
+{
+    if (!generation_profile.active)
+        return 0;
+
+    return get_usec_time();
+}
+
+/*!
+ * @brief 区分の計測を終えて累計する / Finish timing a stage
+ * @param stage 計測区分
+ * @param start begin_gen_stage()の返り値
+ * @return なし
+ */
+void end_gen_stage(gen_stage_type stage, double start)
+{
+    if (!generation_profile.active)
+        return;
+
+    generation_profile.stage_usec[stage] += get_usec_time() - start;
+}
+
+/*!
+ * @brief 1フロアの生成完了までの時間を累計する / Finish timing a whole floor
+ * @param start generate_floor()の開始時に呼んだbegin_gen_stage()の返り値
+ * @return なし
+ */
+void end_gen_floor(double start)
+{
+    if (!generation_profile.active)
+        return;
+
+    double usec = get_usec_time() - start;
+    generation_profile.floors++;
+    generation_profile.total_usec += usec;
+    if (usec > generation_profile.max_floor_usec)
+        generation_profile.max_floor_usec = usec;
+}
+
+/*!
+ * @brief フロア生成のやり直し理由を記録する / Count a restart of the generation by its reason
+ * @param why やり直し理由 (NULLならば理由不明として扱う)
+ * @return なし
+ */
+void record_generation_retry(concptr why)
+{
+    if (!generation_profile.active)
+        return;
+
+    if (!why)
+        why = "(unknown)";
+
+    int i;
+    for (i = 0; i < generation_profile.retry_num; i++)
+        if (streq(generation_profile.retry_why[i], why))
+            break;
+
+    if (i == MAX_GEN_RETRY_REASON) {
+        i = MAX_GEN_RETRY_REASON - 1;
+        generation_profile.retry_why[i] = "(other)";
+    } else if (i == generation_profile.retry_num) {
+        generation_profile.retry_why[i] = why;
+        generation_profile.retry_num++;
+    }
+
+    generation_profile.retry_count[i]++;
+}
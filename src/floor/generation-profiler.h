@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+/*!
+ * @brief フロア生成の計測区分 / Stages of the floor generation
+ */
+typedef enum gen_stage_type {
+    GEN_STAGE_CLEAR = 0, /*!< clear_cave() */
+    GEN_STAGE_LAYOUT = 1, /*!< 洞窟・湖・空フロアの下地 */
+    GEN_STAGE_ROOMS = 2, /*!< generate_rooms() と迷宮 */
+    GEN_STAGE_TUNNELS = 3, /*!< build_tunnel() と扉 */
+    GEN_STAGE_STAIRS = 4, /*!< alloc_stairs() */
+    GEN_STAGE_STREAMERS = 5, /*!< build_streamer() */
+    GEN_STAGE_PLAYER = 6, /*!< 外壁とプレイヤー・クエストモンスターの配置 */
+    GEN_STAGE_MONSTERS = 7, /*!< alloc_monster() とダンジョンの主 */
+    GEN_STAGE_OBJECTS = 8, /*!< alloc_object() */
+    MAX_GEN_STAGE = 9,
+} gen_stage_type;
+
+#define MAX_GEN_RETRY_REASON 16 /*!< 記録するやり直し理由の種類数 */
+
+/*!
+ * @brief フロア生成の計測結果 / Accumulated statistics of the floor generation
+ */
+typedef struct generation_profile_type {
+    bool active; /*!< 計測中か */
+    int floors; /*!< 生成に成功したフロア数 */
+    double stage_usec[MAX_GEN_STAGE]; /*!< 区分ごとの累計時間 */
+    double total_usec; /*!< generate_floor() の累計時間 */
+    double max_floor_usec; /*!< 1フロアあたりの最長時間 */
+    int room_num; /*!< 直近に生成したフロアの部屋数 */
+    int retry_num; /*!< 記録したやり直し理由の種類数 */
+    concptr retry_why[MAX_GEN_RETRY_REASON]; /*!< やり直し理由 */
+    int retry_count[MAX_GEN_RETRY_REASON]; /*!< 理由ごとのやり直し回数 */
+} generation_profile_type;
+
+extern generation_profile_type generation_profile;
+extern const concptr gen_stage_names[MAX_GEN_STAGE];
+
+void start_generation_profile(void);
+void stop_generation_profile(void);
+double begin_gen_stage(void);
+void end_gen_stage(gen_stage_type stage, double start);
+void end_gen_floor(double start);
+void record_generation_retry(concptr why);
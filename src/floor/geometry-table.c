@@ -0,0 +1,146 @@
+﻿/*!
+ * @brief 距離・方向・同心円状オフセットの参照表 / Lookup tables for distance, direction and offset rings
+ * @date 2026/10/19
+ * @details
+ * distance()とfind_safety()等で使う距離ごとのオフセット一覧は、
+ * 起動時にcalc_distance()の計算結果から一度だけ生成する。
+ * 旧来の手書きオフセット表と同じ順序で並ぶように生成している。
+ */
+
+#include "floor/geometry-table.h"
+
+#define GEOMETRY_RING_HGT (MAX_HGT * 2 - 1) /*!< オフセット表が扱う縦方向の範囲 */
+#define GEOMETRY_RING_WID (MAX_WID * 2 - 1) /*!< オフセット表が扱う横方向の範囲 */
+#define GEOMETRY_RING_SIZE (GEOMETRY_RING_HGT * GEOMETRY_RING_WID + MAX_GEOMETRY_DISTANCE + 1) /*!< 全オフセットと各距離の終端の数 */
+
+/*!
+ * 縦横の差から距離を引く表 / Distance indexed by the absolute offsets
+ */
+byte distance_table[MAX_HGT][MAX_WID];
+
+/*!
+ * オフセットから方向を引く表 / Direction indexed by [dy + 1][dx + 1]
+ */
+const DIRECTION offset_to_dir[3][3] = { { 7, 8, 9 }, { 4, 5, 6 }, { 1, 2, 3 } };
+
+static POSITION ring_y[GEOMETRY_RING_SIZE];
+static POSITION ring_x[GEOMETRY_RING_SIZE];
+
+/*!
+ * @brief 距離nのオフセット一覧 / Offsets of all the grids at a distance of n
+ * @details
+ * dist_offsets_y[n]とdist_offsets_x[n]の組が中心から距離nの位置を列挙し、
+ * (0,0)で終端する。
+ */
+const POSITION *dist_offsets_y[MAX_GEOMETRY_DISTANCE + 1];
+const POSITION *dist_offsets_x[MAX_GEOMETRY_DISTANCE + 1];
+
+/*!
+ * @brief 縦横の差から距離をニュートン・ラプソン法で算出する / Distance of an offset via Newton-Raphson technique
+ * @param dy 縦方向の差の絶対値
+ * @param dx 横方向の差の絶対値
+ * @return 距離
+ */
+POSITION calc_distance(POSITION dy, POSITION dx)
+{
+    /* Squared distance */
+    POSITION target = (dy * dy) + (dx * dx);
+
+    /* Approximate distance: hypot(dy,dx) = max(dy,dx) + min(dy,dx) / 2 */
+    POSITION d = (dy > dx) ? (dy + (dx >> 1)) : (dx + (dy >> 1));
+
+    POSITION err;
+
+    /* Simple case */
+    if (!dy || !dx)
+        return d;
+
+    while (TRUE) {
+        /* Approximate error */
+        err = (target - d * d) / (2 * d);
+
+        /* No error - we are done */
+        if (!err)
+            break;
+
+        /* Adjust distance */
+        d += err;
+    }
+
+    return d;
+}
+
+/*!
+ * @brief オフセット表の行を走査する順番を返す
+ * @param i 0から始まる順番
+ * @return 行のオフセット (-1, -2, ... -(MAX_HGT - 1), 0, 1, ... MAX_HGT - 1 の順)
+ */
+static POSITION ring_row(int i)
+{
+    if (i < MAX_HGT - 1)
+        return -(i + 1);
+
+    return i - (MAX_HGT - 1);
+}
+
+/*!
+ * @brief オフセット表の列を走査する順番を返す
+ * @param i 0から始まる順番
+ * @return 列のオフセット (-1, -2, ... -(MAX_WID - 1), 0, 1, ... MAX_WID - 1 の順)
+ */
+static POSITION ring_col(int i)
+{
+    if (i < MAX_WID - 1)
+        return -(i + 1);
+
+    return i - (MAX_WID - 1);
+}
+
+/*!
+ * @brief 距離とオフセットの参照表を生成する / Build the geometry lookup tables
+ * @return なし
+ */
+void init_geometry_tables(void)
+{
+    int ring_num[MAX_GEOMETRY_DISTANCE + 1];
+    for (int d = 0; d <= MAX_GEOMETRY_DISTANCE; d++)
+        ring_num[d] = 0;
+
+    for (POSITION dy = 0; dy < MAX_HGT; dy++) {
+        for (POSITION dx = 0; dx < MAX_WID; dx++) {
+            POSITION d = calc_distance(dy, dx);
+            distance_table[dy][dx] = (byte)d;
+            if (d == 0)
+                continue;
+
+            int mirrors = (dy ? 2 : 1) * (dx ? 2 : 1);
+            ring_num[d] += mirrors;
+        }
+    }
+
+    int ring_pos[MAX_GEOMETRY_DISTANCE + 1];
+    int start = 0;
+    for (int d = 0; d <= MAX_GEOMETRY_DISTANCE; d++) {
+        dist_offsets_y[d] = &ring_y[start];
+        dist_offsets_x[d] = &ring_x[start];
+        ring_pos[d] = start;
+        start += ring_num[d];
+        ring_y[start] = 0;
+        ring_x[start] = 0;
+        start++;
+    }
+
+    for (int i = 0; i < GEOMETRY_RING_HGT; i++) {
+        POSITION y = ring_row(i);
+        for (int j = 0; j < GEOMETRY_RING_WID; j++) {
+            POSITION x = ring_col(j);
+            POSITION d = distance_table[ABS(y)][ABS(x)];
+            if (d == 0)
+                continue;
+
+            ring_y[ring_pos[d]] = y;
+            ring_x[ring_pos[d]] = x;
+            ring_pos[d]++;
+        }
+    }
+}
@@ -0,0 +1,18 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "floor/floor-base-definitions.h"
+
+/*!
+ * @brief フロア内の2点間で取りうる最大距離 / The largest distance() between two grids of a floor
+ * @details distance(0, 0, MAX_HGT - 1, MAX_WID - 1) の値。
+ */
+#define MAX_GEOMETRY_DISTANCE 208
+
+extern byte distance_table[MAX_HGT][MAX_WID];
+extern const POSITION *dist_offsets_y[MAX_GEOMETRY_DISTANCE + 1];
+extern const POSITION *dist_offsets_x[MAX_GEOMETRY_DISTANCE + 1];
+extern const DIRECTION offset_to_dir[3][3];
+
+POSITION calc_distance(POSITION dy, POSITION dx);
+void init_geometry_tables(void);
@@ -1,5 +1,6 @@
 ﻿#include "floor/geometry.h"
 #include "floor/cave.h"
+#include "floor/geometry-table.h"
 #include "game-option/text-display-options.h"
 #include "grid/feature.h"
 #include "grid/grid.h"
@@ -48,43 +49,22 @@ const POSITION ddx_cdd[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
 const POSITION ddy_cdd[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
 
 /*!
- * @brief 2点間の距離をニュートン・ラプソン法で算出する / Distance between two points via Newton-Raphson technique
+ * @brief 2点間の距離を参照表から引く / Distance between two points
  * @param y1 1点目のy座標
  * @param x1 1点目のx座標
  * @param y2 2点目のy座標
  * @param x2 2点目のx座標
  * @return 2点間の距離
+ * @details 表の範囲外の差はcalc_distance()で計算する。
  */
 POSITION distance(POSITION y1, POSITION x1, POSITION y2, POSITION x2)
 {
     POSITION dy = (y1 > y2) ? (y1 - y2) : (y2 - y1);
     POSITION dx = (x1 > x2) ? (x1 - x2) : (x2 - x1);
+    if ((dy < MAX_HGT) && (dx < MAX_WID))
+        return distance_table[dy][dx];
 
-    /* Squared distance */
-    POSITION target = (dy * dy) + (dx * dx);
-
-    /* Approximate distance: hypot(dy,dx) = max(dy,dx) + min(dy,dx) / 2 */
-    POSITION d = (dy > dx) ? (dy + (dx >> 1)) : (dx + (dy >> 1));
-
-    POSITION err;
-
-    /* Simple case */
-    if (!dy || !dx)
-        return d;
-
-    while (TRUE) {
-        /* Approximate error */
-        err = (target - d * d) / (2 * d);
-
-        /* No error - we are done */
-        if (!err)
-            break;
-
-        /* Adjust distance */
-        d += err;
-    }
-
-    return d;
+    return calc_distance(dy, dx);
 }
 
 /*!
@@ -96,7 +76,6 @@ POSITION distance(POSITION y1, POSITION x1, POSITION y2, POSITION x2)
  */
 DIRECTION coords_to_dir(player_type *creature_ptr, POSITION y, POSITION x)
 {
-    DIRECTION d[3][3] = { { 7, 4, 1 }, { 8, 5, 2 }, { 9, 6, 3 } };
     POSITION dy, dx;
 
     dy = y - creature_ptr->y;
@@ -104,7 +83,7 @@ DIRECTION coords_to_dir(player_type *creature_ptr, POSITION y, POSITION x)
     if (ABS(dx) > 1 || ABS(dy) > 1)
         return 0;
 
-    return d[dx + 1][dy + 1];
+    return offset_to_dir[dy + 1][dx + 1];
 }
 
 /*!
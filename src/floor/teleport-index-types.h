@@ -0,0 +1,10 @@
+﻿#pragma once
+
+/*!
+ * @brief テレポート先索引の種別 / Planes of the teleport destination index
+ */
+typedef enum teleport_index_type {
+    TELEPORT_INDEX_ANY = 0, /*!< テレポート可能な地形全て / Every teleportable grid */
+    TELEPORT_INDEX_OUTSIDE_VAULT = 1, /*!< Vault外のテレポート可能な地形 / Teleportable grids outside of vaults */
+    MAX_TELEPORT_INDEX = 2,
+} teleport_index_type;
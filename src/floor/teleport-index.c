@@ -0,0 +1,298 @@
+﻿/*!
+ * @brief テレポート先候補の索引 / Index of teleport destination candidates
+ * @date 2026/10/19
+ * @details
+ * フロアの行ごとにテレポート可能なグリッド数のFenwick木を持ち、
+ * ある地点からの距離帯に含まれる候補を全走査せずに数え上げ、一様に抽出する。
+ * 地形とVault属性の変化は索引に反映するが、モンスターやプレイヤーによる占有は
+ * 毎ターン変わるため索引には含めず、抽出した座標を呼び出し元が厳密に判定する。
+ */
+
+#include "floor/teleport-index.h"
+#include "floor/cave.h"
+#include "floor/geometry.h"
+#include "grid/feature.h"
+#include "grid/grid.h"
+#include "system/floor-type-definition.h"
+#include "util/bit-flags-calculator.h"
+
+#define TELEPORT_INDEX_STEP 128 /*!< Fenwick木探索の初期刻み幅 (MAX_WID以下の最大の2の冪) */
+
+/*!
+ * @brief グリッドがどの索引に登録されるべきかを判定する
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y Y座標
+ * @param x X座標
+ * @return 登録先の索引を表すビット集合
+ */
+static byte calc_teleport_grid_flags(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    if (!in_bounds(floor_ptr, y, x))
+        return 0;
+
+    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+    if (!has_flag(f_info[g_ptr->feat].flags, FF_TELEPORTABLE))
+        return 0;
+
+    byte flags = 1 << TELEPORT_INDEX_ANY;
+    if (!(g_ptr->info & CAVE_ICKY))
+        flags |= 1 << TELEPORT_INDEX_OUTSIDE_VAULT;
+
+    return flags;
+}
+
+/*!
+ * @brief 行のFenwick木に増減を加える
+ * @param tree 行のFenwick木
+ * @param x X座標
+ * @param value 増減値
+ * @return なし
+ */
+static void add_teleport_tree(s16b *tree, POSITION x, int value)
+{
+    for (int i = x + 1; i <= MAX_WID; i += i & -i)
+        tree[i] += (s16b)value;
+}
+
+/*!
+ * @brief 行の先頭から指定X座標までの候補数を返す
+ * @param tree 行のFenwick木
+ * @param x X座標 (負ならば0を返す)
+ * @return 0からxまでの候補数
+ */
+static int sum_teleport_tree(s16b *tree, POSITION x)
+{
+    int sum = 0;
+    for (int i = x + 1; i > 0; i -= i & -i)
+        sum += tree[i];
+
+    return sum;
+}
+
+/*!
+ * @brief 行の先頭から数えてk番目の候補のX座標を返す
+ * @param tree 行のFenwick木
+ * @param k 1から始まる順位
+ * @return 候補のX座標
+ */
+static POSITION search_teleport_tree(s16b *tree, int k)
+{
+    int pos = 0;
+    for (int step = TELEPORT_INDEX_STEP; step > 0; step >>= 1) {
+        if ((pos + step > MAX_WID) || (tree[pos + step] >= k))
+            continue;
+
+        pos += step;
+        k -= tree[pos];
+    }
+
+    return (POSITION)pos;
+}
+
+/*!
+ * @brief 現在の地形から索引を作り直す
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ */
+static void build_teleport_index(floor_type *floor_ptr)
+{
+    for (POSITION y = 0; y < MAX_HGT; y++) {
+        for (int plane = 0; plane < MAX_TELEPORT_INDEX; plane++)
+            floor_ptr->teleport_index[plane][y][0] = 0;
+
+        for (POSITION x = 0; x < MAX_WID; x++) {
+            byte flags = calc_teleport_grid_flags(floor_ptr, y, x);
+            floor_ptr->teleport_grid_flags[y][x] = flags;
+            for (int plane = 0; plane < MAX_TELEPORT_INDEX; plane++)
+                floor_ptr->teleport_index[plane][y][x + 1] = (flags >> plane) & 1;
+        }
+
+        for (int plane = 0; plane < MAX_TELEPORT_INDEX; plane++) {
+            s16b *tree = floor_ptr->teleport_index[plane][y];
+            for (int i = 1; i <= MAX_WID; i++) {
+                int parent = i + (i & -i);
+                if (parent <= MAX_WID)
+                    tree[parent] += tree[i];
+            }
+        }
+    }
+
+    floor_ptr->teleport_index_ready = TRUE;
+}
+
+/*!
+ * @brief 索引を破棄し、次の参照時に作り直させる / Forget the index so that it is rebuilt on demand
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ * @details フロアの生成や一括した地形変化の後に呼ぶ。
+ */
+void invalidate_teleport_index(floor_type *floor_ptr) { floor_ptr->teleport_index_ready = FALSE; }
+
+/*!
+ * @brief 1グリッドの地形変化を索引に反映する / Reflect a terrain change of a grid into the index
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y Y座標
+ * @param x X座標
+ * @return なし
+ */
+void update_teleport_index(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    if (!floor_ptr->teleport_index_ready)
+        return;
+    if ((y < 0) || (y >= MAX_HGT) || (x < 0) || (x >= MAX_WID))
+        return;
+
+    byte old_flags = floor_ptr->teleport_grid_flags[y][x];
+    byte flags = calc_teleport_grid_flags(floor_ptr, y, x);
+    if (flags == old_flags)
+        return;
+
+    floor_ptr->teleport_grid_flags[y][x] = flags;
+    for (int plane = 0; plane < MAX_TELEPORT_INDEX; plane++) {
+        int diff = ((flags >> plane) & 1) - ((old_flags >> plane) & 1);
+        if (diff)
+            add_teleport_tree(floor_ptr->teleport_index[plane][y], x, diff);
+    }
+}
+
+/*!
+ * @brief ある行で中心からの水平距離が何マスまで指定距離以内に収まるかを返す
+ * @param dy 中心からの垂直距離
+ * @param dis 距離
+ * @return 最大の水平距離。行全体が距離外ならば-1
+ */
+static POSITION calc_teleport_band_width(POSITION dy, POSITION dis)
+{
+    if (dis < dy)
+        return -1;
+
+    POSITION lo = 0;
+    POSITION hi = dis;
+    while (lo < hi) {
+        POSITION mid = (lo + hi + 1) / 2;
+        if (distance(0, 0, dy, mid) <= dis)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/*!
+ * @brief 行区間を距離帯に加える
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param band_ptr 距離帯への参照ポインタ
+ * @param y Y座標
+ * @param x1 左端X座標
+ * @param x2 右端X座標
+ * @return なし
+ */
+static void add_teleport_segment(floor_type *floor_ptr, teleport_band_type *band_ptr, POSITION y, POSITION x1, POSITION x2)
+{
+    x1 = MAX(x1, 1);
+    x2 = MIN(x2, floor_ptr->width - 2);
+    if (x1 > x2)
+        return;
+
+    s16b *tree = floor_ptr->teleport_index[band_ptr->plane][y];
+    int count = sum_teleport_tree(tree, x2) - sum_teleport_tree(tree, x1 - 1);
+    if (count == 0)
+        return;
+
+    band_ptr->y[band_ptr->num] = y;
+    band_ptr->x1[band_ptr->num] = x1;
+    band_ptr->x2[band_ptr->num] = x2;
+    band_ptr->count[band_ptr->num] = count;
+    band_ptr->num++;
+    band_ptr->total += count;
+}
+
+/*!
+ * @brief 地点からの距離がmin以上max以下の候補を行区間に分けて数える / Collect the candidates within a distance band
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param plane 参照する索引
+ * @param cy 中心のY座標
+ * @param cx 中心のX座標
+ * @param min 最小距離
+ * @param max 最大距離
+ * @param band_ptr 結果を格納する距離帯への参照ポインタ
+ * @return 候補数の合計
+ */
+int prepare_teleport_band(floor_type *floor_ptr, teleport_index_type plane, POSITION cy, POSITION cx, POSITION min, POSITION max, teleport_band_type *band_ptr)
+{
+    if (!floor_ptr->teleport_index_ready)
+        build_teleport_index(floor_ptr);
+
+    band_ptr->plane = plane;
+    band_ptr->num = 0;
+    band_ptr->total = 0;
+    if (max < min)
+        return 0;
+
+    POSITION top = MAX(1, cy - max);
+    POSITION bottom = MIN(floor_ptr->height - 2, cy + max);
+    for (POSITION y = top; y <= bottom; y++) {
+        POSITION dy = ABS(y - cy);
+        POSITION outer = calc_teleport_band_width(dy, max);
+        POSITION inner = calc_teleport_band_width(dy, min - 1) + 1;
+        if ((outer < 0) || (inner > outer))
+            continue;
+
+        if (inner == 0) {
+            add_teleport_segment(floor_ptr, band_ptr, y, cx - outer, cx + outer);
+            continue;
+        }
+
+        add_teleport_segment(floor_ptr, band_ptr, y, cx - outer, cx - inner);
+        add_teleport_segment(floor_ptr, band_ptr, y, cx + inner, cx + outer);
+    }
+
+    return band_ptr->total;
+}
+
+/*!
+ * @brief 距離帯の候補から1つを一様に選ぶ / Pick a uniformly random candidate in a distance band
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param band_ptr prepare_teleport_band()で準備した距離帯への参照ポインタ
+ * @param yp 選ばれたY座標を返す参照ポインタ
+ * @param xp 選ばれたX座標を返す参照ポインタ
+ * @return 候補が無ければFALSE
+ * @details 占有状況等は判定しないので、呼び出し元で改めて移動可能か確認すること。
+ */
+bool pick_teleport_band(floor_type *floor_ptr, teleport_band_type *band_ptr, POSITION *yp, POSITION *xp)
+{
+    if (band_ptr->total <= 0)
+        return FALSE;
+
+    int k = randint1(band_ptr->total);
+    for (int i = 0; i < band_ptr->num; i++) {
+        if (k > band_ptr->count[i]) {
+            k -= band_ptr->count[i];
+            continue;
+        }
+
+        s16b *tree = floor_ptr->teleport_index[band_ptr->plane][band_ptr->y[i]];
+        *yp = band_ptr->y[i];
+        *xp = search_teleport_tree(tree, sum_teleport_tree(tree, band_ptr->x1[i] - 1) + k);
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/*!
+ * @brief 地点からの距離がmin以上max以下の候補数を返す / Count the candidates within a distance band
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param plane 参照する索引
+ * @param cy 中心のY座標
+ * @param cx 中心のX座標
+ * @param min 最小距離
+ * @param max 最大距離
+ * @return 候補数
+ */
+int count_teleport_candidates(floor_type *floor_ptr, teleport_index_type plane, POSITION cy, POSITION cx, POSITION min, POSITION max)
+{
+    teleport_band_type band;
+    return prepare_teleport_band(floor_ptr, plane, cy, cx, min, max, &band);
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "floor/floor-base-definitions.h"
+#include "floor/teleport-index-types.h"
+
+typedef struct floor_type floor_type;
+
+/*!
+ * @brief 距離帯に含まれるテレポート先候補の行区間一覧 / Row segments of a distance band around a grid
+ */
+typedef struct teleport_band_type {
+    teleport_index_type plane; /*!< 参照する索引の種別 */
+    int num; /*!< 行区間の数 */
+    POSITION y[MAX_HGT * 2]; /*!< 行区間のY座標 */
+    POSITION x1[MAX_HGT * 2]; /*!< 行区間の左端X座標 */
+    POSITION x2[MAX_HGT * 2]; /*!< 行区間の右端X座標 */
+    int count[MAX_HGT * 2]; /*!< 行区間に含まれる候補数 */
+    int total; /*!< 候補数の合計 */
+} teleport_band_type;
+
+void invalidate_teleport_index(floor_type *floor_ptr);
+void update_teleport_index(floor_type *floor_ptr, POSITION y, POSITION x);
+int prepare_teleport_band(floor_type *floor_ptr, teleport_index_type plane, POSITION cy, POSITION cx, POSITION min, POSITION max, teleport_band_type *band_ptr);
+bool pick_teleport_band(floor_type *floor_ptr, teleport_band_type *band_ptr, POSITION *yp, POSITION *xp);
+int count_teleport_candidates(floor_type *floor_ptr, teleport_index_type plane, POSITION cy, POSITION cx, POSITION min, POSITION max);
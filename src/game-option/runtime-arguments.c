@@ -9,3 +9,5 @@ bool arg_monochrome; /* Command arg -- Request monochrome mode */
 bool arg_force_original; /* Command arg -- Request original keyset */
 bool arg_force_roguelike; /* Command arg -- Request roguelike keyset */
 bool arg_bigtile = FALSE; /* Command arg -- Request big tile mode */
+int arg_generation_floors = 0; /* Command arg -- Profile this many floors per level and quit */
+DEPTH arg_generation_depth = 0; /* Command arg -- Depth of the profiled floors, 0 for min/mid/max of each dungeon */
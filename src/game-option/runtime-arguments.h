@@ -11,3 +11,5 @@ extern bool arg_monochrome;
 extern bool arg_force_original;
 extern bool arg_force_roguelike;
 extern bool arg_bigtile;
+extern int arg_generation_floors;
+extern DEPTH arg_generation_depth;
@@ -3,6 +3,8 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
+#include "floor/teleport-index.h"
 #include "game-option/map-screen-options.h"
 #include "grid/grid.h"
 #include "grid/lighting-colors-table.h"
@@ -11,6 +13,7 @@
 #include "player/special-defense-types.h"
 #include "room/door-definition.h"
 #include "system/floor-type-definition.h"
+#include "target/projection-path-calculator.h"
 #include "util/bit-flags-calculator.h"
 #include "world/world.h"
 
@@ -186,6 +189,22 @@ FEAT_IDX feat_jammed_door_random(int door_type)
  */
 static bool player_has_los_grid(grid_type *g_ptr) { return (g_ptr->info & CAVE_VIEW) != 0; }
 
+/*!
+ * @brief 地形の変化が射線の通り方を変えるかを返す / Whether a terrain change can alter projection paths
+ * @param old_feat 変化前の地形ID
+ * @param new_feat 変化後の地形ID
+ * @return 射線キャッシュを破棄すべきならTRUE
+ */
+static bool feat_changes_projection(FEAT_IDX old_feat, FEAT_IDX new_feat)
+{
+    static const feature_flag_type projection_flags[] = { FF_PROJECT, FF_LOS, FF_HURT_DISI, FF_PERMANENT };
+    for (int i = 0; i < (int)(sizeof(projection_flags) / sizeof(projection_flags[0])); i++)
+        if (has_flag(f_info[old_feat].flags, projection_flags[i]) != has_flag(f_info[new_feat].flags, projection_flags[i]))
+            return TRUE;
+
+    return FALSE;
+}
+
 /*
  * Change the "feat" flag for a grid, and notice/redraw the grid
  */
@@ -194,9 +213,14 @@ void cave_set_feat(player_type *player_ptr, POSITION y, POSITION x, FEAT_IDX fea
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     grid_type *g_ptr = &floor_ptr->grid_array[y][x];
     feature_type *f_ptr = &f_info[feat];
+    if (feat_changes_projection(g_ptr->feat, feat))
+        invalidate_projection_cache();
+
     if (!current_world_ptr->character_dungeon) {
         g_ptr->mimic = 0;
         g_ptr->feat = feat;
+        update_teleport_index(floor_ptr, y, x);
+        update_feat_planes(floor_ptr, y, x);
         if (has_flag(f_ptr->flags, FF_GLOW) && !(d_info[floor_ptr->dungeon_idx].flags1 & DF1_DARKNESS)) {
             for (DIRECTION i = 0; i < 9; i++) {
                 POSITION yy = y + ddy_ddd[i];
@@ -217,6 +241,8 @@ void cave_set_feat(player_type *player_ptr, POSITION y, POSITION x, FEAT_IDX fea
     g_ptr->mimic = 0;
     g_ptr->feat = feat;
     g_ptr->info &= ~(CAVE_OBJECT);
+    update_teleport_index(floor_ptr, y, x);
+    update_feat_planes(floor_ptr, y, x);
     if (old_mirror && (d_info[floor_ptr->dungeon_idx].flags1 & DF1_DARKNESS)) {
         g_ptr->info &= ~(CAVE_GLOW);
         if (!view_torch_grids)
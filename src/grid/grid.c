@@ -48,6 +48,7 @@
 #include "view/display-map.h"
 #include "view/display-messages.h"
 #include "window/main-window-util.h"
+#include "window/overhead-map.h"
 #include "world/world.h"
 
 #define MONSTER_FLOW_DEPTH                                                                                                                                     \
@@ -537,6 +538,7 @@ void note_spot(player_type *player_ptr, POSITION y, POSITION x)
 
     /* Memorize terrain of the grid */
     g_ptr->info |= (CAVE_KNOWN);
+    note_overhead_map_grid(y, x);
 }
 
 /*
@@ -546,6 +548,9 @@ void note_spot(player_type *player_ptr, POSITION y, POSITION x)
  */
 void lite_spot(player_type *player_ptr, POSITION y, POSITION x)
 {
+    /* Off-panel grids are still shown on the overhead map */
+    note_overhead_map_grid(y, x);
+
     /* Redraw if on screen */
     if (panel_contains(y, x) && in_bounds2(player_ptr->current_floor_ptr, y, x)) {
         TERM_COLOR a;
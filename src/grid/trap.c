@@ -7,6 +7,7 @@
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
 #include "floor/floor-mode-changer.h"
 #include "game-option/birth-options.h"
 #include "game-option/special-options.h"
@@ -238,6 +239,7 @@ void place_trap(player_type *trapped_ptr, POSITION y, POSITION x)
     /* Place an invisible trap */
     g_ptr->mimic = g_ptr->feat;
     g_ptr->feat = choose_random_trap(trapped_ptr);
+    update_feat_planes(floor_ptr, y, x);
 }
 
 /*!
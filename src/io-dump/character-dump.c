@@ -23,6 +23,7 @@
 #include "monster/monster-status.h"
 #include "monster/smart-learn-types.h"
 #include "object/object-info.h"
+#include "pet/pet-registry.h"
 #include "pet/pet-util.h"
 #include "player-info/avatar.h"
 #include "player/player-status-flags.h"
@@ -48,15 +49,12 @@
 static void dump_aux_pet(player_type *master_ptr, FILE *fff)
 {
     bool pet = FALSE;
-    bool pet_settings = FALSE;
-    for (int i = master_ptr->current_floor_ptr->m_max - 1; i >= 1; i--) {
+    MONSTER_IDX *who;
+    C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    MONSTER_NUMBER max_pet = collect_pets(master_ptr->current_floor_ptr, who);
+    for (MONSTER_NUMBER j = 0; j < max_pet; j++) {
+        MONSTER_IDX i = who[j];
         monster_type *m_ptr = &master_ptr->current_floor_ptr->m_list[i];
-
-        if (!monster_is_valid(m_ptr))
-            continue;
-        if (!is_pet(m_ptr))
-            continue;
-        pet_settings = TRUE;
         if (!m_ptr->nickname && (master_ptr->riding != i))
             continue;
         if (!pet) {
@@ -69,7 +67,8 @@ static void dump_aux_pet(player_type *master_ptr, FILE *fff)
         fprintf(fff, "%s\n", pet_name);
     }
 
-    if (!pet_settings)
+    C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    if (max_pet == 0)
         return;
 
     fprintf(fff, _("\n\n  [ペットへの命令]\n", "\n\n  [Command for Pets]\n"));
@@ -109,8 +108,7 @@ static void dump_aux_quest(player_type *creature_ptr, FILE *fff)
 
     for (QUEST_IDX i = 1; i < max_q_idx; i++)
         quest_num[i] = i;
-    int dummy;
-    ang_sort(creature_ptr, quest_num, &dummy, max_q_idx, ang_sort_comp_quest_num, ang_sort_swap_quest_num);
+    sort_quest_num(quest_num, max_q_idx);
 
     fputc('\n', fff);
     do_cmd_knowledge_quests_completed(creature_ptr, fff, quest_num);
@@ -344,7 +342,7 @@ static void dump_aux_monsters(player_type *creature_ptr, FILE *fff)
 #endif
 
     /* Sort the array by dungeon depth of monsters */
-    ang_sort(creature_ptr, who, &why, uniq_total, ang_sort_comp_hook, ang_sort_swap_hook);
+    sort_race_index(who, uniq_total, why);
     fprintf(fff, _("\n《上位%ld体のユニーク・モンスター》\n", "\n< Unique monsters top %ld >\n"), MIN(uniq_total, 10));
 
     for (MONRACE_IDX k = uniq_total - 1; k >= 0 && k >= uniq_total - 10; k--) {
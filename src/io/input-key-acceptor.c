@@ -103,14 +103,17 @@ static char inkey_aux(void)
     if (parse_under)
         return (ch);
 
+    macro_match_type match;
+    macro_match_start(&match);
     buf[p++] = ch;
     buf[p] = '\0';
-    k = macro_find_check(buf);
+    macro_match_key(&match, ch);
+    k = macro_match_check(&match);
     if (k < 0)
         return (ch);
 
     while (TRUE) {
-        k = macro_find_maybe(buf);
+        k = macro_match_maybe(&match);
 
         if (k < 0)
             break;
@@ -118,6 +121,7 @@ static char inkey_aux(void)
         if (0 == term_inkey(&ch, FALSE, TRUE)) {
             buf[p++] = ch;
             buf[p] = '\0';
+            macro_match_key(&match, ch);
             w = 0;
         } else {
             w += 1;
@@ -128,7 +132,7 @@ static char inkey_aux(void)
         }
     }
 
-    k = macro_find_ready(buf);
+    k = match.ready;
     if (k < 0) {
         while (p > 0) {
             if (term_key_push(buf[--p]))
@@ -23,6 +23,7 @@
 #include "monster/monster-info.h"
 #include "monster/monster-status.h"
 #include "monster/smart-learn-types.h"
+#include "pet/pet-registry.h"
 #include "system/floor-type-definition.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
@@ -95,8 +96,7 @@ static IDX collect_monsters(player_type *creature_ptr, IDX grp_cur, IDX mon_idx[
     }
 
     mon_idx[mon_cnt] = -1;
-    int dummy_why;
-    ang_sort(creature_ptr, mon_idx, &dummy_why, mon_cnt, ang_sort_comp_monster_level, ang_sort_swap_hook);
+    sort_race_index_by_level(mon_idx, mon_cnt);
     return mon_cnt;
 }
 
@@ -113,19 +113,18 @@ void do_cmd_knowledge_pets(player_type *creature_ptr)
     if (!open_temporary_file(&fff, file_name))
         return;
 
-    monster_type *m_ptr;
+    MONSTER_IDX *who;
     GAME_TEXT pet_name[MAX_NLEN];
-    int t_friends = 0;
-    for (int i = creature_ptr->current_floor_ptr->m_max - 1; i >= 1; i--) {
-        m_ptr = &creature_ptr->current_floor_ptr->m_list[i];
-        if (!monster_is_valid(m_ptr) || !is_pet(m_ptr))
-            continue;
-
-        t_friends++;
+    C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    int t_friends = collect_pets(creature_ptr->current_floor_ptr, who);
+    for (int i = 0; i < t_friends; i++) {
+        monster_type *m_ptr = &creature_ptr->current_floor_ptr->m_list[who[i]];
         monster_desc(creature_ptr, pet_name, m_ptr, MD_ASSUME_VISIBLE | MD_INDEF_VISIBLE);
         fprintf(fff, "%s (%s)\n", pet_name, look_mon_desc(m_ptr, 0x00));
     }
 
+    C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+
     int show_upkeep = calculate_upkeep(creature_ptr);
 
     fprintf(fff, "----------------------------------------------\n");
@@ -194,7 +193,7 @@ void do_cmd_knowledge_kill_count(player_type *creature_ptr)
     }
 
     u16b why = 2;
-    ang_sort(creature_ptr, who, &why, n, ang_sort_comp_hook, ang_sort_swap_hook);
+    sort_race_index(who, n, why);
     for (int k = 0; k < n; k++) {
         monster_race *r_ptr = &r_info[who[k]];
         if (r_ptr->flags1 & (RF1_UNIQUE)) {
@@ -16,6 +16,7 @@
 #include "monster/monster-info.h"
 #include "monster/monster-list.h"
 #include "object-hook/hook-checker.h"
+#include "pet/pet-registry.h"
 #include "save/floor-writer.h"
 #include "system/angband-version.h"
 #include "system/floor-type-definition.h"
@@ -222,6 +223,7 @@ errr rd_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
         real_r_ptr(m_ptr)->cur_num++;
     }
 
+    invalidate_pet_registry(floor_ptr);
     return 0;
 }
 
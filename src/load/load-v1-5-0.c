@@ -34,6 +34,7 @@
 #include "object-hook/hook-checker.h"
 #include "object-hook/hook-enchant.h"
 #include "object/object-kind-hook.h"
+#include "pet/pet-registry.h"
 #include "sv-definition/sv-armor-types.h"
 #include "sv-definition/sv-lite-types.h"
 #include "system/artifact-type-definition.h"
@@ -771,6 +772,8 @@ errr rd_dungeon_old(player_type *player_ptr)
         real_r_ptr(m_ptr)->cur_num++;
     }
 
+    invalidate_pet_registry(floor_ptr);
+
     if (z_older_than(10, 3, 13) && !floor_ptr->dun_level && !floor_ptr->inside_arena)
         current_world_ptr->character_dungeon = FALSE;
     else
@@ -3,6 +3,7 @@
 #include "load/load-v1-5-0.h"
 #include "load/load-util.h"
 #include "load/savedata-flag-types.h"
+#include "monster/monster-status.h"
 #include "util/quarks.h"
 
 /*!
@@ -15,6 +16,7 @@ void rd_monster(player_type *player_ptr, monster_type *m_ptr)
 {
     if (h_older_than(1, 5, 0, 0)) {
         rd_monster_old(player_ptr, m_ptr);
+        reset_mtimed_stamp(m_ptr);
         return;
     }
 
@@ -139,4 +141,6 @@ void rd_monster(player_type *player_ptr, monster_type *m_ptr)
         rd_s16b(&m_ptr->parent_m_idx);
     else
         m_ptr->parent_m_idx = 0;
+
+    reset_mtimed_stamp(m_ptr);
 }
@@ -0,0 +1,165 @@
+﻿/*!
+ * @brief モンスターの思い出の更新記録 / Journal of monster lore updates
+ * @date 2026/10/19
+ * @details
+ * 戦闘処理のあちこちで行われる思い出の更新を(種族, 項目, フラグ)の組として記録し、
+ * ゲームターンの終わりにまとめて処理する。
+ * 追跡中の種族の思い出が実際に変わったときだけモンスター情報ウィンドウを再描画する。
+ */
+
+#include "lore/lore-journal.h"
+#include "core/window-redrawer.h"
+#include "monster-race/monster-race.h"
+
+/*! 1ターンに記録できる更新の最大数 / Maximum number of events held in one turn */
+#define LORE_JOURNAL_MAX 256
+
+/*!
+ * @brief 思い出の更新1件 / One lore event
+ */
+typedef struct lore_event {
+    MONRACE_IDX r_idx; /*!< 更新された種族 / Race whose lore changed */
+    lore_field_type field; /*!< 更新された項目 / Field that changed */
+    BIT_FLAGS bits; /*!< 新たに判明したフラグ / Newly learnt flags, if any */
+} lore_event;
+
+static lore_event lore_journal[LORE_JOURNAL_MAX];
+static int lore_journal_num;
+static bool lore_journal_overflow;
+
+lore_journal_stats lore_stats;
+
+/*!
+ * @brief 思い出の更新を記録する / Append one event to the journal
+ * @param r_ptr 更新された種族への参照ポインタ
+ * @param field 更新された項目
+ * @param bits 新たに判明したフラグ
+ * @return なし
+ */
+static void record_lore_event(monster_race *r_ptr, lore_field_type field, BIT_FLAGS bits)
+{
+    lore_stats.events[field]++;
+    if (lore_journal_num >= LORE_JOURNAL_MAX) {
+        lore_journal_overflow = TRUE;
+        lore_stats.overflows++;
+        return;
+    }
+
+    lore_event *event = &lore_journal[lore_journal_num++];
+    event->r_idx = (MONRACE_IDX)(r_ptr - r_info);
+    event->field = field;
+    event->bits = bits;
+}
+
+/*!
+ * @brief 種族の思い出にフラグを加える / Learn racial flags
+ * @param r_ptr 種族への参照ポインタ
+ * @param field 加えるフラグの項目 (LORE_FLAGS1～LORE_FLAGSR)
+ * @param flags 加えるフラグ
+ * @return なし
+ * @details 既に知っているフラグだけならば記録しない。
+ */
+void lore_race_flags(monster_race *r_ptr, lore_field_type field, BIT_FLAGS flags)
+{
+    u32b *r_flags;
+    switch (field) {
+    case LORE_FLAGS1:
+        r_flags = &r_ptr->r_flags1;
+        break;
+    case LORE_FLAGS2:
+        r_flags = &r_ptr->r_flags2;
+        break;
+    case LORE_FLAGS3:
+        r_flags = &r_ptr->r_flags3;
+        break;
+    case LORE_FLAGS4:
+        r_flags = &r_ptr->r_flags4;
+        break;
+    case LORE_FLAGS5:
+        r_flags = &r_ptr->r_flags5;
+        break;
+    case LORE_FLAGS6:
+        r_flags = &r_ptr->r_flags6;
+        break;
+    case LORE_FLAGSR:
+        r_flags = &r_ptr->r_flagsr;
+        break;
+    default:
+        return;
+    }
+
+    BIT_FLAGS learnt = flags & ~(*r_flags);
+    if (!learnt)
+        return;
+
+    *r_flags |= learnt;
+    record_lore_event(r_ptr, field, learnt);
+}
+
+/*!
+ * @brief 種族の打撃を目撃した回数を数える / Count one sighting of a blow
+ * @param r_ptr 種族への参照ポインタ
+ * @param blow_idx 打撃の番号
+ * @return なし
+ */
+void lore_race_blow(monster_race *r_ptr, int blow_idx)
+{
+    if (r_ptr->r_blows[blow_idx] >= MAX_UCHAR)
+        return;
+
+    r_ptr->r_blows[blow_idx]++;
+    record_lore_event(r_ptr, LORE_BLOWS, 0);
+}
+
+/*!
+ * @brief 種族の魔法を目撃した回数を数える / Count one sighting of a spell
+ * @param r_ptr 種族への参照ポインタ
+ * @return なし
+ */
+void lore_race_spell(monster_race *r_ptr)
+{
+    if (r_ptr->r_cast_spell >= MAX_UCHAR)
+        return;
+
+    r_ptr->r_cast_spell++;
+    record_lore_event(r_ptr, LORE_CAST_SPELL, 0);
+}
+
+/*!
+ * @brief 種族の撃破数が変わったことを記録する / Note that a race's kill counts changed
+ * @param r_ptr 種族への参照ポインタ
+ * @return なし
+ * @details 撃破数そのものは呼び出し側で数える。
+ */
+void lore_race_kill(monster_race *r_ptr)
+{
+    record_lore_event(r_ptr, LORE_KILLS, 0);
+}
+
+/*!
+ * @brief ターン中の思い出の更新をまとめて処理する / Coalesce the journal at the end of a game turn
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+void flush_lore_journal(player_type *player_ptr)
+{
+    if (!lore_journal_num && !lore_journal_overflow)
+        return;
+
+    lore_stats.flushes++;
+    bool redraw = lore_journal_overflow;
+    for (int i = 0; i < lore_journal_num; i++) {
+        lore_event *event = &lore_journal[i];
+        lore_stats.bits[event->field] += count_bits(event->bits);
+        if (event->r_idx == player_ptr->monster_race_idx)
+            redraw = TRUE;
+    }
+
+    lore_journal_num = 0;
+    lore_journal_overflow = FALSE;
+    if (!redraw || !player_ptr->monster_race_idx)
+        return;
+
+    player_ptr->window |= PW_MONSTER;
+    lore_stats.redraws++;
+}
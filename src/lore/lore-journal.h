@@ -0,0 +1,40 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "system/monster-race-definition.h"
+
+/*!
+ * @brief 思い出の項目 / Lore fields recorded by the journal
+ */
+typedef enum lore_field_type {
+    LORE_FLAGS1 = 0,
+    LORE_FLAGS2 = 1,
+    LORE_FLAGS3 = 2,
+    LORE_FLAGS4 = 3,
+    LORE_FLAGS5 = 4,
+    LORE_FLAGS6 = 5,
+    LORE_FLAGSR = 6,
+    LORE_BLOWS = 7,
+    LORE_CAST_SPELL = 8,
+    LORE_KILLS = 9,
+    LORE_FIELD_MAX = 10,
+} lore_field_type;
+
+/*!
+ * @brief 思い出の更新の統計 / Lore-change statistics gathered by the journal
+ */
+typedef struct lore_journal_stats {
+    u32b events[LORE_FIELD_MAX]; /*!< 記録された更新の数 / Events recorded per field */
+    u32b bits[LORE_FIELD_MAX]; /*!< 新たに判明したフラグの数 / New flag bits learnt per field */
+    u32b flushes; /*!< 更新のあったターン数 / Turns that had at least one event */
+    u32b redraws; /*!< 追跡中の種族の再描画を要求した回数 / Redraws requested for the tracked race */
+    u32b overflows; /*!< 溢れて捨てた更新の数 / Events dropped because the journal was full */
+} lore_journal_stats;
+
+extern lore_journal_stats lore_stats;
+
+void lore_race_flags(monster_race *r_ptr, lore_field_type field, BIT_FLAGS flags);
+void lore_race_blow(monster_race *r_ptr, int blow_idx);
+void lore_race_spell(monster_race *r_ptr);
+void lore_race_kill(monster_race *r_ptr);
+void flush_lore_journal(player_type *player_ptr);
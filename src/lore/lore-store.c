@@ -6,6 +6,7 @@
 
 #include "lore/lore-store.h"
 #include "core/window-redrawer.h"
+#include "lore/lore-journal.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/monster-race.h"
 #include "monster/monster-info.h"
@@ -114,9 +115,9 @@ void lore_treasure(player_type *player_ptr, MONSTER_IDX m_idx, ITEM_NUMBER num_i
         r_ptr->r_drop_gold = num_gold;
 
     if (r_ptr->flags1 & (RF1_DROP_GOOD))
-        r_ptr->r_flags1 |= (RF1_DROP_GOOD);
+        lore_race_flags(r_ptr, LORE_FLAGS1, RF1_DROP_GOOD);
     if (r_ptr->flags1 & (RF1_DROP_GREAT))
-        r_ptr->r_flags1 |= (RF1_DROP_GREAT);
+        lore_race_flags(r_ptr, LORE_FLAGS1, RF1_DROP_GREAT);
     if (player_ptr->monster_race_idx == m_ptr->r_idx)
         player_ptr->window |= (PW_MONSTER);
 }
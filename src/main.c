@@ -250,6 +250,7 @@ static void display_usage(void)
     puts("  -u<who>  Use your <who> savefile");
     puts("  -m<sys>  Force 'main-<sys>.c' usage");
     puts("  -d<def>  Define a 'lib' dir sub-path");
+    puts("  -l<num>[,<dep>]  Profile <num> floors per level to benchmark.txt and quit");
     puts("");
 
 #ifdef USE_X11
@@ -435,6 +436,20 @@ int main(int argc, char *argv[])
             change_path(&argv[i][2]);
             break;
         }
+        case 'l':
+        case 'L': {
+            arg_generation_floors = atoi(&argv[i][2]);
+            if (arg_generation_floors <= 0) {
+                is_usage_needed = TRUE;
+                break;
+            }
+
+            concptr depth = angband_strchr(&argv[i][2], ',');
+            if (depth)
+                arg_generation_depth = (DEPTH)atoi(depth + 1);
+
+            break;
+        }
         case 'x': {
             if (!argv[i][2]) {
                 is_usage_needed = TRUE;
@@ -534,8 +549,9 @@ int main(int argc, char *argv[])
     /* Initialize */
     init_angband(p_ptr, process_autopick_file_command);
 
-    /* Wait for response */
-    pause_line(23);
+    /* Wait for response, unless profiling the floor generation unattended */
+    if (arg_generation_floors <= 0)
+        pause_line(23);
 
     /* Play the game */
     play_game(p_ptr, new_game, browsing_movie);
@@ -12,7 +12,9 @@
  */
 
 #include "main/angband-initializer.h"
+#include "artifact/fixed-art-generator.h"
 #include "dungeon/dungeon.h"
+#include "floor/geometry-table.h"
 #include "floor/wild.h"
 #include "info-reader/feature-reader.h"
 #include "io/files-util.h"
@@ -23,6 +25,7 @@
 #include "market/building-initializer.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags7.h"
+#include "object-enchant/object-ego.h"
 #include "system/angband-version.h"
 #include "system/system-variables.h"
 #include "term/screen-processor.h"
@@ -199,6 +202,7 @@ void init_angband(player_type *player_ptr, process_autopick_file_command_pf proc
     put_title();
 
     init_note(_("[変数を初期化しています...(その他)", "[Initializing values... (misc)]"));
+    init_geometry_tables();
     if (init_misc(player_ptr))
         quit(_("その他の変数を初期化できません", "Cannot initialize misc. values"));
 
@@ -216,10 +220,12 @@ void init_angband(player_type *player_ptr, process_autopick_file_command_pf proc
     init_note(_("[データの初期化中... (伝説のアイテム)]", "[Initializing arrays... (artifacts)]"));
     if (init_a_info(player_ptr))
         quit(_("伝説のアイテム初期化不能", "Cannot initialize artifacts"));
+    init_artifact_candidates();
 
     init_note(_("[データの初期化中... (名のあるアイテム)]", "[Initializing arrays... (ego-items)]"));
     if (init_e_info(player_ptr))
         quit(_("名のあるアイテム初期化不能", "Cannot initialize ego-items"));
+    init_ego_candidates();
 
     init_note(_("[データの初期化中... (モンスター)]", "[Initializing arrays... (monsters)]"));
     if (init_r_info(player_ptr))
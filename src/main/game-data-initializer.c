@@ -7,6 +7,7 @@
 #include "game-option/option-types-table.h"
 #include "grid/grid.h"
 #include "monster-race/monster-race.h"
+#include "monster/monster-status.h"
 #include "object/object-kind.h"
 #include "system/alloc-entries.h"
 #include "system/floor-type-definition.h"
@@ -48,8 +49,10 @@ errr init_other(player_type *player_ptr)
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     C_MAKE(floor_ptr->o_list, current_world_ptr->max_o_idx, object_type);
     C_MAKE(floor_ptr->m_list, current_world_ptr->max_m_idx, monster_type);
-    for (int i = 0; i < MAX_MTIMED; i++)
-        C_MAKE(floor_ptr->mproc_list[i], current_world_ptr->max_m_idx, s16b);
+    make_mproc_lists(floor_ptr);
+    C_MAKE(floor_ptr->pet_list, current_world_ptr->max_m_idx, s16b);
+    make_slot_list(&floor_ptr->o_slots, current_world_ptr->max_o_idx);
+    make_slot_list(&floor_ptr->m_slots, current_world_ptr->max_m_idx);
 
     C_MAKE(max_dlv, current_world_ptr->max_d_idx, DEPTH);
     for (int i = 0; i < MAX_HGT; i++)
@@ -63,6 +66,7 @@ errr init_other(player_type *player_ptr)
 
     C_MAKE(message__ptr, MESSAGE_MAX, u32b);
     C_MAKE(message__buf, MESSAGE_BUF, char);
+    C_MAKE(message__hash, MESSAGE_MAX, u32b);
     message__tail = MESSAGE_BUF;
 
     for (int i = 0; option_info[i].o_desc; i++) {
@@ -206,6 +206,7 @@ void today_target(player_type *player_ptr)
     sprintf(buf, _("骨   ---- $%d", "skeleton ---- $%d"), (int)r_ptr->level * 30 + 60);
     prt(buf, 9, 10);
     player_ptr->today_mon = today_mon;
+    update_object_state_version();
 }
 
 /*!
@@ -301,6 +302,8 @@ void determine_daily_bounty(player_type *player_ptr, bool conv_old)
             continue;
         break;
     }
+
+    update_object_state_version();
 }
 
 /*!
@@ -350,4 +353,6 @@ void determine_bounty_uniques(player_type *player_ptr)
             }
         }
     }
+
+    update_object_state_version();
 }
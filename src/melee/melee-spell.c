@@ -1,6 +1,7 @@
 ﻿#include "melee/melee-spell.h"
 #include "core/disturbance.h"
 #include "core/player-redraw-types.h"
+#include "lore/lore-journal.h"
 #include "melee/melee-spell-flags-checker.h"
 #include "melee/melee-spell-util.h"
 #include "monster-race/monster-race.h"
@@ -79,25 +80,22 @@ static void process_rememberance(melee_spell_type *ms_ptr)
         return;
 
     if (ms_ptr->thrown_spell < RF4_SPELL_START + RF4_SPELL_SIZE) {
-        ms_ptr->r_ptr->r_flags4 |= (1L << (ms_ptr->thrown_spell - RF4_SPELL_START));
-        if (ms_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            ms_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(ms_ptr->r_ptr, LORE_FLAGS4, 1L << (ms_ptr->thrown_spell - RF4_SPELL_START));
+        lore_race_spell(ms_ptr->r_ptr);
 
         return;
     }
     
     if (ms_ptr->thrown_spell < RF5_SPELL_START + RF5_SPELL_SIZE) {
-        ms_ptr->r_ptr->r_flags5 |= (1L << (ms_ptr->thrown_spell - RF5_SPELL_START));
-        if (ms_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            ms_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(ms_ptr->r_ptr, LORE_FLAGS5, 1L << (ms_ptr->thrown_spell - RF5_SPELL_START));
+        lore_race_spell(ms_ptr->r_ptr);
 
         return;
     }
     
     if (ms_ptr->thrown_spell < RF6_SPELL_START + RF6_SPELL_SIZE) {
-        ms_ptr->r_ptr->r_flags6 |= (1L << (ms_ptr->thrown_spell - RF6_SPELL_START));
-        if (ms_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            ms_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(ms_ptr->r_ptr, LORE_FLAGS6, 1L << (ms_ptr->thrown_spell - RF6_SPELL_START));
+        lore_race_spell(ms_ptr->r_ptr);
     }
 }
 
@@ -13,6 +13,7 @@
 #include "dungeon/dungeon.h"
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "melee/melee-postprocess.h"
@@ -84,7 +85,7 @@ static void aura_fire_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         return;
 
     if (((r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK) != 0) && is_original_ap_and_seen(subject_ptr, mam_ptr->m_ptr)) {
-        r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
+        lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
         return;
     }
 
@@ -92,7 +93,7 @@ static void aura_fire_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         msg_format(_("%^sは突然熱くなった！", "%^s is suddenly very hot!"), mam_ptr->m_name);
 
     if (mam_ptr->m_ptr->ml && is_original_ap_and_seen(subject_ptr, mam_ptr->t_ptr))
-        tr_ptr->r_flags2 |= RF2_AURA_FIRE;
+        lore_race_flags(tr_ptr, LORE_FLAGS2, RF2_AURA_FIRE);
 
     project(subject_ptr, mam_ptr->t_idx, 0, mam_ptr->m_ptr->fy, mam_ptr->m_ptr->fx, damroll(1 + ((tr_ptr->level) / 26), 1 + ((tr_ptr->level) / 17)), GF_FIRE,
         PROJECT_KILL | PROJECT_STOP | PROJECT_AIMED, -1);
@@ -106,7 +107,7 @@ static void aura_cold_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         return;
 
     if (((r_ptr->flagsr & RFR_EFF_IM_COLD_MASK) != 0) && is_original_ap_and_seen(subject_ptr, mam_ptr->m_ptr)) {
-        r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
+        lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
         return;
     }
 
@@ -114,7 +115,7 @@ static void aura_cold_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         msg_format(_("%^sは突然寒くなった！", "%^s is suddenly very cold!"), mam_ptr->m_name);
 
     if (mam_ptr->m_ptr->ml && is_original_ap_and_seen(subject_ptr, mam_ptr->t_ptr))
-        tr_ptr->r_flags3 |= RF3_AURA_COLD;
+        lore_race_flags(tr_ptr, LORE_FLAGS3, RF3_AURA_COLD);
 
     project(subject_ptr, mam_ptr->t_idx, 0, mam_ptr->m_ptr->fy, mam_ptr->m_ptr->fx, damroll(1 + ((tr_ptr->level) / 26), 1 + ((tr_ptr->level) / 17)), GF_COLD,
         PROJECT_KILL | PROJECT_STOP | PROJECT_AIMED, -1);
@@ -128,7 +129,7 @@ static void aura_elec_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         return;
 
     if (((r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK) != 0) && is_original_ap_and_seen(subject_ptr, mam_ptr->m_ptr)) {
-        r_ptr->r_flagsr |= (r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
+        lore_race_flags(r_ptr, LORE_FLAGSR, r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
         return;
     }
 
@@ -136,7 +137,7 @@ static void aura_elec_by_melee(player_type *subject_ptr, mam_type *mam_ptr)
         msg_format(_("%^sは電撃を食らった！", "%^s gets zapped!"), mam_ptr->m_name);
 
     if (mam_ptr->m_ptr->ml && is_original_ap_and_seen(subject_ptr, mam_ptr->t_ptr))
-        tr_ptr->r_flags2 |= RF2_AURA_ELEC;
+        lore_race_flags(tr_ptr, LORE_FLAGS2, RF2_AURA_ELEC);
 
     project(subject_ptr, mam_ptr->t_idx, 0, mam_ptr->m_ptr->fy, mam_ptr->m_ptr->fx, damroll(1 + ((tr_ptr->level) / 26), 1 + ((tr_ptr->level) / 17)), GF_ELEC,
         PROJECT_KILL | PROJECT_STOP | PROJECT_AIMED, -1);
@@ -289,8 +290,7 @@ void repeat_melee(player_type *subject_ptr, mam_type *mam_ptr)
         if (!mam_ptr->obvious && !mam_ptr->damage && (r_ptr->r_blows[mam_ptr->ap_cnt] <= 10))
             continue;
 
-        if (r_ptr->r_blows[mam_ptr->ap_cnt] < MAX_UCHAR)
-            r_ptr->r_blows[mam_ptr->ap_cnt]++;
+        lore_race_blow(r_ptr, mam_ptr->ap_cnt);
     }
 }
 
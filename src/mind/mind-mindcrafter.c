@@ -15,6 +15,7 @@
 #include "object-enchant/item-feeling.h"
 #include "object-enchant/special-object-flags.h"
 #include "object/item-use-flags.h"
+#include "object/object-info.h"
 #include "object/object-mark-types.h"
 #include "perception/object-perception.h"
 #include "perception/simple-perception.h"
@@ -81,6 +82,7 @@ bool psychometry(player_type *caster_ptr)
 
     o_ptr->ident |= (IDENT_SENSE);
     o_ptr->feeling = feel;
+    update_object_state_version();
     o_ptr->marked |= OM_TOUCHED;
 
     caster_ptr->update |= (PU_COMBINE | PU_REORDER);
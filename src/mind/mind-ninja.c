@@ -342,9 +342,7 @@ bool cast_ninja_spell(player_type *caster_ptr, mind_ninja_type spell)
 
         detect_monsters_normal(caster_ptr, DETECT_RAD_DEFAULT);
         if (plev > 4) {
-            detect_traps(caster_ptr, DETECT_RAD_DEFAULT, TRUE);
-            detect_doors(caster_ptr, DETECT_RAD_DEFAULT);
-            detect_stairs(caster_ptr, DETECT_RAD_DEFAULT);
+            detect_grids(caster_ptr, DETECT_RAD_DEFAULT, DETECT_GRID_FEATURES);
         }
 
         if (plev > 14)
@@ -12,6 +12,7 @@
 #include "core/player-update-types.h"
 #include "inventory/inventory-slot-types.h"
 #include "io/input-key-acceptor.h"
+#include "lore/lore-journal.h"
 #include "mind/stances-table.h"
 #include "monster-race/monster-race-hook.h"
 #include "monster-race/monster-race.h"
@@ -63,7 +64,7 @@ static void hissatsu_burning_strike(player_type *attacker_ptr, samurai_slaying_t
     /* Notice immunity */
     if (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK) {
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flagsr |= (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGSR, samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_FIRE_MASK);
 
         return;
     }
@@ -75,7 +76,7 @@ static void hissatsu_burning_strike(player_type *attacker_ptr, samurai_slaying_t
                 samurai_slaying_ptr->mult = 70;
 
             if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-                samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_HURT_FIRE;
+                lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_FIRE);
 
         } else if (samurai_slaying_ptr->mult < 35)
             samurai_slaying_ptr->mult = 35;
@@ -88,7 +89,7 @@ static void hissatsu_burning_strike(player_type *attacker_ptr, samurai_slaying_t
             samurai_slaying_ptr->mult = 50;
 
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_HURT_FIRE;
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_FIRE);
     } else if (samurai_slaying_ptr->mult < 25)
         samurai_slaying_ptr->mult = 25;
 }
@@ -107,7 +108,7 @@ static void hissatsu_serpent_tongue(player_type *attacker_ptr, samurai_slaying_t
     /* Notice immunity */
     if (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_POIS_MASK) {
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flagsr |= (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_POIS_MASK);
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGSR, samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_POIS_MASK);
 
         return;
     }
@@ -151,7 +152,7 @@ static void hissatsu_rock_smash(player_type *attacker_ptr, samurai_slaying_type
 
     if (samurai_slaying_ptr->r_ptr->flags3 & RF3_HURT_ROCK) {
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_HURT_ROCK;
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_ROCK);
 
         if (samurai_slaying_ptr->mult == 10)
             samurai_slaying_ptr->mult = 40;
@@ -174,7 +175,7 @@ static void hissatsu_midare_setsugetsuka(player_type *attacker_ptr, samurai_slay
     /* Notice immunity */
     if (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_COLD_MASK) {
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flagsr |= (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGSR, samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_COLD_MASK);
 
         return;
     }
@@ -186,7 +187,7 @@ static void hissatsu_midare_setsugetsuka(player_type *attacker_ptr, samurai_slay
                 samurai_slaying_ptr->mult = 70;
 
             if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-                samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_HURT_COLD;
+                lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_COLD);
         } else if (samurai_slaying_ptr->mult < 35)
             samurai_slaying_ptr->mult = 35;
 
@@ -198,7 +199,7 @@ static void hissatsu_midare_setsugetsuka(player_type *attacker_ptr, samurai_slay
             samurai_slaying_ptr->mult = 50;
 
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_HURT_COLD;
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_HURT_COLD);
     } else if (samurai_slaying_ptr->mult < 25)
         samurai_slaying_ptr->mult = 25;
 }
@@ -217,7 +218,7 @@ static void hissatsu_lightning_eagle(player_type *attacker_ptr, samurai_slaying_
     /* Notice immunity */
     if (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK) {
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr))
-            samurai_slaying_ptr->r_ptr->r_flagsr |= (samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGSR, samurai_slaying_ptr->r_ptr->flagsr & RFR_EFF_IM_ELEC_MASK);
 
         return;
     }
@@ -258,7 +259,7 @@ static void hissatsu_keiun_kininken(player_type *attacker_ptr, samurai_slaying_t
 
     if (samurai_slaying_ptr->r_ptr->flags3 & RF3_UNDEAD)
         if (is_original_ap_and_seen(attacker_ptr, samurai_slaying_ptr->m_ptr)) {
-            samurai_slaying_ptr->r_ptr->r_flags3 |= RF3_UNDEAD;
+            lore_race_flags(samurai_slaying_ptr->r_ptr, LORE_FLAGS3, RF3_UNDEAD);
 
             if (samurai_slaying_ptr->mult == 10)
                 samurai_slaying_ptr->mult = 70;
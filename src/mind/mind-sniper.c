@@ -18,6 +18,7 @@
 #include "inventory/inventory-slot-types.h"
 #include "io/command-repeater.h"
 #include "io/input-key-requester.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "mind/snipe-types.h"
@@ -418,14 +419,14 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 		if (r_ptr->flags3 & (RF3_HURT_LITE))
 		{
 			MULTIPLY n = 20 + sniper_ptr->concent;
-			if (seen) r_ptr->r_flags3 |= (RF3_HURT_LITE);
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_HURT_LITE);
 			if (mult < n) mult = n;
 		}
 		break;
 	case SP_FIRE:
 		if (r_ptr->flagsr & RFR_IM_FIRE)
 		{
-			if (seen) r_ptr->r_flagsr |= RFR_IM_FIRE;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGSR, RFR_IM_FIRE);
 		}
 		else
 		{
@@ -436,7 +437,7 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 	case SP_COLD:
 		if (r_ptr->flagsr & RFR_IM_COLD)
 		{
-			if (seen) r_ptr->r_flagsr |= RFR_IM_COLD;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGSR, RFR_IM_COLD);
 		}
 		else
 		{
@@ -447,7 +448,7 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 	case SP_ELEC:
 		if (r_ptr->flagsr & RFR_IM_ELEC)
 		{
-			if (seen) r_ptr->r_flagsr |= RFR_IM_ELEC;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGSR, RFR_IM_ELEC);
 		}
 		else
 		{
@@ -459,13 +460,13 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 		if (r_ptr->flags3 & RF3_HURT_ROCK)
 		{
 			MULTIPLY n = 15 + (sniper_ptr->concent * 2);
-			if (seen) r_ptr->r_flags3 |= RF3_HURT_ROCK;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_HURT_ROCK);
 			if (mult < n) mult = n;
 		}
 		else if (r_ptr->flags3 & RF3_NONLIVING)
 		{
 			MULTIPLY n = 15 + (sniper_ptr->concent * 2);
-			if (seen) r_ptr->r_flags3 |= RF3_NONLIVING;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_NONLIVING);
 			if (mult < n) mult = n;
 		}
 		break;
@@ -473,7 +474,7 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 		if (r_ptr->flags3 & RF3_GOOD)
 		{
 			MULTIPLY n = 15 + (sniper_ptr->concent * 4);
-			if (seen) r_ptr->r_flags3 |= RF3_GOOD;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_GOOD);
 			if (mult < n) mult = n;
 		}
 		break;
@@ -481,11 +482,11 @@ MULTIPLY calc_snipe_damage_with_slay(player_type *sniper_ptr, MULTIPLY mult, mon
 		if (r_ptr->flags3 & RF3_EVIL)
 		{
 			MULTIPLY n = 12 + (sniper_ptr->concent * 3);
-			if (seen) r_ptr->r_flags3 |= RF3_EVIL;
+			if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
 			if (r_ptr->flags3 & (RF3_HURT_LITE))
 			{
 				n += (sniper_ptr->concent * 3);
-				if (seen) r_ptr->r_flags3 |= (RF3_HURT_LITE);
+				if (seen) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_HURT_LITE);
 			}
 			if (mult < n) mult = n;
 		}
@@ -19,6 +19,7 @@
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
 #include "inventory/inventory-slot-types.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "mind/mind-ninja.h"
@@ -107,7 +108,7 @@ static bool effect_protecion_from_evil(player_type *target_ptr, monap_type *mona
         return FALSE;
 
     if (is_original_ap_and_seen(target_ptr, monap_ptr->m_ptr))
-        r_ptr->r_flags3 |= RF3_EVIL;
+        lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
 
 #ifdef JP
     if (monap_ptr->abbreviate)
@@ -365,8 +366,7 @@ static void increase_blow_type_seen(player_type *target_ptr, monap_type *monap_p
     if (!monap_ptr->obvious && (monap_ptr->damage == 0) && (r_ptr->r_blows[monap_ptr->ap_cnt] <= 10))
         return;
 
-    if (r_ptr->r_blows[monap_ptr->ap_cnt] < MAX_UCHAR)
-        r_ptr->r_blows[monap_ptr->ap_cnt]++;
+    lore_race_blow(r_ptr, monap_ptr->ap_cnt);
 }
 
 static bool process_monster_blows(player_type *target_ptr, monap_type *monap_ptr)
@@ -491,7 +491,10 @@ bool make_attack_normal(player_type *target_ptr, MONSTER_IDX m_idx)
     }
 
     monap_ptr->blinked = FALSE;
-    if (process_monster_blows(target_ptr, monap_ptr))
+    msg_batch_begin();
+    bool escaped = process_monster_blows(target_ptr, monap_ptr);
+    msg_batch_end();
+    if (escaped)
         return TRUE;
 
     postprocess_monster_blows(target_ptr, monap_ptr);
@@ -8,6 +8,7 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "floor/cave.h"
+#include "lore/lore-journal.h"
 #include "melee/monster-attack-monster.h"
 #include "monster-attack/monster-attack-player.h"
 #include "monster-race/monster-race.h"
@@ -38,7 +39,7 @@ void exe_monster_attack_to_player(player_type *target_ptr, turn_flags *turn_flag
 
     if (r_ptr->flags1 & RF1_NEVER_BLOW) {
         if (is_original_ap_and_seen(target_ptr, m_ptr))
-            r_ptr->r_flags1 |= (RF1_NEVER_BLOW);
+            lore_race_flags(r_ptr, LORE_FLAGS1, RF1_NEVER_BLOW);
 
         turn_flags_ptr->do_move = FALSE;
     }
@@ -47,7 +48,7 @@ void exe_monster_attack_to_player(player_type *target_ptr, turn_flags *turn_flag
         if (!(r_ptr->flags2 & RF2_STUPID))
             turn_flags_ptr->do_move = FALSE;
         else if (is_original_ap_and_seen(target_ptr, m_ptr))
-            r_ptr->r_flags2 |= (RF2_STUPID);
+            lore_race_flags(r_ptr, LORE_FLAGS2, RF2_STUPID);
     }
 
     if (!turn_flags_ptr->do_move)
@@ -76,7 +77,7 @@ static bool exe_monster_attack_to_monster(player_type *target_ptr, MONSTER_IDX m
         return FALSE;
 
     if (((r_ptr->flags2 & RF2_KILL_BODY) == 0) && is_original_ap_and_seen(target_ptr, m_ptr))
-        r_ptr->r_flags2 |= (RF2_KILL_BODY);
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_KILL_BODY);
 
     if ((y_ptr->r_idx == 0) || (y_ptr->hp < 0))
         return FALSE;
@@ -90,7 +91,7 @@ static bool exe_monster_attack_to_monster(player_type *target_ptr, MONSTER_IDX m
         return FALSE;
 
     if (is_original_ap_and_seen(target_ptr, m_ptr))
-        r_ptr->r_flags2 |= (RF2_STUPID);
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_STUPID);
 
     return TRUE;
 }
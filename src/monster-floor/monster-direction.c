@@ -6,6 +6,8 @@
 
 #include "monster-floor/monster-direction.h"
 #include "floor/cave.h"
+#include "floor/floor-slot-list.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster-race/race-flags2.h"
@@ -107,7 +109,7 @@ bool get_enemy_dir(player_type *target_ptr, MONSTER_IDX m_idx, int *mm)
 	monster_type *m_ptr = &floor_ptr->m_list[m_idx];
 
 	POSITION x = 0, y = 0;
-	if (target_ptr->riding_t_m_idx && player_bold(target_ptr, m_ptr->fy, m_ptr->fx))
+	if (is_slot_current(&floor_ptr->m_slots, target_ptr->riding_t_m_idx, target_ptr->riding_t_m_generation) && player_bold(target_ptr, m_ptr->fy, m_ptr->fx))
 	{
 		y = floor_ptr->m_list[target_ptr->riding_t_m_idx].fy;
 		x = floor_ptr->m_list[target_ptr->riding_t_m_idx].fx;
@@ -157,7 +159,7 @@ static bool random_walk(player_type *target_ptr, DIRECTION *mm, monster_type *m_
 	monster_race *r_ptr = &r_info[m_ptr->r_idx];
 	if (((r_ptr->flags1 & (RF1_RAND_50 | RF1_RAND_25)) == (RF1_RAND_50 | RF1_RAND_25)) && (randint0(100) < 75))
 	{
-		if (is_original_ap_and_seen(target_ptr, m_ptr)) r_ptr->r_flags1 |= (RF1_RAND_50 | RF1_RAND_25);
+		if (is_original_ap_and_seen(target_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGS1, RF1_RAND_50 | RF1_RAND_25);
 
 		mm[0] = mm[1] = mm[2] = mm[3] = 5;
 		return TRUE;
@@ -165,7 +167,7 @@ static bool random_walk(player_type *target_ptr, DIRECTION *mm, monster_type *m_
 
 	if ((r_ptr->flags1 & RF1_RAND_50) && (randint0(100) < 50))
 	{
-		if (is_original_ap_and_seen(target_ptr, m_ptr)) r_ptr->r_flags1 |= RF1_RAND_50;
+		if (is_original_ap_and_seen(target_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGS1, RF1_RAND_50);
 
 		mm[0] = mm[1] = mm[2] = mm[3] = 5;
 		return TRUE;
@@ -173,7 +175,7 @@ static bool random_walk(player_type *target_ptr, DIRECTION *mm, monster_type *m_
 
 	if ((r_ptr->flags1 & RF1_RAND_25) && (randint0(100) < 25))
 	{
-		if (is_original_ap_and_seen(target_ptr, m_ptr)) r_ptr->r_flags1 |= RF1_RAND_25;
+		if (is_original_ap_and_seen(target_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGS1, RF1_RAND_25);
 
 		mm[0] = mm[1] = mm[2] = mm[3] = 5;
 		return TRUE;
@@ -1,6 +0,0 @@
-#pragma once
-
-#include "system/angband.h"
-
-extern const POSITION *dist_offsets_y[10];
-extern const POSITION *dist_offsets_x[10];
@@ -15,6 +15,7 @@
 #include "game-option/disturbance-options.h"
 #include "grid/feature.h"
 #include "io/files-util.h"
+#include "lore/lore-journal.h"
 #include "monster-attack/monster-attack-processor.h"
 #include "monster-floor/monster-object.h"
 #include "monster-race/monster-race.h"
@@ -188,7 +189,7 @@ static bool process_door(player_type *target_ptr, turn_flags *turn_flags_ptr, mo
             target_ptr->update |= (PU_FLOW);
             target_ptr->window |= (PW_OVERHEAD | PW_DUNGEON);
             if (is_original_ap_and_seen(target_ptr, m_ptr))
-                r_ptr->r_flags2 |= (RF2_BASH_DOOR);
+                lore_race_flags(r_ptr, LORE_FLAGS2, RF2_BASH_DOOR);
 
             return FALSE;
         }
@@ -311,7 +312,7 @@ static bool process_post_dig_wall(player_type *target_ptr, turn_flags *turn_flag
         target_ptr->update |= (PU_FLOW);
         target_ptr->window |= (PW_OVERHEAD | PW_DUNGEON);
         if (is_original_ap_and_seen(target_ptr, m_ptr))
-            r_ptr->r_flags2 |= (RF2_KILL_WALL);
+            lore_race_flags(r_ptr, LORE_FLAGS2, RF2_KILL_WALL);
 
         return FALSE;
     }
@@ -392,7 +393,7 @@ bool process_monster_movement(player_type *target_ptr, turn_flags *turn_flags_pt
 
         if (turn_flags_ptr->do_move && (r_ptr->flags1 & RF1_NEVER_MOVE)) {
             if (is_original_ap_and_seen(target_ptr, m_ptr))
-                r_ptr->r_flags1 |= (RF1_NEVER_MOVE);
+                lore_race_flags(r_ptr, LORE_FLAGS1, RF1_NEVER_MOVE);
 
             turn_flags_ptr->do_move = FALSE;
         }
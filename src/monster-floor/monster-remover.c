@@ -11,6 +11,7 @@
 #include "monster/monster-info.h"
 #include "monster/monster-status-setter.h"
 #include "monster/monster-status.h"
+#include "pet/pet-registry.h"
 #include "system/floor-type-definition.h"
 #include "system/monster-type-definition.h"
 #include "system/object-type-definition.h"
@@ -65,6 +66,7 @@ void delete_monster_idx(player_type *player_ptr, MONSTER_IDX i)
     if (player_ptr->riding == i)
         player_ptr->riding = 0;
 
+    remove_pet_registry(floor_ptr, i);
     floor_ptr->grid_array[y][x].m_idx = 0;
     OBJECT_IDX next_o_idx = 0;
     for (OBJECT_IDX this_o_idx = m_ptr->hold_o_idx; this_o_idx; this_o_idx = next_o_idx) {
@@ -75,6 +77,7 @@ void delete_monster_idx(player_type *player_ptr, MONSTER_IDX i)
     }
 
     (void)WIPE(m_ptr, monster_type);
+    release_slot(&floor_ptr->m_slots, i);
     floor_ptr->m_cnt--;
     lite_spot(player_ptr, y, x);
     if (r_ptr->flags7 & (RF7_LITE_MASK | RF7_DARK_MASK)) {
@@ -128,10 +131,12 @@ void wipe_monsters_list(player_type *player_ptr)
     for (int i = 1; i < max_r_idx; i++)
         r_info[i].cur_num = 0;
 
+    reset_slot_list(&floor_ptr->m_slots, floor_ptr->m_max);
     floor_ptr->m_max = 1;
     floor_ptr->m_cnt = 0;
-    for (int i = 0; i < MAX_MTIMED; i++)
-        floor_ptr->mproc_max[i] = 0;
+    mproc_clear(floor_ptr);
+
+    reset_pet_registry(floor_ptr);
 
     floor_ptr->num_repro = 0;
     target_who = 0;
@@ -6,8 +6,8 @@
 
 #include "monster-floor/monster-safety-hiding.h"
 #include "floor/cave.h"
+#include "floor/geometry-table.h"
 #include "grid/grid.h"
-#include "monster-floor/monster-dist-offsets.h"
 #include "monster-race/monster-race.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
@@ -15,6 +15,36 @@
 #include "system/floor-type-definition.h"
 #include "target/projection-path-calculator.h"
 
+/*! 1度にまとめて射線を判定するグリッドの数 (距離9の輪で56グリッド) / Grids whose projectability is judged in one batch */
+#define MAX_SWEEP_GRIDS 64
+
+/*!
+ * @brief 候補グリッドのうちプレーヤーの射線が通らない最も遠い地点を選ぶ
+ * @param target_ptr プレーヤーへの参照ポインタ
+ * @param ys 候補グリッドのY座標
+ * @param xs 候補グリッドのX座標
+ * @param num 候補グリッドの数
+ * @param candidate 逃げ込める地点の候補地
+ * @return なし
+ */
+static void pick_safe_coordinate(player_type *target_ptr, const POSITION *ys, const POSITION *xs, int num, coordinate_candidate *candidate)
+{
+	bool exposed[MAX_SWEEP_GRIDS];
+	projectable_targets(target_ptr, target_ptr->y, target_ptr->x, num, ys, xs, exposed);
+	for (int i = 0; i < num; i++)
+	{
+		if (exposed[i]) continue;
+
+		POSITION dis = distance(ys[i], xs[i], target_ptr->y, target_ptr->x);
+		if (dis <= candidate->gdis) continue;
+
+		candidate->gy = ys[i];
+		candidate->gx = xs[i];
+		candidate->gdis = dis;
+	}
+}
+
+
  /*!
   * @brief モンスターが逃げ込める地点を走査する
   * @param target_ptr プレーヤーへの参照ポインタ
@@ -23,12 +53,16 @@
   * @param x_offsets
   * @param d モンスターがいる地点からの距離
   * @return 逃げ込める地点の候補地
+  * @details 移動できる地点を集めてから、プレーヤーからの射線をまとめて判定する。
   */
 static coordinate_candidate sweep_safe_coordinate(player_type *target_ptr, MONSTER_IDX m_idx, const POSITION *y_offsets, const POSITION *x_offsets, int d)
 {
 	coordinate_candidate candidate = init_coordinate_candidate();
 	floor_type *floor_ptr = target_ptr->current_floor_ptr;
 	monster_type *m_ptr = &target_ptr->current_floor_ptr->m_list[m_idx];
+	POSITION ys[MAX_SWEEP_GRIDS];
+	POSITION xs[MAX_SWEEP_GRIDS];
+	int num = 0;
 	for (POSITION i = 0, dx = x_offsets[0], dy = y_offsets[0];
 		dx != 0 || dy != 0;
 		i++, dx = x_offsets[i], dy = y_offsets[i])
@@ -50,16 +84,15 @@ static coordinate_candidate sweep_safe_coordinate(player_type *target_ptr, MONST
 			if (g_ptr->dist > floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].dist + 2 * d) continue;
 		}
 
-		if (projectable(target_ptr, target_ptr->y, target_ptr->x, y, x)) continue;
+		ys[num] = y;
+		xs[num] = x;
+		if (++num < MAX_SWEEP_GRIDS) continue;
 
-		POSITION dis = distance(y, x, target_ptr->y, target_ptr->x);
-		if (dis <= candidate.gdis) continue;
-
-		candidate.gy = y;
-		candidate.gx = x;
-		candidate.gdis = dis;
+		pick_safe_coordinate(target_ptr, ys, xs, num, &candidate);
+		num = 0;
 	}
 
+	pick_safe_coordinate(target_ptr, ys, xs, num, &candidate);
 	return candidate;
 }
 
@@ -108,6 +141,36 @@ bool find_safety(player_type *target_ptr, MONSTER_IDX m_idx, POSITION *yp, POSIT
 }
 
 
+/*!
+ * @brief 候補グリッドのうちプレーヤーから狙われない最も近い地点を選ぶ
+ * @param target_ptr プレーヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @param ys 候補グリッドのY座標
+ * @param xs 候補グリッドのX座標
+ * @param num 候補グリッドの数
+ * @param candidate 隠れられる地点の候補地
+ * @return なし
+ */
+static void pick_hiding_coordinate(player_type *target_ptr, monster_type *m_ptr, const POSITION *ys, const POSITION *xs, int num, coordinate_candidate *candidate)
+{
+	bool exposed[MAX_SWEEP_GRIDS];
+	projectable_targets(target_ptr, target_ptr->y, target_ptr->x, num, ys, xs, exposed);
+	for (int i = 0; i < num; i++)
+	{
+		if (exposed[i] && clean_shot(target_ptr, m_ptr->fy, m_ptr->fx, ys[i], xs[i], FALSE))
+			continue;
+
+		POSITION dis = distance(ys[i], xs[i], target_ptr->y, target_ptr->x);
+		if (dis < candidate->gdis && dis >= 2)
+		{
+			candidate->gy = ys[i];
+			candidate->gx = xs[i];
+			candidate->gdis = dis;
+		}
+	}
+}
+
+
 /*!
  * @brief モンスターが隠れられる地点を走査する
  * @param target_ptr プレーヤーへの参照ポインタ
@@ -120,6 +183,9 @@ bool find_safety(player_type *target_ptr, MONSTER_IDX m_idx, POSITION *yp, POSIT
 static void sweep_hiding_candidate(player_type *target_ptr, monster_type *m_ptr, const POSITION *y_offsets, const POSITION *x_offsets, coordinate_candidate *candidate)
 {
 	monster_race *r_ptr = &r_info[m_ptr->r_idx];
+	POSITION ys[MAX_SWEEP_GRIDS];
+	POSITION xs[MAX_SWEEP_GRIDS];
+	int num = 0;
 	for (POSITION i = 0, dx = x_offsets[0], dy = y_offsets[0];
 		dx != 0 || dy != 0;
 		i++, dx = x_offsets[i], dy = y_offsets[i])
@@ -128,17 +194,16 @@ static void sweep_hiding_candidate(player_type *target_ptr, monster_type *m_ptr,
 		POSITION x = m_ptr->fx + dx;
 		if (!in_bounds(target_ptr->current_floor_ptr, y, x)) continue;
 		if (!monster_can_enter(target_ptr, y, x, r_ptr, 0)) continue;
-		if (projectable(target_ptr, target_ptr->y, target_ptr->x, y, x) && clean_shot(target_ptr, m_ptr->fy, m_ptr->fx, y, x, FALSE))
-			continue;
 
-		POSITION dis = distance(y, x, target_ptr->y, target_ptr->x);
-		if (dis < candidate->gdis && dis >= 2)
-		{
-			candidate->gy = y;
-			candidate->gx = x;
-			candidate->gdis = dis;
-		}
+		ys[num] = y;
+		xs[num] = x;
+		if (++num < MAX_SWEEP_GRIDS) continue;
+
+		pick_hiding_coordinate(target_ptr, m_ptr, ys, xs, num, candidate);
+		num = 0;
 	}
+
+	pick_hiding_coordinate(target_ptr, m_ptr, ys, xs, num, candidate);
 }
 
 
@@ -317,7 +317,7 @@ bool place_monster_one(player_type *player_ptr, MONSTER_IDX who, POSITION y, POS
         set_pet(player_ptr, m_ptr);
     } else if ((r_ptr->flags7 & RF7_FRIENDLY) || (mode & PM_FORCE_FRIENDLY) || is_friendly_idx(player_ptr, who)) {
         if (!monster_has_hostile_align(player_ptr, NULL, 0, -1, r_ptr))
-            set_friendly(m_ptr);
+            set_friendly(player_ptr, m_ptr);
     }
 
     m_ptr->mtimed[MTIMED_CSLEEP] = 0;
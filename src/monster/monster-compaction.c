@@ -10,12 +10,16 @@
 #include "monster/monster-description-types.h"
 #include "monster/monster-info.h"
 #include "monster/monster-status.h"
+#include "pet/pet-registry.h"
 #include "system/floor-type-definition.h"
 #include "system/monster-type-definition.h"
 #include "system/object-type-definition.h"
 #include "target/target-checker.h"
+#include "util/usec-timer.h"
 #include "view/display-messages.h"
 
+slot_compaction_type monster_compaction; /*!< モンスター配列の圧縮の計測結果 */
+
 /*!
  * @brief モンスター情報を配列内移動する / Move an object from index i1 to index i2 in the object list
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -72,11 +76,13 @@ static void compact_monsters_aux(player_type *player_ptr, MONSTER_IDX i1, MONSTE
     (void)COPY(&floor_ptr->m_list[i2], &floor_ptr->m_list[i1], monster_type);
     (void)WIPE(&floor_ptr->m_list[i1], monster_type);
 
-    for (int i = 0; i < MAX_MTIMED; i++) {
-        int mproc_idx = get_mproc_idx(floor_ptr, i1, i);
-        if (mproc_idx >= 0)
-            floor_ptr->mproc_list[i][mproc_idx] = i2;
-    }
+    mproc_move(floor_ptr, i1, i2);
+    move_pet_registry(floor_ptr, i1, i2);
+    move_slot(&floor_ptr->m_slots, i1, i2);
+    if (target_who == i2)
+        target_generation = slot_generation(&floor_ptr->m_slots, i2);
+    if (player_ptr->riding_t_m_idx == i2)
+        player_ptr->riding_t_m_generation = slot_generation(&floor_ptr->m_slots, i2);
 }
 
 /*!
@@ -93,9 +99,15 @@ static void compact_monsters_aux(player_type *player_ptr, MONSTER_IDX i1, MONSTE
  *
  * After "compacting" (if needed), we "reorder" the monsters into a more
  * compact order, and we reset the allocation info, and the "live" array.
+ *
+ * 空き枠は m_pop() が使い回すので、毎ターン詰める必要はない。
+ * 配列が溢れそうな時とセーブの前にだけ呼び、かかった時間を monster_compaction に累計する。
  */
 void compact_monsters(player_type *player_ptr, int size)
 {
+    double start = get_usec_time();
+    int deleted = 0;
+    int moved = 0;
     if (size)
         msg_print(_("モンスター情報を圧縮しています...", "Compacting monsters..."));
 
@@ -134,6 +146,7 @@ void compact_monsters(player_type *player_ptr, int size)
 
             delete_monster_idx(player_ptr, i);
             num++;
+            deleted++;
         }
     }
 
@@ -142,7 +155,13 @@ void compact_monsters(player_type *player_ptr, int size)
         monster_type *m_ptr = &floor_ptr->m_list[i];
         if (m_ptr->r_idx)
             continue;
+        if (i != floor_ptr->m_max - 1)
+            moved++;
+
         compact_monsters_aux(player_ptr, floor_ptr->m_max - 1, i);
         floor_ptr->m_max--;
     }
+
+    forget_free_slots(&floor_ptr->m_slots);
+    record_slot_compaction(&monster_compaction, deleted, moved, start);
 }
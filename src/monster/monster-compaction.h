@@ -1,5 +1,8 @@
 ﻿#pragma once
 
 #include "system/angband.h"
+#include "floor/floor-slot-list.h"
+
+extern slot_compaction_type monster_compaction;
 
 void compact_monsters(player_type *player_ptr, int size);
@@ -0,0 +1,114 @@
+﻿/*!
+ * @brief モンスターの呼称のキャッシュ / Cache of monster descriptions
+ * @date 2026/10/19
+ * @details
+ * monster_desc() の結果を、モンスターと呼称オプションの組で覚えておく。
+ * 呼称を左右するモンスターの状態 (種族、見かけ、視認、ペットか、カメレオンか、名前) と
+ * プレーヤー側の状態 (乗馬、闘技場の観戦) を照合値に含めるので、視認の変化はその場で検出される。
+ * 幻覚中の呼称は毎回乱数で選び直すため、キャッシュを使わない。
+ */
+
+#include "monster/monster-desc-cache.h"
+#include "monster/monster-description-types.h"
+#include "monster/monster-flag-types.h"
+#include "monster/monster-info.h"
+#include "system/floor-type-definition.h"
+#include "util/string-processor.h"
+
+#define MONSTER_DESC_CACHE_SIZE 256 /*!< キャッシュする呼称の数 (2の冪) */
+
+#define MONSTER_DESC_SEEN 0x01 /*!< 視認されている */
+#define MONSTER_DESC_PET 0x02 /*!< ペットである */
+#define MONSTER_DESC_CHAMELEON 0x04 /*!< カメレオンである */
+#define MONSTER_DESC_RIDING 0x08 /*!< プレーヤーが乗馬中である */
+#define MONSTER_DESC_PHASE_OUT 0x10 /*!< 闘技場の観戦中である */
+
+/*!
+ * @brief キャッシュした呼称 / A cached description
+ */
+typedef struct monster_desc_cache_entry {
+    monster_desc_key key; /*!< 呼称を作った時の照合値 (m_ptrがNULLなら空き) */
+    GAME_TEXT name[MAX_NLEN]; /*!< モンスターの呼称 */
+} monster_desc_cache_entry;
+
+bool use_monster_desc_cache = TRUE; /*!< キャッシュを使うか (性能計測用) */
+monster_desc_cache_stats_type monster_desc_cache_stats; /*!< キャッシュの統計 */
+
+static monster_desc_cache_entry monster_desc_cache[MONSTER_DESC_CACHE_SIZE]; /*!< キャッシュ本体 */
+
+/*!
+ * @brief 照合値に対応するキャッシュの位置を返す / Slot of a key
+ * @param key_ptr 照合値
+ * @return キャッシュの要素への参照ポインタ
+ * @details m_list上で隣り合うモンスターは隣り合う位置に入る。
+ */
+static monster_desc_cache_entry *get_monster_desc_slot(monster_desc_key *key_ptr)
+{
+    size_t slot = (size_t)key_ptr->m_ptr / sizeof(monster_type) + key_ptr->mode * 97;
+    return &monster_desc_cache[slot & (MONSTER_DESC_CACHE_SIZE - 1)];
+}
+
+/*!
+ * @brief キャッシュから呼称を探す / Look up a cached description
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @param mode 呼称オプション
+ * @param desc 見つかった時に呼称を返すための文字列参照ポインタ
+ * @param key_ptr 見つからなかった時に save_monster_desc_cache() へ渡す照合値を返す
+ * @return 見つかったらTRUE
+ */
+bool load_monster_desc_cache(player_type *player_ptr, monster_type *m_ptr, BIT_FLAGS mode, char *desc, monster_desc_key *key_ptr)
+{
+    key_ptr->cacheable = use_monster_desc_cache && (!player_ptr->image || (mode & MD_IGNORE_HALLU));
+    if (!key_ptr->cacheable) {
+        if (use_monster_desc_cache)
+            monster_desc_cache_stats.bypass++;
+
+        return FALSE;
+    }
+
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    key_ptr->m_ptr = m_ptr;
+    key_ptr->mode = mode;
+    key_ptr->r_idx = m_ptr->r_idx;
+    key_ptr->ap_r_idx = m_ptr->ap_r_idx;
+    key_ptr->nickname = m_ptr->nickname;
+    key_ptr->state = 0;
+    if (m_ptr->ml)
+        key_ptr->state |= MONSTER_DESC_SEEN;
+    if (is_pet(m_ptr))
+        key_ptr->state |= MONSTER_DESC_PET;
+    if (m_ptr->mflag2 & MFLAG2_CHAMELEON)
+        key_ptr->state |= MONSTER_DESC_CHAMELEON;
+    if (player_ptr->riding && (&floor_ptr->m_list[player_ptr->riding] == m_ptr))
+        key_ptr->state |= MONSTER_DESC_RIDING;
+    if (player_ptr->phase_out)
+        key_ptr->state |= MONSTER_DESC_PHASE_OUT;
+
+    monster_desc_cache_entry *entry = get_monster_desc_slot(key_ptr);
+    if ((entry->key.m_ptr != key_ptr->m_ptr) || (entry->key.mode != key_ptr->mode) || (entry->key.r_idx != key_ptr->r_idx)
+        || (entry->key.ap_r_idx != key_ptr->ap_r_idx) || (entry->key.nickname != key_ptr->nickname) || (entry->key.state != key_ptr->state)) {
+        monster_desc_cache_stats.miss++;
+        return FALSE;
+    }
+
+    monster_desc_cache_stats.hit++;
+    angband_strcpy(desc, entry->name, MAX_NLEN);
+    return TRUE;
+}
+
+/*!
+ * @brief 作った呼称をキャッシュに入れる / Store a freshly built description
+ * @param key_ptr load_monster_desc_cache() が返した照合値
+ * @param desc モンスターの呼称
+ * @return なし
+ */
+void save_monster_desc_cache(monster_desc_key *key_ptr, concptr desc)
+{
+    if (!key_ptr->cacheable)
+        return;
+
+    monster_desc_cache_entry *entry = get_monster_desc_slot(key_ptr);
+    entry->key = *key_ptr;
+    angband_strcpy(entry->name, desc, MAX_NLEN);
+}
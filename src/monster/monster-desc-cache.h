@@ -0,0 +1,32 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "system/monster-type-definition.h"
+
+/*!
+ * @brief モンスターの呼称のキャッシュの照合に使う値 / Key of a cached monster description
+ */
+typedef struct monster_desc_key {
+    monster_type *m_ptr; /*!< 呼称を作ったモンスター */
+    BIT_FLAGS mode; /*!< 呼称オプション */
+    MONRACE_IDX r_idx; /*!< 真の種族 */
+    MONRACE_IDX ap_r_idx; /*!< 見かけの種族 */
+    STR_OFFSET nickname; /*!< ペットの名前 */
+    BIT_FLAGS state; /*!< 視認・ペット・カメレオン・乗馬・闘技場観戦の状態 */
+    bool cacheable; /*!< 幻覚中の呼称のようにキャッシュできない時はFALSE */
+} monster_desc_key;
+
+/*!
+ * @brief モンスターの呼称のキャッシュの統計 / Statistics of the monster description cache
+ */
+typedef struct monster_desc_cache_stats_type {
+    u32b hit; /*!< キャッシュから返した回数 */
+    u32b miss; /*!< 呼称を作り直した回数 */
+    u32b bypass; /*!< 幻覚中のためキャッシュを使わなかった回数 */
+} monster_desc_cache_stats_type;
+
+extern bool use_monster_desc_cache;
+extern monster_desc_cache_stats_type monster_desc_cache_stats;
+
+bool load_monster_desc_cache(player_type *player_ptr, monster_type *m_ptr, BIT_FLAGS mode, char *desc, monster_desc_key *key_ptr);
+void save_monster_desc_cache(monster_desc_key *key_ptr, concptr desc);
@@ -2,6 +2,7 @@
 #include "io/files-util.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
+#include "monster/monster-desc-cache.h"
 #include "monster/monster-description-types.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
@@ -21,7 +22,7 @@
  * @param mode 呼称オプション
  * @return なし
  */
-void monster_desc(player_type *player_ptr, char *desc, monster_type *m_ptr, BIT_FLAGS mode)
+static void build_monster_desc(player_type *player_ptr, char *desc, monster_type *m_ptr, BIT_FLAGS mode)
 {
     monster_race *r_ptr;
     r_ptr = &r_info[m_ptr->ap_r_idx];
@@ -240,6 +241,23 @@ void monster_desc(player_type *player_ptr, char *desc, monster_type *m_ptr, BIT_
     }
 }
 
+/*!
+ * @brief モンスターの呼称を返す / Describe a monster, reusing the cached description when nothing relevant has changed
+ * @param desc 記述出力先の文字列参照ポインタ
+ * @param m_ptr モンスターの参照ポインタ
+ * @param mode 呼称オプション
+ * @return なし
+ */
+void monster_desc(player_type *player_ptr, char *desc, monster_type *m_ptr, BIT_FLAGS mode)
+{
+    monster_desc_key key;
+    if (load_monster_desc_cache(player_ptr, m_ptr, mode, desc, &key))
+        return;
+
+    build_monster_desc(player_ptr, desc, m_ptr, mode);
+    save_monster_desc_cache(&key, desc);
+}
+
 /*!
  * @brief ダメージを受けたモンスターの様子を記述する / Dump a message describing a monster's reaction to damage
  * @param player_ptr プレーヤーへの参照ポインタ
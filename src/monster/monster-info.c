@@ -29,13 +29,6 @@
 #include "util/bit-flags-calculator.h"
 #include "player/player-status-flags.h"
 
-/*!
- * @brief モンスターを友好的にする
- * @param m_ptr モンスター情報構造体の参照ポインタ
- * @return なし
- */
-void set_friendly(monster_type *m_ptr) { m_ptr->smart |= SM_FRIENDLY; }
-
 /*!
  * @brief モンスターが地形を踏破できるかどうかを返す
  * Check if monster can cross terrain
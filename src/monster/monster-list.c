@@ -32,6 +32,7 @@
 #include "monster/monster-util.h"
 #include "object/object-generator.h"
 #include "pet/pet-fall-off.h"
+#include "pet/pet-registry.h"
 #include "system/alloc-entries.h"
 #include "system/floor-type-definition.h"
 #include "view/display-messages.h"
@@ -44,15 +45,27 @@
  * @brief モンスター配列の空きを探す / Acquires and returns the index of a "free" monster.
  * @return 利用可能なモンスター配列の添字
  * @details
+ * 削除で空いた枠があればそれを使い、なければ使用範囲を広げる。
+ * 空き枠の一覧に載っていながら使われている枠は一覧から外して読み飛ばす。
  * This routine should almost never fail, but it *can* happen.
  */
 MONSTER_IDX m_pop(floor_type *floor_ptr)
 {
+    /* Reuse the slots of deleted monsters */
+    for (MONSTER_IDX i = pop_free_slot(&floor_ptr->m_slots); i; i = pop_free_slot(&floor_ptr->m_slots)) {
+        if (floor_ptr->m_list[i].r_idx)
+            continue;
+
+        floor_ptr->m_cnt++;
+        return i;
+    }
+
     /* Normal allocation */
     if (floor_ptr->m_max < current_world_ptr->max_m_idx) {
         MONSTER_IDX i = floor_ptr->m_max;
         floor_ptr->m_max++;
         floor_ptr->m_cnt++;
+        occupy_slot(&floor_ptr->m_slots, i);
         return i;
     }
 
@@ -63,6 +76,7 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
         if (m_ptr->r_idx)
             continue;
         floor_ptr->m_cnt++;
+        occupy_slot(&floor_ptr->m_slots, i);
         return i;
     }
 
@@ -338,6 +352,7 @@ void choose_new_monster(player_type *player_ptr, MONSTER_IDX m_idx, bool born, M
 
     m_ptr->r_idx = r_idx;
     m_ptr->ap_r_idx = r_idx;
+    invalidate_pet_summary(floor_ptr);
     update_monster(player_ptr, m_idx, FALSE);
     lite_spot(player_ptr, m_ptr->fy, m_ptr->fx);
 
@@ -36,29 +36,6 @@ turn_flags *init_turn_flags(MONSTER_IDX riding_idx, MONSTER_IDX m_idx, turn_flag
 }
 
 
-/*!
- * @brief old_race_flags_ptr の初期化
- */
-old_race_flags *init_old_race_flags(old_race_flags *old_race_flags_ptr)
-{
-	old_race_flags_ptr->old_r_flags1 = 0L;
-	old_race_flags_ptr->old_r_flags2 = 0L;
-	old_race_flags_ptr->old_r_flags3 = 0L;
-	old_race_flags_ptr->old_r_flags4 = 0L;
-	old_race_flags_ptr->old_r_flags5 = 0L;
-	old_race_flags_ptr->old_r_flags6 = 0L;
-	old_race_flags_ptr->old_r_flagsr = 0L;
-
-	old_race_flags_ptr->old_r_blows0 = 0;
-	old_race_flags_ptr->old_r_blows1 = 0;
-	old_race_flags_ptr->old_r_blows2 = 0;
-	old_race_flags_ptr->old_r_blows3 = 0;
-
-	old_race_flags_ptr->old_r_cast_spell = 0;
-	return old_race_flags_ptr;
-}
-
-
 /*!
  * @brief coordinate_candidate の初期化
  * @param なし
@@ -323,36 +300,6 @@ void store_moves_val(int *mm, int y, int x)
 }
 
 
-/*!
- * @brief 古いモンスター情報の保存
- * @param monster_race_idx モンスターID
- * @param old_race_flags_ptr モンスターフラグへの参照ポインタ
- * @return なし
- */
-void save_old_race_flags(MONRACE_IDX monster_race_idx, old_race_flags *old_race_flags_ptr)
-{
-	if (monster_race_idx == 0) return;
-
-	monster_race *r_ptr;
-	r_ptr = &r_info[monster_race_idx];
-
-	old_race_flags_ptr->old_r_flags1 = r_ptr->r_flags1;
-	old_race_flags_ptr->old_r_flags2 = r_ptr->r_flags2;
-	old_race_flags_ptr->old_r_flags3 = r_ptr->r_flags3;
-	old_race_flags_ptr->old_r_flags4 = r_ptr->r_flags4;
-	old_race_flags_ptr->old_r_flags5 = r_ptr->r_flags5;
-	old_race_flags_ptr->old_r_flags6 = r_ptr->r_flags6;
-	old_race_flags_ptr->old_r_flagsr = r_ptr->r_flagsr;
-
-	old_race_flags_ptr->old_r_blows0 = r_ptr->r_blows[0];
-	old_race_flags_ptr->old_r_blows1 = r_ptr->r_blows[1];
-	old_race_flags_ptr->old_r_blows2 = r_ptr->r_blows[2];
-	old_race_flags_ptr->old_r_blows3 = r_ptr->r_blows[3];
-
-	old_race_flags_ptr->old_r_cast_spell = r_ptr->r_cast_spell;
-}
-
-
 /*!
  * @brief モンスターの加速値を決定する
  * @param m_ptr モンスターへの参照ポインタ
@@ -16,11 +16,13 @@
 #include "cmd-io/cmd-dump.h"
 #include "core/player-update-types.h"
 #include "core/speed-table.h"
+#include "core/turn-profiler.h"
 #include "floor/cave.h"
 #include "game-option/play-record-options.h"
 #include "grid/feature.h"
 #include "grid/grid.h"
 #include "io/write-diary.h"
+#include "lore/lore-journal.h"
 #include "melee/melee-postprocess.h"
 #include "melee/melee-spell.h"
 #include "monster-floor/monster-direction.h"
@@ -377,7 +379,7 @@ void process_special(player_type *target_ptr, MONSTER_IDX m_idx)
     }
 
     if (count && is_original_ap_and_seen(target_ptr, m_ptr))
-        r_ptr->r_flags6 |= (RF6_SPECIAL);
+        lore_race_flags(r_ptr, LORE_FLAGS6, RF6_SPECIAL);
 }
 
 /*!
@@ -412,7 +414,7 @@ bool decide_monster_multiplication(player_type *target_ptr, MONSTER_IDX m_idx, P
     if ((k < 4) && (!k || !randint0(k * MON_MULT_ADJ))) {
         if (multiply_monster(target_ptr, m_idx, FALSE, (is_pet(m_ptr) ? PM_FORCE_PET : 0))) {
             if (target_ptr->current_floor_ptr->m_list[hack_m_idx_ii].ml && is_original_ap_and_seen(target_ptr, m_ptr))
-                r_ptr->r_flags2 |= RF2_MULTIPLY;
+                lore_race_flags(r_ptr, LORE_FLAGS2, RF2_MULTIPLY);
 
             return TRUE;
         }
@@ -511,22 +513,14 @@ bool process_monster_fear(player_type *target_ptr, turn_flags *turn_flags_ptr, M
  * move before any "nasty" monsters get to use their spell attacks.\n
  *\n
  * Note that when the "knowledge" about the currently tracked monster\n
- * changes (flags, attacks, spells), we induce a redraw of the monster\n
- * recall window.\n
+ * changes (flags, attacks, spells), flush_lore_journal() induces a redraw\n
+ * of the monster recall window at the end of the game turn.\n
  */
 void process_monsters(player_type *target_ptr)
 {
-    old_race_flags tmp_flags;
-    old_race_flags *old_race_flags_ptr = init_old_race_flags(&tmp_flags);
     target_ptr->current_floor_ptr->monster_noise = FALSE;
-    MONRACE_IDX old_monster_race_idx = target_ptr->monster_race_idx;
-    save_old_race_flags(target_ptr->monster_race_idx, old_race_flags_ptr);
     sweep_monster_process(target_ptr);
     hack_m_idx = 0;
-    if (!target_ptr->monster_race_idx || (target_ptr->monster_race_idx != old_monster_race_idx))
-        return;
-
-    update_player_window(target_ptr, old_race_flags_ptr);
 }
 
 /*!
@@ -561,6 +555,7 @@ void sweep_monster_process(player_type *target_ptr)
 
         m_ptr->energy_need += ENERGY_NEED();
         hack_m_idx = i;
+        TURN_PROFILE_COUNT(TPC_MONSTER_MOVE);
         process_monster(target_ptr, i);
         reset_target(m_ptr);
         if (target_ptr->no_flowed && one_in_(3))
@@ -17,6 +17,7 @@
 #include "monster/monster-status.h" // todo 相互依存. 後で何とかする.
 #include "monster/monster-util.h"
 #include "monster/smart-learn-types.h"
+#include "pet/pet-registry.h"
 #include "player-info/avatar.h"
 #include "system/floor-type-definition.h"
 #include "system/monster-type-definition.h"
@@ -24,6 +25,18 @@
 #include "view/display-messages.h"
 #include "world/world.h"
 
+/*!
+ * @brief モンスターを友好的にする
+ * @param player_type プレーヤーへの参照ポインタ
+ * @param m_ptr モンスター情報構造体の参照ポインタ
+ * @return なし
+ */
+void set_friendly(player_type *player_ptr, monster_type *m_ptr)
+{
+    m_ptr->smart |= SM_FRIENDLY;
+    update_pet_registry(player_ptr->current_floor_ptr, m_ptr);
+}
+
 /*!
  * @brief モンスターをペットにする
  * @param player_type プレーヤーへの参照ポインタ
@@ -36,6 +49,8 @@ void set_pet(player_type *player_ptr, monster_type *m_ptr)
     m_ptr->smart |= SM_PET;
     if (!(r_info[m_ptr->r_idx].flags3 & (RF3_EVIL | RF3_GOOD)))
         m_ptr->sub_align = SUB_ALIGN_NEUTRAL;
+
+    update_pet_registry(player_ptr->current_floor_ptr, m_ptr);
 }
 
 /*!
@@ -51,6 +66,7 @@ void set_hostile(player_type *player_ptr, monster_type *m_ptr)
 
     m_ptr->smart &= ~SM_PET;
     m_ptr->smart &= ~SM_FRIENDLY;
+    update_pet_registry(player_ptr->current_floor_ptr, m_ptr);
 }
 
 /*!
@@ -74,20 +90,6 @@ void anger_monster(player_type *player_ptr, monster_type *m_ptr)
     chg_virtue(player_ptr, V_COMPASSION, -1);
 }
 
-/*!
- * @brief モンスターの時限ステータスリストを削除
- * @param floor_ptr 現在フロアへの参照ポインタ
- * @return m_idx モンスターの参照ID
- * @return mproc_type 削除したいモンスターの時限ステータスID
- * @return なし
- */
-static void mproc_remove(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
-{
-    int mproc_idx = get_mproc_idx(floor_ptr, m_idx, mproc_type);
-    if (mproc_idx >= 0)
-        floor_ptr->mproc_list[mproc_type][mproc_idx] = floor_ptr->mproc_list[mproc_type][--floor_ptr->mproc_max[mproc_type]];
-}
-
 /*!
  * @brief モンスターの睡眠状態値をセットする。0で起きる。 /
  * Set "m_ptr->mtimed[MTIMED_CSLEEP]", notice observable changes
@@ -103,18 +105,14 @@ bool set_monster_csleep(player_type *target_ptr, MONSTER_IDX m_idx, int v)
     bool notice = FALSE;
     v = (v > 10000) ? 10000 : (v < 0) ? 0 : v;
     if (v) {
-        if (!monster_csleep_remaining(m_ptr)) {
-            mproc_add(floor_ptr, m_idx, MTIMED_CSLEEP);
+        if (!monster_csleep_remaining(m_ptr))
             notice = TRUE;
-        }
     } else {
-        if (monster_csleep_remaining(m_ptr)) {
-            mproc_remove(floor_ptr, m_idx, MTIMED_CSLEEP);
+        if (monster_csleep_remaining(m_ptr))
             notice = TRUE;
-        }
     }
 
-    m_ptr->mtimed[MTIMED_CSLEEP] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_CSLEEP, (TIME_EFFECT)v);
     if (!notice)
         return FALSE;
 
@@ -158,7 +156,7 @@ bool set_monster_fast(player_type *target_ptr, MONSTER_IDX m_idx, int v)
         }
     }
 
-    m_ptr->mtimed[MTIMED_FAST] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_FAST, (TIME_EFFECT)v);
     if (!notice)
         return FALSE;
 
@@ -189,7 +187,7 @@ bool set_monster_slow(player_type *target_ptr, MONSTER_IDX m_idx, int v)
         }
     }
 
-    m_ptr->mtimed[MTIMED_SLOW] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_SLOW, (TIME_EFFECT)v);
     if (!notice)
         return FALSE;
 
@@ -225,7 +223,7 @@ bool set_monster_stunned(player_type *target_ptr, MONSTER_IDX m_idx, int v)
         }
     }
 
-    m_ptr->mtimed[MTIMED_STUNNED] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_STUNNED, (TIME_EFFECT)v);
     return notice;
 }
 
@@ -255,7 +253,7 @@ bool set_monster_confused(player_type *target_ptr, MONSTER_IDX m_idx, int v)
         }
     }
 
-    m_ptr->mtimed[MTIMED_CONFUSED] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_CONFUSED, (TIME_EFFECT)v);
     return notice;
 }
 
@@ -285,7 +283,7 @@ bool set_monster_monfear(player_type *target_ptr, MONSTER_IDX m_idx, int v)
         }
     }
 
-    m_ptr->mtimed[MTIMED_MONFEAR] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_MONFEAR, (TIME_EFFECT)v);
 
     if (!notice)
         return FALSE;
@@ -330,7 +328,7 @@ bool set_monster_invulner(player_type *target_ptr, MONSTER_IDX m_idx, int v, boo
         }
     }
 
-    m_ptr->mtimed[MTIMED_INVULNER] = (s16b)v;
+    store_mtimed(floor_ptr, m_idx, MTIMED_INVULNER, (TIME_EFFECT)v);
     if (!notice)
         return FALSE;
 
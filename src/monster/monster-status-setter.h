@@ -3,7 +3,7 @@
 #include "system/angband.h"
 
 typedef struct monster_type monster_type;
-void set_friendly(monster_type *m_ptr);
+void set_friendly(player_type *player_ptr, monster_type *m_ptr);
 void set_pet(player_type *player_ptr, monster_type *m_ptr);
 void set_hostile(player_type *player_ptr, monster_type *m_ptr);
 void anger_monster(player_type *player_ptr, monster_type *m_ptr);
@@ -15,6 +15,7 @@
 #include "io/files-util.h"
 #include "io/report.h"
 #include "io/write-diary.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "mind/mind-ninja.h"
@@ -45,6 +46,7 @@
 #include "monster/smart-learn-types.h"
 #include "mspell/mspell-mask-definitions.h"
 #include "object-enchant/object-curse.h"
+#include "pet/pet-registry.h"
 #include "player-info/avatar.h"
 #include "player/player-personalities-types.h"
 #include "player/special-defense-types.h"
@@ -205,20 +207,113 @@ static void get_exp_from_mon(player_type *target_ptr, HIT_POINT dam, monster_typ
     gain_exp_64(target_ptr, new_exp, new_exp_frac);
 }
 
+/*!
+ * @brief 1回毎に1ずつ減るだけの時限効果かを返す / Whether a timed effect is a pure countdown kept on the timing wheel
+ * @param mtimed_idx モンスターの時限ステータスID
+ * @return 加速・減速・無敵ならばTRUE
+ * @details 睡眠・朦朧・混乱・恐慌は回毎の減り方が乱数で決まるため、従来通り一覧を毎回走査する。
+ */
+static bool is_mtimed_countdown(int mtimed_idx) { return (mtimed_idx == MTIMED_FAST) || (mtimed_idx == MTIMED_SLOW) || (mtimed_idx == MTIMED_INVULNER); }
+
+/*!
+ * @brief 加速・減速・無敵の現在の残りターンを返す
+ * @param m_ptr モンスターへの参照ポインタ
+ * @param mtimed_idx モンスターの時限ステータスID
+ * @return 残りターン値
+ * @details 値はmtimed_stampの時点のものを保持しており、その後に処理した回数を差し引く。
+ */
+static TIME_EFFECT countdown_remaining(monster_type *m_ptr, int mtimed_idx)
+{
+    TIME_EFFECT v = m_ptr->mtimed[mtimed_idx];
+    if (!v)
+        return 0;
+
+    u32b elapsed = current_world_ptr->mtimed_tick - m_ptr->mtimed_stamp;
+    return (elapsed >= (u32b)v) ? 0 : (TIME_EFFECT)(v - elapsed);
+}
+
+/*!
+ * @brief 加速・減速・無敵の値を現在の処理回数時点のものに書き直す
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return なし
+ */
+static void sync_mtimed_countdown(monster_type *m_ptr)
+{
+    m_ptr->mtimed[MTIMED_FAST] = countdown_remaining(m_ptr, MTIMED_FAST);
+    m_ptr->mtimed[MTIMED_SLOW] = countdown_remaining(m_ptr, MTIMED_SLOW);
+    m_ptr->mtimed[MTIMED_INVULNER] = countdown_remaining(m_ptr, MTIMED_INVULNER);
+    m_ptr->mtimed_stamp = current_world_ptr->mtimed_tick;
+}
+
+/*!
+ * @brief 読み込んだモンスターの時限効果の値を現在の処理回数時点のものとして扱う / Treat the loaded timers as current
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return なし
+ */
+void reset_mtimed_stamp(monster_type *m_ptr) { m_ptr->mtimed_stamp = current_world_ptr->mtimed_tick; }
+
+/*!
+ * @brief モンスターを時限効果の満了待ちの循環リストから外す
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターの参照ID
+ * @param mtimed_idx モンスターの時限ステータスID
+ * @return なし
+ */
+static void unlink_mtimed_wheel(floor_type *floor_ptr, MONSTER_IDX m_idx, int mtimed_idx)
+{
+    int *next = floor_ptr->mtimed_wheel_next[mtimed_idx];
+    int *prev = floor_ptr->mtimed_wheel_prev[mtimed_idx];
+    next[prev[m_idx]] = next[m_idx];
+    prev[next[m_idx]] = prev[m_idx];
+    next[m_idx] = m_idx;
+    prev[m_idx] = m_idx;
+}
+
+/*!
+ * @brief モンスターを時限効果の満了する回の循環リストに繋ぐ
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターの参照ID
+ * @param mtimed_idx モンスターの時限ステータスID
+ * @param expiry 残りが1から0になる処理回数
+ * @return なし
+ */
+static void link_mtimed_wheel(floor_type *floor_ptr, MONSTER_IDX m_idx, int mtimed_idx, u32b expiry)
+{
+    int *next = floor_ptr->mtimed_wheel_next[mtimed_idx];
+    int *prev = floor_ptr->mtimed_wheel_prev[mtimed_idx];
+    int head = current_world_ptr->max_m_idx + (int)(expiry & (MTIMED_WHEEL_SIZE - 1));
+    next[m_idx] = next[head];
+    prev[m_idx] = head;
+    prev[next[head]] = m_idx;
+    next[head] = m_idx;
+}
+
+/*!
+ * @brief 眠っているモンスターがプレーヤーに気付き得る距離にいるかを返す
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return 目覚めの判定を受け得るならばTRUE
+ * @details process_monsters_mtimed_aux()の判定を緩めたもの。ペットの感知範囲の縮小は考慮しない。
+ */
+static bool is_sleeper_in_range(monster_type *m_ptr)
+{
+    if (!m_ptr->mtimed[MTIMED_CSLEEP] || (m_ptr->cdis >= AAF_LIMIT))
+        return FALSE;
+
+    return m_ptr->cdis <= MAX(r_info[m_ptr->r_idx].aaf, MAX_SIGHT);
+}
+
 /*!
  * @brief モンスターの時限ステータスを取得する
  * @param floor_ptr 現在フロアへの参照ポインタ
  * @return m_idx モンスターの参照ID
  * @return mproc_type モンスターの時限ステータスID
- * @return 残りターン値
+ * @return mproc_list内の位置、含まれていなければ-1
  */
 int get_mproc_idx(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 {
-    s16b *cur_mproc_list = floor_ptr->mproc_list[mproc_type];
-    for (int i = floor_ptr->mproc_max[mproc_type] - 1; i >= 0; i--) {
-        if (cur_mproc_list[i] == m_idx)
-            return i;
-    }
+    int mproc_idx = floor_ptr->mproc_pos[mproc_type][m_idx];
+    if ((mproc_idx < floor_ptr->mproc_max[mproc_type]) && (floor_ptr->mproc_list[mproc_type][mproc_idx] == m_idx))
+        return mproc_idx;
 
     return -1;
 }
@@ -233,21 +328,172 @@ int get_mproc_idx(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 void mproc_add(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
 {
     if (floor_ptr->mproc_max[mproc_type] < current_world_ptr->max_m_idx) {
+        floor_ptr->mproc_pos[mproc_type][m_idx] = floor_ptr->mproc_max[mproc_type];
         floor_ptr->mproc_list[mproc_type][floor_ptr->mproc_max[mproc_type]++] = (s16b)m_idx;
     }
 }
 
 /*!
- * @brief モンスターの時限ステータスリストを初期化する / Initialize monster process
+ * @brief モンスターの時限ステータスリストを削除
  * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return m_idx モンスターの参照ID
+ * @return mproc_type 削除したいモンスターの時限ステータスID
  * @return なし
  */
-void mproc_init(floor_type *floor_ptr)
+void mproc_remove(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type)
+{
+    int mproc_idx = get_mproc_idx(floor_ptr, m_idx, mproc_type);
+    if (mproc_idx < 0)
+        return;
+
+    s16b last = floor_ptr->mproc_list[mproc_type][--floor_ptr->mproc_max[mproc_type]];
+    floor_ptr->mproc_list[mproc_type][mproc_idx] = last;
+    floor_ptr->mproc_pos[mproc_type][last] = (s16b)mproc_idx;
+}
+
+/*!
+ * @brief 眠っているモンスターの時限ステータスリストへの所属を距離に合わせて更新する
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターの参照ID
+ * @return なし
+ * @details 睡眠のリストにはプレーヤーに気付き得る距離にいるモンスターだけを載せる。
+ * 距離(cdis)か睡眠の値が変わった時に呼ぶ。
+ */
+void update_mproc_sleeper(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    bool listed = get_mproc_idx(floor_ptr, m_idx, MTIMED_CSLEEP) >= 0;
+    if (is_sleeper_in_range(&floor_ptr->m_list[m_idx]) == listed)
+        return;
+
+    if (listed)
+        mproc_remove(floor_ptr, m_idx, MTIMED_CSLEEP);
+    else
+        mproc_add(floor_ptr, m_idx, MTIMED_CSLEEP);
+}
+
+/*!
+ * @brief モンスターの時限ステータスの値を書き込む / Store a timer value and keep the process lists in step
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターの参照ID
+ * @param mtimed_idx モンスターの時限ステータスID
+ * @param v 新しい値
+ * @return なし
+ * @details 加速・減速・無敵は満了する回の枠に繋ぎ直し、睡眠はリストへの所属を更新する。
+ * それ以外のリストへの出し入れは呼び出し側(set_monster_*())が行う。
+ */
+void store_mtimed(floor_type *floor_ptr, MONSTER_IDX m_idx, int mtimed_idx, TIME_EFFECT v)
+{
+    monster_type *m_ptr = &floor_ptr->m_list[m_idx];
+    if (!is_mtimed_countdown(mtimed_idx)) {
+        m_ptr->mtimed[mtimed_idx] = v;
+        if (mtimed_idx == MTIMED_CSLEEP)
+            update_mproc_sleeper(floor_ptr, m_idx);
+
+        return;
+    }
+
+    sync_mtimed_countdown(m_ptr);
+    unlink_mtimed_wheel(floor_ptr, m_idx, mtimed_idx);
+    m_ptr->mtimed[mtimed_idx] = v;
+    if (v)
+        link_mtimed_wheel(floor_ptr, m_idx, mtimed_idx, current_world_ptr->mtimed_tick + v - 1);
+}
+
+/*!
+ * @brief モンスターの時限ステータスリストを空にする / Empty the monster process lists
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ */
+void mproc_clear(floor_type *floor_ptr)
 {
-    /* Reset "target_ptr->current_floor_ptr->mproc_max[]" */
     for (int i = 0; i < MAX_MTIMED; i++) {
         floor_ptr->mproc_max[i] = 0;
+        if (!is_mtimed_countdown(i))
+            continue;
+
+        for (int n = 0; n < current_world_ptr->max_m_idx + MTIMED_WHEEL_SIZE; n++) {
+            floor_ptr->mtimed_wheel_next[i][n] = n;
+            floor_ptr->mtimed_wheel_prev[i][n] = n;
+        }
+    }
+}
+
+/*!
+ * @brief モンスターの時限ステータスリストを確保する / Allocate the monster process lists
+ * @param floor_ptr 確保先のフロアへの参照ポインタ
+ * @return なし
+ */
+void make_mproc_lists(floor_type *floor_ptr)
+{
+    for (int i = 0; i < MAX_MTIMED; i++) {
+        C_MAKE(floor_ptr->mproc_list[i], current_world_ptr->max_m_idx, s16b);
+        C_MAKE(floor_ptr->mproc_pos[i], current_world_ptr->max_m_idx, s16b);
+        if (!is_mtimed_countdown(i))
+            continue;
+
+        C_MAKE(floor_ptr->mtimed_wheel_next[i], current_world_ptr->max_m_idx + MTIMED_WHEEL_SIZE, int);
+        C_MAKE(floor_ptr->mtimed_wheel_prev[i], current_world_ptr->max_m_idx + MTIMED_WHEEL_SIZE, int);
+    }
+
+    mproc_clear(floor_ptr);
+}
+
+/*!
+ * @brief モンスターの時限ステータスリストを解放する / Free the monster process lists
+ * @param floor_ptr 解放するフロアへの参照ポインタ
+ * @return なし
+ */
+void kill_mproc_lists(floor_type *floor_ptr)
+{
+    for (int i = 0; i < MAX_MTIMED; i++) {
+        if (is_mtimed_countdown(i)) {
+            C_KILL(floor_ptr->mtimed_wheel_prev[i], current_world_ptr->max_m_idx + MTIMED_WHEEL_SIZE, int);
+            C_KILL(floor_ptr->mtimed_wheel_next[i], current_world_ptr->max_m_idx + MTIMED_WHEEL_SIZE, int);
+        }
+
+        C_KILL(floor_ptr->mproc_pos[i], current_world_ptr->max_m_idx, s16b);
+        C_KILL(floor_ptr->mproc_list[i], current_world_ptr->max_m_idx, s16b);
     }
+}
+
+/*!
+ * @brief 圧縮で移動したモンスターの時限ステータスリスト上の参照を付け替える
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param i1 移動元のモンスターの参照ID
+ * @param i2 移動先のモンスターの参照ID (どのリストにも含まれていないこと)
+ * @return なし
+ */
+void mproc_move(floor_type *floor_ptr, MONSTER_IDX i1, MONSTER_IDX i2)
+{
+    for (int i = 0; i < MAX_MTIMED; i++) {
+        int mproc_idx = get_mproc_idx(floor_ptr, i1, i);
+        if (mproc_idx >= 0) {
+            floor_ptr->mproc_list[i][mproc_idx] = i2;
+            floor_ptr->mproc_pos[i][i2] = (s16b)mproc_idx;
+        }
+
+        if (!is_mtimed_countdown(i) || (floor_ptr->mtimed_wheel_next[i][i1] == i1))
+            continue;
+
+        int *next = floor_ptr->mtimed_wheel_next[i];
+        int *prev = floor_ptr->mtimed_wheel_prev[i];
+        next[i2] = next[i1];
+        prev[i2] = prev[i1];
+        prev[next[i2]] = i2;
+        next[prev[i2]] = i2;
+        next[i1] = i1;
+        prev[i1] = i1;
+    }
+}
+
+/*!
+ * @brief モンスターの時限ステータスリストを初期化する / Initialize monster process
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @return なし
+ */
+void mproc_init(floor_type *floor_ptr)
+{
+    mproc_clear(floor_ptr);
 
     /* Process the monsters (backwards) */
     for (MONSTER_IDX i = floor_ptr->m_max - 1; i >= 1; i--) {
@@ -258,9 +504,15 @@ void mproc_init(floor_type *floor_ptr)
         if (!monster_is_valid(m_ptr))
             continue;
 
+        sync_mtimed_countdown(m_ptr);
+        update_mproc_sleeper(floor_ptr, i);
         for (int cmi = 0; cmi < MAX_MTIMED; cmi++) {
-            if (m_ptr->mtimed[cmi])
-                mproc_add(floor_ptr, i, cmi);
+            if ((cmi == MTIMED_CSLEEP) || !m_ptr->mtimed[cmi])
+                continue;
+
+            mproc_add(floor_ptr, i, cmi);
+            if (is_mtimed_countdown(cmi))
+                link_mtimed_wheel(floor_ptr, i, cmi, current_world_ptr->mtimed_tick + m_ptr->mtimed[cmi] - 1);
         }
     }
 }
@@ -449,15 +701,12 @@ static void process_monsters_mtimed_aux(player_type *target_ptr, MONSTER_IDX m_i
 }
 
 /*!
- * @brief 全モンスターの各種状態値を時間経過により更新するメインルーチン
- * @param mtimed_idx 更新するモンスターの時限ステータスID
+ * @brief 一覧に載っているモンスターの状態値を時間経過により更新する
  * @param target_ptr プレーヤーへの参照ポインタ
+ * @param mtimed_idx 更新するモンスターの時限ステータスID
  * @return なし
- * @details
- * Process the counters of monsters (once per 10 game turns)\n
- * These functions are to process monsters' counters same as player's.
  */
-void process_monsters_mtimed(player_type *target_ptr, int mtimed_idx)
+static void process_monsters_mtimed_list(player_type *target_ptr, int mtimed_idx)
 {
     floor_type *floor_ptr = target_ptr->current_floor_ptr;
     s16b *cur_mproc_list = floor_ptr->mproc_list[mtimed_idx];
@@ -472,6 +721,47 @@ void process_monsters_mtimed(player_type *target_ptr, int mtimed_idx)
     }
 }
 
+/*!
+ * @brief 今回で満了するモンスターの加速・減速・無敵だけを解除する
+ * @param target_ptr プレーヤーへの参照ポインタ
+ * @param mtimed_idx 更新するモンスターの時限ステータスID
+ * @return なし
+ * @details 枠には満了する回がMTIMED_WHEEL_SIZEの整数倍だけ先のものも混ざるため、残りが1のものだけを処理する。
+ */
+static void process_monsters_mtimed_wheel(player_type *target_ptr, int mtimed_idx)
+{
+    floor_type *floor_ptr = target_ptr->current_floor_ptr;
+    int *next = floor_ptr->mtimed_wheel_next[mtimed_idx];
+    int head = current_world_ptr->max_m_idx + (int)(current_world_ptr->mtimed_tick & (MTIMED_WHEEL_SIZE - 1));
+    for (int m_idx = next[head], next_idx; m_idx != head; m_idx = next_idx) {
+        next_idx = next[m_idx];
+        if (countdown_remaining(&floor_ptr->m_list[m_idx], mtimed_idx) == 1)
+            process_monsters_mtimed_aux(target_ptr, (MONSTER_IDX)m_idx, mtimed_idx);
+    }
+}
+
+/*!
+ * @brief 全モンスターの各種状態値を時間経過により更新するメインルーチン
+ * @param target_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details
+ * Process the counters of monsters (once per 10 game turns)\n
+ * These functions are to process monsters' counters same as player's.\n
+ * 加速・減速・無敵は値を書き換えず、満了する回の枠に入っているモンスターだけを訪れる。
+ */
+void process_monsters_mtimed(player_type *target_ptr)
+{
+    floor_type *floor_ptr = target_ptr->current_floor_ptr;
+    for (int i = 0; i < MAX_MTIMED; i++) {
+        if (is_mtimed_countdown(i))
+            process_monsters_mtimed_wheel(target_ptr, i);
+        else if (floor_ptr->mproc_max[i] > 0)
+            process_monsters_mtimed_list(target_ptr, i);
+    }
+
+    current_world_ptr->mtimed_tick++;
+}
+
 /*!
  * @brief モンスターへの魔力消去処理
  * @param target_ptr プレーヤーへの参照ポインタ
@@ -561,6 +851,7 @@ void monster_gain_exp(player_type *target_ptr, MONSTER_IDX m_idx, MONRACE_IDX s_
     real_r_ptr(m_ptr)->cur_num++;
 
     m_ptr->ap_r_idx = m_ptr->r_idx;
+    invalidate_pet_summary(floor_ptr);
     r_ptr = &r_info[m_ptr->r_idx];
 
     if (r_ptr->flags1 & RF1_FORCE_MAXHP) {
@@ -768,6 +1059,8 @@ bool mon_take_hit(player_type *target_ptr, MONSTER_IDX m_idx, HIT_POINT dam, boo
             else if (r_ptr->r_tkills < MAX_SHORT)
                 r_ptr->r_tkills++;
 
+            lore_race_kill((m_ptr->mflag2 & MFLAG2_KAGE) ? &r_info[MON_KAGE] : r_ptr);
+
             /* Hack -- Auto-recall */
             monster_race_track(target_ptr, m_ptr->ap_r_idx);
         }
@@ -1026,9 +1319,9 @@ bool monster_is_valid(monster_type *m_ptr) { return (m_ptr->r_idx != 0); }
 
 TIME_EFFECT monster_csleep_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_CSLEEP]; }
 
-TIME_EFFECT monster_fast_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_FAST]; }
+TIME_EFFECT monster_fast_remaining(monster_type *m_ptr) { return countdown_remaining(m_ptr, MTIMED_FAST); }
 
-TIME_EFFECT monster_slow_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_SLOW]; }
+TIME_EFFECT monster_slow_remaining(monster_type *m_ptr) { return countdown_remaining(m_ptr, MTIMED_SLOW); }
 
 TIME_EFFECT monster_stunned_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_STUNNED]; }
 
@@ -1036,4 +1329,4 @@ TIME_EFFECT monster_confused_remaining(monster_type *m_ptr) { return m_ptr->mtim
 
 TIME_EFFECT monster_fear_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_MONFEAR]; }
 
-TIME_EFFECT monster_invulner_remaining(monster_type *m_ptr) { return m_ptr->mtimed[MTIMED_INVULNER]; }
+TIME_EFFECT monster_invulner_remaining(monster_type *m_ptr) { return countdown_remaining(m_ptr, MTIMED_INVULNER); }
@@ -13,7 +13,7 @@ bool monster_is_valid(monster_type *m_ptr);
 void dispel_monster_status(player_type *target_ptr, MONSTER_IDX m_idx);
 void monster_gain_exp(player_type *target_ptr, MONSTER_IDX m_idx, MONRACE_IDX s_idx);
 
-void process_monsters_mtimed(player_type *target_ptr, int mtimed_idx);
+void process_monsters_mtimed(player_type *target_ptr);
 
 TIME_EFFECT monster_csleep_remaining(monster_type *m_ptr);
 TIME_EFFECT monster_fast_remaining(monster_type *m_ptr);
@@ -26,3 +26,11 @@ TIME_EFFECT monster_invulner_remaining(monster_type *m_ptr);
 int get_mproc_idx(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type);
 void mproc_init(floor_type *floor_ptr);
 void mproc_add(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type);
+void mproc_remove(floor_type *floor_ptr, MONSTER_IDX m_idx, int mproc_type);
+void mproc_move(floor_type *floor_ptr, MONSTER_IDX i1, MONSTER_IDX i2);
+void mproc_clear(floor_type *floor_ptr);
+void make_mproc_lists(floor_type *floor_ptr);
+void kill_mproc_lists(floor_type *floor_ptr);
+void update_mproc_sleeper(floor_type *floor_ptr, MONSTER_IDX m_idx);
+void store_mtimed(floor_type *floor_ptr, MONSTER_IDX m_idx, int mtimed_idx, TIME_EFFECT v);
+void reset_mtimed_stamp(monster_type *m_ptr);
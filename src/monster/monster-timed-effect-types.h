@@ -10,3 +10,5 @@ typedef enum monster_timed_effect_type {
     MTIMED_INVULNER = 6, /* Monster is temporarily invulnerable */
     MAX_MTIMED = 7,
 } monster_timed_effect_type;
+
+#define MTIMED_WHEEL_SIZE 256 /*!< 1ずつ減るだけの時限効果を満了する回毎に分ける枠の数 (2の累乗) / Slots of the countdown timing wheel, a power of two */
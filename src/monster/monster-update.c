@@ -15,6 +15,7 @@
 #include "game-option/birth-options.h"
 #include "game-option/disturbance-options.h"
 #include "grid/grid.h"
+#include "lore/lore-journal.h"
 #include "mind/drs-types.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
@@ -46,6 +47,40 @@ typedef struct um_type {
     bool full;
 } um_type;
 
+/*!
+ * @brief モンスターの視認判定に使うプレーヤーの感覚 / Player senses that decide whether a monster is seen
+ * @details 全フィールドを比較するので、作る時は必ず WIPE() してから埋めること。
+ */
+typedef struct monster_sense_type {
+    FLOOR_IDX floor_id;
+    DUNGEON_IDX dungeon_idx;
+    POSITION y;
+    POSITION x;
+    bool blind;
+    bool image;
+    bool see_inv;
+    bool see_nocto;
+    ACTION_SKILL_POWER see_infra;
+    bool radar; /*!< 狙撃の集中度がレーダー感知の閾値を超えているか */
+    bool musou; /*!< 無想の型 */
+    bool telepathy;
+    BIT_FLAGS esp_flags1; /*!< 種族限定テレパシーで感知する種族フラグ1 */
+    BIT_FLAGS esp_flags2; /*!< 種族限定テレパシーで感知する種族フラグ2 */
+    BIT_FLAGS esp_flags3; /*!< 種族限定テレパシーで感知する種族フラグ3 (無生物を除く) */
+    bool esp_nonliving;
+} monster_sense_type;
+
+bool use_monster_sight_cache = TRUE; /*!< 入力の変わらないモンスターの視認判定を省くか (性能計測用) */
+static monster_sense_type monster_senses; /*!< 最後に視認判定に使ったプレーヤーの感覚 */
+static u32b monster_sense_stamp = 1; /*!< monster_senses が変わるたびに増える世代 (0はモンスター側の未判定を表す) */
+
+/*!
+ * @brief 視認判定に使う所在グリッドの情報フラグ / Grid flags that feed the visibility check
+ */
+#define MONSTER_SIGHT_INFO (CAVE_GLOW | CAVE_LITE | CAVE_VIEW | CAVE_MNLT | CAVE_MNDK)
+
+#define MONSTER_SIGHT_VOLATILE 0x08 /*!< sight_flags: 入力が同じでも毎回判定し直す */
+
 /*!
  * @brief 騎乗中のモンスター情報を更新する
  * @param target_ptr プレーヤーへの参照ポインタ
@@ -116,46 +151,25 @@ void update_monster_race_flags(player_type *target_ptr, turn_flags *turn_flags_p
         return;
 
     if (turn_flags_ptr->did_open_door)
-        r_ptr->r_flags2 |= RF2_OPEN_DOOR;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_OPEN_DOOR);
 
     if (turn_flags_ptr->did_bash_door)
-        r_ptr->r_flags2 |= RF2_BASH_DOOR;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_BASH_DOOR);
 
     if (turn_flags_ptr->did_take_item)
-        r_ptr->r_flags2 |= RF2_TAKE_ITEM;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_TAKE_ITEM);
 
     if (turn_flags_ptr->did_kill_item)
-        r_ptr->r_flags2 |= RF2_KILL_ITEM;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_KILL_ITEM);
 
     if (turn_flags_ptr->did_move_body)
-        r_ptr->r_flags2 |= RF2_MOVE_BODY;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_MOVE_BODY);
 
     if (turn_flags_ptr->did_pass_wall)
-        r_ptr->r_flags2 |= RF2_PASS_WALL;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_PASS_WALL);
 
     if (turn_flags_ptr->did_kill_wall)
-        r_ptr->r_flags2 |= RF2_KILL_WALL;
-}
-
-/*!
- * @brief モンスターフラグの更新に基づき、モンスター表示を更新する
- * @param monster_race_idx モンスターID
- * @param window ウィンドウフラグ
- * @param old_race_flags_ptr モンスターフラグへの参照ポインタ
- * @return なし
- */
-void update_player_window(player_type *target_ptr, old_race_flags *old_race_flags_ptr)
-{
-    monster_race *r_ptr;
-    r_ptr = &r_info[target_ptr->monster_race_idx];
-    if ((old_race_flags_ptr->old_r_flags1 != r_ptr->r_flags1) || (old_race_flags_ptr->old_r_flags2 != r_ptr->r_flags2)
-        || (old_race_flags_ptr->old_r_flags3 != r_ptr->r_flags3) || (old_race_flags_ptr->old_r_flags4 != r_ptr->r_flags4)
-        || (old_race_flags_ptr->old_r_flags5 != r_ptr->r_flags5) || (old_race_flags_ptr->old_r_flags6 != r_ptr->r_flags6)
-        || (old_race_flags_ptr->old_r_flagsr != r_ptr->r_flagsr) || (old_race_flags_ptr->old_r_blows0 != r_ptr->r_blows[0])
-        || (old_race_flags_ptr->old_r_blows1 != r_ptr->r_blows[1]) || (old_race_flags_ptr->old_r_blows2 != r_ptr->r_blows[2])
-        || (old_race_flags_ptr->old_r_blows3 != r_ptr->r_blows[3]) || (old_race_flags_ptr->old_r_cast_spell != r_ptr->r_cast_spell)) {
-        target_ptr->window |= PW_MONSTER;
-    }
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_KILL_WALL);
 }
 
 static um_type *initialize_um_type(player_type *subject_ptr, um_type *um_ptr, MONSTER_IDX m_idx, bool full)
@@ -192,10 +206,10 @@ static POSITION decide_updated_distance(player_type *subject_ptr, um_type *um_pt
 static void update_smart_stupid_flags(monster_race *r_ptr)
 {
     if (r_ptr->flags2 & RF2_SMART)
-        r_ptr->r_flags2 |= RF2_SMART;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_SMART);
 
     if (r_ptr->flags2 & RF2_STUPID)
-        r_ptr->r_flags2 |= RF2_STUPID;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_STUPID);
 }
 
 /*!
@@ -215,7 +229,7 @@ static bool update_weird_telepathy(player_type *subject_ptr, um_type *um_ptr)
 
     um_ptr->flag = TRUE;
     if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image) {
-        r_ptr->r_flags2 |= RF2_WEIRD_MIND;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_WEIRD_MIND);
         update_smart_stupid_flags(r_ptr);
     }
 
@@ -238,7 +252,7 @@ static void update_telepathy_sight(player_type *subject_ptr, um_type *um_ptr)
 
     if (r_ptr->flags2 & RF2_EMPTY_MIND) {
         if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags2 |= RF2_EMPTY_MIND;
+            lore_race_flags(r_ptr, LORE_FLAGS2, RF2_EMPTY_MIND);
 
         return;
     }
@@ -251,80 +265,32 @@ static void update_telepathy_sight(player_type *subject_ptr, um_type *um_ptr)
         update_smart_stupid_flags(r_ptr);
 }
 
+/*!
+ * @brief 種族限定テレパシーでモンスターを感知する
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param um_ptr モンスター情報アップデート構造体への参照ポインタ
+ * @return なし
+ * @details 感知する種族フラグは refresh_monster_senses() でまとめてあるので、種族フラグとの論理積だけで判定できる。
+ */
 static void update_specific_race_telepathy(player_type *subject_ptr, um_type *um_ptr)
 {
     monster_race *r_ptr = &r_info[um_ptr->m_ptr->r_idx];
-    if ((subject_ptr->esp_animal) && (r_ptr->flags3 & RF3_ANIMAL)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_ANIMAL;
-    }
-
-    if ((subject_ptr->esp_undead) && (r_ptr->flags3 & RF3_UNDEAD)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_UNDEAD;
-    }
-
-    if ((subject_ptr->esp_demon) && (r_ptr->flags3 & RF3_DEMON)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_DEMON;
-    }
-
-    if ((subject_ptr->esp_orc) && (r_ptr->flags3 & RF3_ORC)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_ORC;
-    }
-
-    if ((subject_ptr->esp_troll) && (r_ptr->flags3 & RF3_TROLL)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_TROLL;
-    }
-
-    if ((subject_ptr->esp_giant) && (r_ptr->flags3 & RF3_GIANT)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_GIANT;
-    }
-
-    if ((subject_ptr->esp_dragon) && (r_ptr->flags3 & RF3_DRAGON)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_DRAGON;
-    }
+    BIT_FLAGS flags1 = r_ptr->flags1 & monster_senses.esp_flags1;
+    BIT_FLAGS flags2 = r_ptr->flags2 & monster_senses.esp_flags2;
+    BIT_FLAGS flags3 = r_ptr->flags3 & monster_senses.esp_flags3;
+    if (monster_senses.esp_nonliving && ((r_ptr->flags3 & (RF3_DEMON | RF3_UNDEAD | RF3_NONLIVING)) == RF3_NONLIVING))
+        flags3 |= RF3_NONLIVING;
 
-    if ((subject_ptr->esp_human) && (r_ptr->flags2 & RF2_HUMAN)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags2 |= RF2_HUMAN;
-    }
-
-    if ((subject_ptr->esp_evil) && (r_ptr->flags3 & RF3_EVIL)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_EVIL;
-    }
-
-    if ((subject_ptr->esp_good) && (r_ptr->flags3 & RF3_GOOD)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_GOOD;
-    }
+    if (!flags1 && !flags2 && !flags3)
+        return;
 
-    if ((subject_ptr->esp_nonliving) && ((r_ptr->flags3 & (RF3_DEMON | RF3_UNDEAD | RF3_NONLIVING)) == RF3_NONLIVING)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags3 |= RF3_NONLIVING;
-    }
+    um_ptr->flag = TRUE;
+    if (!is_original_ap(um_ptr->m_ptr) || subject_ptr->image)
+        return;
 
-    if ((subject_ptr->esp_unique) && (r_ptr->flags1 & RF1_UNIQUE)) {
-        um_ptr->flag = TRUE;
-        if (is_original_ap(um_ptr->m_ptr) && !subject_ptr->image)
-            r_ptr->r_flags1 |= RF1_UNIQUE;
-    }
+    lore_race_flags(r_ptr, LORE_FLAGS1, flags1);
+    lore_race_flags(r_ptr, LORE_FLAGS2, flags2);
+    lore_race_flags(r_ptr, LORE_FLAGS3, flags3);
 }
 
 static bool check_cold_blood(player_type *subject_ptr, um_type *um_ptr, const POSITION distance)
@@ -392,10 +358,10 @@ static void decide_sight_invisible_monster(player_type *subject_ptr, um_type *um
         return;
 
     if (do_invisible)
-        r_ptr->r_flags2 |= RF2_INVISIBLE;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_INVISIBLE);
 
     if (do_cold_blood)
-        r_ptr->r_flags2 |= RF2_COLD_BLOOD;
+        lore_race_flags(r_ptr, LORE_FLAGS2, RF2_COLD_BLOOD);
 }
 
 /*!
@@ -473,12 +439,110 @@ static bool update_clear_monster(player_type *subject_ptr, um_type *um_ptr)
 }
 
 /*!
- * @brief モンスターの各情報を更新する / This function updates the monster record of the given monster
+ * @brief 視認判定の結果を表すフラグを返す
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return ml・MFLAG_VIEW・MFLAG2_MARK をまとめたフラグ
+ */
+static BIT_FLAGS8 get_monster_sight_flags(monster_type *m_ptr)
+{
+    return (BIT_FLAGS8)((m_ptr->ml ? 0x01 : 0x00) | ((m_ptr->mflag & MFLAG_VIEW) ? 0x02 : 0x00) | ((m_ptr->mflag2 & MFLAG2_MARK) ? 0x04 : 0x00));
+}
+
+/*!
+ * @brief プレーヤーの感覚を調べ直し、変わっていれば世代を進める / Recollect the player senses and bump the generation on a change
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void refresh_monster_senses(player_type *subject_ptr)
+{
+    monster_sense_type senses;
+    WIPE(&senses, monster_sense_type);
+    senses.floor_id = subject_ptr->floor_id;
+    senses.dungeon_idx = subject_ptr->dungeon_idx;
+    senses.y = subject_ptr->y;
+    senses.x = subject_ptr->x;
+    senses.blind = subject_ptr->blind != 0;
+    senses.image = subject_ptr->image != 0;
+    senses.see_inv = subject_ptr->see_inv != 0;
+    senses.see_nocto = subject_ptr->see_nocto != 0;
+    senses.see_infra = subject_ptr->see_infra;
+    senses.radar = subject_ptr->concent >= CONCENT_RADAR_THRESHOLD;
+    senses.musou = (subject_ptr->special_defense & KATA_MUSOU) != 0;
+    senses.telepathy = subject_ptr->telepathy != 0;
+    senses.esp_flags1 = subject_ptr->esp_unique ? RF1_UNIQUE : 0;
+    senses.esp_flags2 = subject_ptr->esp_human ? RF2_HUMAN : 0;
+    senses.esp_flags3 = (subject_ptr->esp_animal ? RF3_ANIMAL : 0) | (subject_ptr->esp_undead ? RF3_UNDEAD : 0) | (subject_ptr->esp_demon ? RF3_DEMON : 0)
+        | (subject_ptr->esp_orc ? RF3_ORC : 0) | (subject_ptr->esp_troll ? RF3_TROLL : 0) | (subject_ptr->esp_giant ? RF3_GIANT : 0)
+        | (subject_ptr->esp_dragon ? RF3_DRAGON : 0) | (subject_ptr->esp_evil ? RF3_EVIL : 0) | (subject_ptr->esp_good ? RF3_GOOD : 0);
+    senses.esp_nonliving = subject_ptr->esp_nonliving != 0;
+    if (!memcmp(&senses, &monster_senses, sizeof(monster_sense_type)))
+        return;
+
+    COPY(&monster_senses, &senses, monster_sense_type);
+    if (++monster_sense_stamp == 0)
+        monster_sense_stamp = 1;
+}
+
+/*!
+ * @brief 入力が同じでも視認判定の結果が変わり得るかを返す
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return 毎回判定し直す必要があればTRUE
+ * @details
+ * WEIRD_MINDのテレパシーは判定のたびに乱数を振り、壁の中の明るさは周囲のグリッドで決まるので、
+ * これらは入力が同じでも毎回判定し直す。
+ */
+static bool is_monster_sight_volatile(player_type *subject_ptr, monster_type *m_ptr)
+{
+    if (!feat_supports_los(get_feat_mimic(&subject_ptr->current_floor_ptr->grid_array[m_ptr->fy][m_ptr->fx])))
+        return TRUE;
+
+    return monster_senses.telepathy && (r_info[m_ptr->r_idx].flags2 & RF2_WEIRD_MIND) && (m_ptr->cdis <= MAX_SIGHT);
+}
+
+/*!
+ * @brief 視認判定に使った入力を記録する / Remember the inputs of the visibility check just made
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return なし
+ */
+static void remember_monster_sight(player_type *subject_ptr, monster_type *m_ptr)
+{
+    m_ptr->sight_stamp = monster_sense_stamp;
+    m_ptr->sight_y = m_ptr->fy;
+    m_ptr->sight_x = m_ptr->fx;
+    m_ptr->sight_info = (BIT_FLAGS16)(subject_ptr->current_floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].info & MONSTER_SIGHT_INFO);
+    m_ptr->sight_r_idx = m_ptr->r_idx;
+    m_ptr->sight_ap_r_idx = m_ptr->ap_r_idx;
+    m_ptr->sight_flags = get_monster_sight_flags(m_ptr);
+    if (is_monster_sight_volatile(subject_ptr, m_ptr))
+        m_ptr->sight_flags |= MONSTER_SIGHT_VOLATILE;
+}
+
+/*!
+ * @brief 前回の視認判定から入力が変わっていないかを返す / Check whether the last visibility check still holds
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return 判定し直す必要がなければTRUE
+ */
+static bool is_monster_sight_fresh(player_type *subject_ptr, monster_type *m_ptr)
+{
+    if ((m_ptr->sight_stamp != monster_sense_stamp) || (m_ptr->sight_y != m_ptr->fy) || (m_ptr->sight_x != m_ptr->fx))
+        return FALSE;
+    if ((m_ptr->sight_r_idx != m_ptr->r_idx) || (m_ptr->sight_ap_r_idx != m_ptr->ap_r_idx) || (m_ptr->sight_flags != get_monster_sight_flags(m_ptr)))
+        return FALSE;
+
+    return m_ptr->sight_info == (subject_ptr->current_floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].info & MONSTER_SIGHT_INFO);
+}
+
+/*!
+ * @brief モンスターの各情報を更新する (本体) / Update the monster record, assuming the player senses are current
+ * @param subject_ptr プレーヤーへの参照ポインタ
  * @param m_idx 更新するモンスター情報のID
  * @param full プレイヤーとの距離更新を行うならばtrue
  * @return なし
  */
-void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
+static void update_monster_aux(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
 {
     um_type tmp_um;
     um_type *um_ptr = initialize_um_type(subject_ptr, &tmp_um, m_idx, full);
@@ -492,6 +556,9 @@ void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
         um_ptr->flag = TRUE;
 
     decide_sight_invisible_monster(subject_ptr, um_ptr);
+    if (full)
+        update_mproc_sleeper(subject_ptr->current_floor_ptr, m_idx);
+
     if (um_ptr->flag)
         update_invisible_monster(subject_ptr, um_ptr, m_idx);
     else
@@ -505,22 +572,43 @@ void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
         disturb(subject_ptr, TRUE, TRUE);
 }
 
+/*!
+ * @brief モンスターの各情報を更新する / This function updates the monster record of the given monster
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param m_idx 更新するモンスター情報のID
+ * @param full プレイヤーとの距離更新を行うならばtrue
+ * @return なし
+ */
+void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
+{
+    refresh_monster_senses(subject_ptr);
+    update_monster_aux(subject_ptr, m_idx, full);
+    remember_monster_sight(subject_ptr, &subject_ptr->current_floor_ptr->m_list[m_idx]);
+}
+
 /*!
  * todo モンスターの感知状況しか更新していないように見える。関数名変更を検討する
  * @param player_ptr プレーヤーへの参照ポインタ
- * @brief 単純に生存している全モンスターの更新処理を行う / This function simply updates all the (non-dead) monsters (see above).
+ * @brief 生存している全モンスターの更新処理を行う / This function updates all the (non-dead) monsters (see above).
  * @param full 距離更新を行うならtrue
  * @return なし
+ * @details
+ * 距離を更新しない場合は、前回の判定からモンスターの位置・種族・所在グリッドの視界と照明・プレーヤーの感覚の
+ * いずれも変わっていないモンスターを飛ばす。
  */
 void update_monsters(player_type *player_ptr, bool full)
 {
+    refresh_monster_senses(player_ptr);
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
         monster_type *m_ptr = &floor_ptr->m_list[i];
         if (!monster_is_valid(m_ptr))
             continue;
+        if (!full && use_monster_sight_cache && is_monster_sight_fresh(player_ptr, m_ptr))
+            continue;
 
-        update_monster(player_ptr, i, full);
+        update_monster_aux(player_ptr, i, full);
+        remember_monster_sight(player_ptr, m_ptr);
     }
 }
 
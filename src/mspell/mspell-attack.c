@@ -6,6 +6,7 @@
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
 #include "floor/cave.h"
+#include "lore/lore-journal.h"
 #include "monster-floor/monster-move.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-ability1.h"
@@ -293,25 +294,22 @@ static void remember_mspell(msa_type *msa_ptr)
         return;
 
     if (msa_ptr->thrown_spell < 32 * 4) {
-        msa_ptr->r_ptr->r_flags4 |= (1L << (msa_ptr->thrown_spell - 32 * 3));
-        if (msa_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            msa_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(msa_ptr->r_ptr, LORE_FLAGS4, 1L << (msa_ptr->thrown_spell - 32 * 3));
+        lore_race_spell(msa_ptr->r_ptr);
 
         return;
     }
     
     if (msa_ptr->thrown_spell < 32 * 5) {
-        msa_ptr->r_ptr->r_flags5 |= (1L << (msa_ptr->thrown_spell - 32 * 4));
-        if (msa_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            msa_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(msa_ptr->r_ptr, LORE_FLAGS5, 1L << (msa_ptr->thrown_spell - 32 * 4));
+        lore_race_spell(msa_ptr->r_ptr);
 
         return;
     }
     
     if (msa_ptr->thrown_spell < 32 * 6) {
-        msa_ptr->r_ptr->r_flags6 |= (1L << (msa_ptr->thrown_spell - 32 * 5));
-        if (msa_ptr->r_ptr->r_cast_spell < MAX_UCHAR)
-            msa_ptr->r_ptr->r_cast_spell++;
+        lore_race_flags(msa_ptr->r_ptr, LORE_FLAGS6, 1L << (msa_ptr->thrown_spell - 32 * 5));
+        lore_race_spell(msa_ptr->r_ptr);
     }
 }
 
@@ -10,6 +10,7 @@
 #include "core/player-update-types.h"
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
+#include "lore/lore-journal.h"
 #include "mind/drs-types.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
@@ -169,14 +170,14 @@ void spell_RF6_TELE_TO(player_type *target_ptr, MONSTER_IDX m_idx, MONSTER_IDX t
     if (tr_ptr->flagsr & RFR_RES_TELE) {
         if ((tr_ptr->flags1 & RF1_UNIQUE) || (tr_ptr->flagsr & RFR_RES_ALL)) {
             if (is_original_ap_and_seen(target_ptr, t_ptr))
-                tr_ptr->r_flagsr |= RFR_RES_TELE;
+                lore_race_flags(tr_ptr, LORE_FLAGSR, RFR_RES_TELE);
             if (see_monster(target_ptr, t_idx)) {
                 msg_format(_("%^sには効果がなかった。", "%^s is unaffected!"), t_name);
             }
             resists_tele = TRUE;
         } else if (tr_ptr->level > randint1(100)) {
             if (is_original_ap_and_seen(target_ptr, t_ptr))
-                tr_ptr->r_flagsr |= RFR_RES_TELE;
+                lore_race_flags(tr_ptr, LORE_FLAGSR, RFR_RES_TELE);
             if (see_monster(target_ptr, t_idx)) {
                 msg_format(_("%^sは耐性を持っている！", "%^s resists!"), t_name);
             }
@@ -238,14 +239,14 @@ void spell_RF6_TELE_AWAY(player_type *target_ptr, MONSTER_IDX m_idx, MONSTER_IDX
     if (tr_ptr->flagsr & RFR_RES_TELE) {
         if ((tr_ptr->flags1 & RF1_UNIQUE) || (tr_ptr->flagsr & RFR_RES_ALL)) {
             if (is_original_ap_and_seen(target_ptr, t_ptr))
-                tr_ptr->r_flagsr |= RFR_RES_TELE;
+                lore_race_flags(tr_ptr, LORE_FLAGSR, RFR_RES_TELE);
             if (see_monster(target_ptr, t_idx)) {
                 msg_format(_("%^sには効果がなかった。", "%^s is unaffected!"), t_name);
             }
             resists_tele = TRUE;
         } else if (tr_ptr->level > randint1(100)) {
             if (is_original_ap_and_seen(target_ptr, t_ptr))
-                tr_ptr->r_flagsr |= RFR_RES_TELE;
+                lore_race_flags(tr_ptr, LORE_FLAGSR, RFR_RES_TELE);
             if (see_monster(target_ptr, t_idx)) {
                 msg_format(_("%^sは耐性を持っている！", "%^s resists!"), t_name);
             }
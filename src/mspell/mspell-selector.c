@@ -360,7 +360,7 @@ int choose_attack_spell(player_type *target_ptr, msa_type *msa_ptr)
     if (tactic_num && (randint0(100) < 50) && !current_world_ptr->timewalk_m_idx)
         return (tactic[randint0(tactic_num)]);
 
-    if (invul_num && !m_ptr->mtimed[MTIMED_INVULNER] && (randint0(100) < 50))
+    if (invul_num && !monster_invulner_remaining(m_ptr) && (randint0(100) < 50))
         return (invul[randint0(invul_num)]);
 
     if ((m_ptr->hp < m_ptr->maxhp * 3 / 4) && (randint0(100) < 25)) {
@@ -121,9 +121,7 @@ bool activate_judgement(player_type *user_ptr, concptr name)
     msg_format(_("%sはあなたの体力を奪った...", "The %s drains your vitality..."), name);
     take_hit(user_ptr, DAMAGE_LOSELIFE, damroll(3, 8), _("審判の宝石", "the Jewel of Judgement"), -1);
 
-    (void)detect_traps(user_ptr, DETECT_RAD_DEFAULT, TRUE);
-    (void)detect_doors(user_ptr, DETECT_RAD_DEFAULT);
-    (void)detect_stairs(user_ptr, DETECT_RAD_DEFAULT);
+    (void)detect_grids(user_ptr, DETECT_RAD_DEFAULT, DETECT_GRID_FEATURES);
 
     if (get_check(_("帰還の力を使いますか？", "Activate recall? ")))
         (void)recall_player(user_ptr, randint0(21) + 15);
@@ -7,7 +7,6 @@
 
 #include "object-enchant/apply-magic-armor.h"
 #include "artifact/random-art-generator.h"
-#include "inventory/inventory-slot-types.h"
 #include "object-enchant/object-boost.h"
 #include "object-enchant/object-ego.h"
 #include "object/object-kind-hook.h"
@@ -79,30 +78,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            while (TRUE) {
-                bool okay_flag = TRUE;
-                o_ptr->name2 = get_random_ego(INVEN_BODY, TRUE);
-                switch (o_ptr->name2) {
-                case EGO_DWARVEN:
-                    if (o_ptr->tval != TV_HARD_ARMOR) {
-                        okay_flag = FALSE;
-                    }
-
-                    break;
-                case EGO_DRUID:
-                    if (o_ptr->tval != TV_SOFT_ARMOR) {
-                        okay_flag = FALSE;
-                    }
-
-                    break;
-                default:
-                    break;
-                }
-
-                if (okay_flag)
-                    break;
-            }
-
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
             switch (o_ptr->name2) {
             case EGO_RESISTANCE:
                 if (one_in_(4))
@@ -172,7 +148,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
             }
 
             while (TRUE) {
-                o_ptr->name2 = get_random_ego(INVEN_LARM, TRUE);
+                o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
                 if (o_ptr->sval != SV_SMALL_METAL_SHIELD && o_ptr->sval != SV_LARGE_METAL_SHIELD && o_ptr->name2 == EGO_S_DWARVEN) {
                     continue;
                 }
@@ -214,9 +190,9 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 become_random_artifact(owner_ptr, o_ptr, FALSE);
                 break;
             }
-            o_ptr->name2 = get_random_ego(INVEN_HANDS, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
         } else if (power < -1) {
-            o_ptr->name2 = get_random_ego(INVEN_HANDS, FALSE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
         }
 
         break;
@@ -236,7 +212,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            o_ptr->name2 = get_random_ego(INVEN_FEET, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
             switch (o_ptr->name2) {
             case EGO_SLOW_DESCENT:
                 if (one_in_(2)) {
@@ -246,7 +222,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
         } else if (power < -1) {
-            o_ptr->name2 = get_random_ego(INVEN_FEET, FALSE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
         }
 
         break;
@@ -259,65 +235,48 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            while (TRUE) {
-                bool ok_flag = TRUE;
-                o_ptr->name2 = get_random_ego(INVEN_HEAD, TRUE);
-
-                switch (o_ptr->name2) {
-                case EGO_TELEPATHY:
-                    if (add_esp_strong(o_ptr))
-                        add_esp_weak(o_ptr, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
+            switch (o_ptr->name2) {
+            case EGO_TELEPATHY:
+                if (add_esp_strong(o_ptr))
+                    add_esp_weak(o_ptr, TRUE);
+                else
+                    add_esp_weak(o_ptr, FALSE);
+                break;
+            case EGO_MAGI:
+            case EGO_MIGHT:
+            case EGO_REGENERATION:
+            case EGO_LORDLINESS:
+            case EGO_BASILISK:
+                break;
+            case EGO_SEEING:
+                if (one_in_(3)) {
+                    if (one_in_(2))
+                        add_esp_strong(o_ptr);
                     else
                         add_esp_weak(o_ptr, FALSE);
-                    break;
-                case EGO_MAGI:
-                case EGO_MIGHT:
-                case EGO_REGENERATION:
-                case EGO_LORDLINESS:
-                case EGO_BASILISK:
-                    break;
-                case EGO_SEEING:
-                    if (one_in_(3)) {
-                        if (one_in_(2))
-                            add_esp_strong(o_ptr);
-                        else
-                            add_esp_weak(o_ptr, FALSE);
-                    }
-                    break;
-                default:
-                    /* not existing crown (wisdom,lite, etc...) */
-                    ok_flag = FALSE;
                 }
-
-                if (ok_flag)
-                    break;
+                break;
             }
 
             break;
         } else if (power < -1) {
-            while (TRUE) {
-                bool ok_flag = TRUE;
-                o_ptr->name2 = get_random_ego(INVEN_HEAD, FALSE);
-
-                switch (o_ptr->name2) {
-                case EGO_ANCIENT_CURSE:
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_NO_MAGIC);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_NO_TELE);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_TY_CURSE);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_EXP);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_HP);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
-                    break;
-                }
-
-                if (ok_flag)
-                    break;
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
+            switch (o_ptr->name2) {
+            case EGO_ANCIENT_CURSE:
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_NO_MAGIC);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_NO_TELE);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_TY_CURSE);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_EXP);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_HP);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
+                break;
             }
         }
 
@@ -337,75 +296,56 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            while (TRUE) {
-                bool ok_flag = TRUE;
-                o_ptr->name2 = get_random_ego(INVEN_HEAD, TRUE);
-                switch (o_ptr->name2) {
-                case EGO_BRILLIANCE:
-                case EGO_DARK:
-                case EGO_INFRAVISION:
-                case EGO_H_PROTECTION:
-                    break;
-                case EGO_SEEING:
-                    if (one_in_(7)) {
-                        if (one_in_(2))
-                            add_esp_strong(o_ptr);
-                        else
-                            add_esp_weak(o_ptr, FALSE);
-                    }
-
-                    break;
-                case EGO_LITE:
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_LITE_1);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_LITE_2);
-                    break;
-                case EGO_H_DEMON:
-                    if (one_in_(3))
-                        o_ptr->curse_flags |= (TRC_HEAVY_CURSE);
-                    one_in_(3) ? add_flag(o_ptr->art_flags, TR_DRAIN_EXP)
-                               : one_in_(2) ? add_flag(o_ptr->art_flags, TR_DRAIN_HP) : add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
-
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_AGGRAVATE);
-                    if (one_in_(3))
-                        add_flag(o_ptr->art_flags, TR_ADD_L_CURSE);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_ADD_H_CURSE);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_HP);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_DRAIN_EXP);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_TY_CURSE);
-                    if (one_in_(5))
-                        add_flag(o_ptr->art_flags, TR_CALL_DEMON);
-                    break;
-                default:
-                    /* not existing helm (Magi, Might, etc...)*/
-                    ok_flag = FALSE;
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
+            switch (o_ptr->name2) {
+            case EGO_BRILLIANCE:
+            case EGO_DARK:
+            case EGO_INFRAVISION:
+            case EGO_H_PROTECTION:
+                break;
+            case EGO_SEEING:
+                if (one_in_(7)) {
+                    if (one_in_(2))
+                        add_esp_strong(o_ptr);
+                    else
+                        add_esp_weak(o_ptr, FALSE);
                 }
-                if (ok_flag)
-                    break;
+
+                break;
+            case EGO_LITE:
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_LITE_1);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_LITE_2);
+                break;
+            case EGO_H_DEMON:
+                if (one_in_(3))
+                    o_ptr->curse_flags |= (TRC_HEAVY_CURSE);
+                one_in_(3) ? add_flag(o_ptr->art_flags, TR_DRAIN_EXP)
+                           : one_in_(2) ? add_flag(o_ptr->art_flags, TR_DRAIN_HP) : add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
+
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_AGGRAVATE);
+                if (one_in_(3))
+                    add_flag(o_ptr->art_flags, TR_ADD_L_CURSE);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_ADD_H_CURSE);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_HP);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_MANA);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_DRAIN_EXP);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_TY_CURSE);
+                if (one_in_(5))
+                    add_flag(o_ptr->art_flags, TR_CALL_DEMON);
+                break;
             }
 
             break;
         } else if (power < -1) {
-            while (TRUE) {
-                bool ok_flag = TRUE;
-                o_ptr->name2 = get_random_ego(INVEN_HEAD, FALSE);
-
-                switch (o_ptr->name2) {
-                case EGO_ANCIENT_CURSE:
-                    ok_flag = FALSE;
-                }
-
-                if (ok_flag)
-                    break;
-            }
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
         }
 
         break;
@@ -417,7 +357,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 become_random_artifact(owner_ptr, o_ptr, FALSE);
                 break;
             }
-            o_ptr->name2 = get_random_ego(INVEN_OUTER, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
 
             switch (o_ptr->name2) {
             case EGO_BAT:
@@ -439,7 +379,7 @@ void apply_magic_armor(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
             }
 
         } else if (power < -1) {
-            o_ptr->name2 = get_random_ego(INVEN_OUTER, FALSE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
         }
 
         break;
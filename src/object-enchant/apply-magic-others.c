@@ -8,7 +8,6 @@
 #include "object-enchant/apply-magic-others.h"
 #include "artifact/random-art-generator.h"
 #include "game-option/cheat-options.h"
-#include "inventory/inventory-slot-types.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags9.h"
 #include "monster-race/race-indice-types.h"
@@ -67,24 +66,15 @@ void apply_magic_others(player_type *owner_ptr, object_type *o_ptr, int power)
         if (power > 2) {
             become_random_artifact(owner_ptr, o_ptr, FALSE);
         } else if ((power == 2) || ((power == 1) && one_in_(3))) {
-            while (!o_ptr->name2) {
-                while (TRUE) {
-                    bool okay_flag = TRUE;
+            while (TRUE) {
+                o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
+                if (o_ptr->name2 == EGO_LITE_LONG && o_ptr->sval == SV_LITE_FEANOR)
+                    continue;
 
-                    o_ptr->name2 = get_random_ego(INVEN_LITE, TRUE);
-
-                    switch (o_ptr->name2) {
-                    case EGO_LITE_LONG:
-                        if (o_ptr->sval == SV_LITE_FEANOR)
-                            okay_flag = FALSE;
-                    }
-
-                    if (okay_flag)
-                        break;
-                }
+                break;
             }
         } else if (power == -2) {
-            o_ptr->name2 = get_random_ego(INVEN_LITE, FALSE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
             switch (o_ptr->name2) {
             case EGO_LITE_DARKNESS:
                 o_ptr->xtra4 = 0;
@@ -7,7 +7,6 @@
 
 #include "object-enchant/apply-magic-weapon.h"
 #include "artifact/random-art-generator.h"
-#include "inventory/inventory-slot-types.h"
 #include "object-enchant/object-boost.h"
 #include "object-enchant/object-ego.h"
 #include "object-enchant/tr-types.h"
@@ -88,16 +87,7 @@ void apply_magic_weapon(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 become_random_artifact(owner_ptr, o_ptr, FALSE);
                 break;
             }
-            while (TRUE) {
-                o_ptr->name2 = get_random_ego(INVEN_RARM, TRUE);
-                if (o_ptr->name2 == EGO_SHARPNESS && o_ptr->tval != TV_SWORD)
-                    continue;
-                if (o_ptr->name2 == EGO_EARTHQUAKES && o_ptr->tval != TV_HAFTED)
-                    continue;
-                if (o_ptr->name2 == EGO_WEIRD && o_ptr->tval != TV_SWORD)
-                    continue;
-                break;
-            }
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
 
             switch (o_ptr->name2) {
             case EGO_HA:
@@ -192,14 +182,7 @@ void apply_magic_weapon(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
             }
         } else if (power < -1) {
             if (randint0(MAX_DEPTH) < level) {
-                while (TRUE) {
-                    o_ptr->name2 = get_random_ego(INVEN_RARM, FALSE);
-                    if (o_ptr->name2 == EGO_WEIRD && o_ptr->tval != TV_SWORD) {
-                        continue;
-                    }
-
-                    break;
-                }
+                o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
 
                 switch (o_ptr->name2) {
                 case EGO_MORGUL:
@@ -222,7 +205,7 @@ void apply_magic_weapon(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            o_ptr->name2 = get_random_ego(INVEN_BOW, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
         }
 
         break;
@@ -237,7 +220,7 @@ void apply_magic_weapon(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 break;
             }
 
-            o_ptr->name2 = get_random_ego(INVEN_AMMO, TRUE);
+            o_ptr->name2 = get_random_ego(o_ptr->tval, TRUE);
             switch (o_ptr->name2) {
             case EGO_SLAYING_BOLT:
                 o_ptr->dd++;
@@ -251,7 +234,7 @@ void apply_magic_weapon(player_type *owner_ptr, object_type *o_ptr, DEPTH level,
                 o_ptr->dd = 9;
         } else if (power < -1) {
             if (randint0(MAX_DEPTH) < level) {
-                o_ptr->name2 = get_random_ego(INVEN_AMMO, FALSE);
+                o_ptr->name2 = get_random_ego(o_ptr->tval, FALSE);
             }
         }
 
@@ -5,6 +5,7 @@
  * @details Ego-Item indexes (see "lib/edit/e_info.txt")
  */
 #include "object-enchant/object-ego.h"
+#include "inventory/inventory-slot-types.h"
 
 /*
  * The ego-item arrays
@@ -19,36 +20,194 @@ char *e_text;
 EGO_IDX max_e_idx;
 
 /*!
- * @brief アイテムのエゴをレア度の重みに合わせてランダムに選択する
- * Choose random ego type
- * @param slot 取得したいエゴの装備部位
- * @param good TRUEならば通常のエゴ、FALSEならば呪いのエゴが選択対象となる。
- * @return 選択されたエゴ情報のID、万一選択できなかった場合はmax_e_idxが返る。
+ * @brief エゴの出現候補表 / Precomputed ego candidates for one base-item tval
+ * @details 重みはレア度から求めた累積値で、昇順に並ぶ。
  */
-byte get_random_ego(byte slot, bool good)
+typedef struct ego_candidate_table {
+    int num; /*!< 候補数 / Number of candidates */
+    EGO_IDX *egos; /*!< 候補エゴのID / Candidate ego ids in e_info order */
+    s32b *weights; /*!< 累積重み / Cumulative weights */
+} ego_candidate_table;
+
+/*! tvalと祝福/呪いごとのエゴ候補表 / Ego candidates by tval, [0] for cursed and [1] for good ones */
+static ego_candidate_table ego_candidates[TV_EQUIP_END + 1][2];
+
+/*!
+ * @brief ベースアイテムのtvalからエゴの装備部位を得る / Get the ego slot for a tval
+ * @param tval ベースアイテムのtval
+ * @return 装備部位、エゴの付かないtvalならば-1
+ */
+static INVENTORY_IDX get_ego_slot(tval_type tval)
 {
-    long total = 0L;
-    for (int i = 1; i < max_e_idx; i++) {
-        ego_item_type *e_ptr;
-        e_ptr = &e_info[i];
-        if (e_ptr->slot == slot && ((good && e_ptr->rating) || (!good && !e_ptr->rating))) {
-            if (e_ptr->rarity)
-                total += (255 / e_ptr->rarity);
+    switch (tval) {
+    case TV_SHOT:
+    case TV_ARROW:
+    case TV_BOLT:
+        return INVEN_AMMO;
+    case TV_BOW:
+        return INVEN_BOW;
+    case TV_HAFTED:
+    case TV_POLEARM:
+    case TV_SWORD:
+        return INVEN_RARM;
+    case TV_BOOTS:
+        return INVEN_FEET;
+    case TV_GLOVES:
+        return INVEN_HANDS;
+    case TV_HELM:
+    case TV_CROWN:
+        return INVEN_HEAD;
+    case TV_SHIELD:
+        return INVEN_LARM;
+    case TV_CLOAK:
+        return INVEN_OUTER;
+    case TV_SOFT_ARMOR:
+    case TV_HARD_ARMOR:
+    case TV_DRAG_ARMOR:
+        return INVEN_BODY;
+    case TV_LITE:
+        return INVEN_LITE;
+    default:
+        return -1;
+    }
+}
+
+/*!
+ * @brief エゴがtvalのベースアイテムに付き得るかを判定する / Check an ego against the base-item tval
+ * @param e_idx エゴのID
+ * @param tval ベースアイテムのtval
+ * @param good TRUEならば通常のエゴ、FALSEならば呪いのエゴとして判定する
+ * @return 付き得るならばTRUE
+ * @details 以前はapply_magic側で引き直していた組み合わせをここで除外する。
+ * svalに依存する組み合わせ (小型/大型の金属盾以外のドワーフ盾など) は呼び出し側で判定する。
+ */
+static bool is_ego_for_tval(EGO_IDX e_idx, tval_type tval, bool good)
+{
+    switch (e_idx) {
+    case EGO_DWARVEN:
+        return tval == TV_HARD_ARMOR;
+    case EGO_DRUID:
+        return tval == TV_SOFT_ARMOR;
+    case EGO_SHARPNESS:
+    case EGO_WEIRD:
+        return tval == TV_SWORD;
+    case EGO_EARTHQUAKES:
+        return tval == TV_HAFTED;
+    default:
+        break;
+    }
+
+    if (tval == TV_CROWN && good) {
+        switch (e_idx) {
+        case EGO_TELEPATHY:
+        case EGO_MAGI:
+        case EGO_MIGHT:
+        case EGO_REGENERATION:
+        case EGO_LORDLINESS:
+        case EGO_BASILISK:
+        case EGO_SEEING:
+            return TRUE;
+        default:
+            return FALSE;
         }
     }
 
-    int value = randint1(total);
-    int j;
-    for (j = 1; j < max_e_idx; j++) {
-        ego_item_type *e_ptr;
-        e_ptr = &e_info[j];
-        if (e_ptr->slot == slot && ((good && e_ptr->rating) || (!good && !e_ptr->rating))) {
-            if (e_ptr->rarity)
-                value -= (255 / e_ptr->rarity);
-            if (value <= 0L)
-                break;
+    if (tval == TV_HELM && good) {
+        switch (e_idx) {
+        case EGO_BRILLIANCE:
+        case EGO_DARK:
+        case EGO_INFRAVISION:
+        case EGO_H_PROTECTION:
+        case EGO_SEEING:
+        case EGO_LITE:
+        case EGO_H_DEMON:
+            return TRUE;
+        default:
+            return FALSE;
         }
     }
 
-    return (byte)j;
+    if (tval == TV_HELM && !good)
+        return e_idx != EGO_ANCIENT_CURSE;
+
+    return TRUE;
+}
+
+/*!
+ * @brief エゴの出現候補表を構築する / Build the ego candidate tables
+ * @return なし
+ * @details e_infoの読み込み後に一度だけ呼ぶ。
+ */
+void init_ego_candidates(void)
+{
+    for (int tval = 0; tval <= TV_EQUIP_END; tval++) {
+        INVENTORY_IDX slot = get_ego_slot((tval_type)tval);
+        if (slot < 0)
+            continue;
+
+        for (int good = 0; good < 2; good++) {
+            ego_candidate_table *table = &ego_candidates[tval][good];
+            int num = 0;
+            for (EGO_IDX i = 1; i < max_e_idx; i++) {
+                ego_item_type *e_ptr = &e_info[i];
+                if (e_ptr->slot != slot || (e_ptr->rating != 0) != (good != 0) || !e_ptr->rarity)
+                    continue;
+
+                if (is_ego_for_tval(i, (tval_type)tval, good))
+                    num++;
+            }
+
+            table->num = num;
+            if (!num)
+                continue;
+
+            C_MAKE(table->egos, num, EGO_IDX);
+            C_MAKE(table->weights, num, s32b);
+            s32b total = 0;
+            num = 0;
+            for (EGO_IDX i = 1; i < max_e_idx; i++) {
+                ego_item_type *e_ptr = &e_info[i];
+                if (e_ptr->slot != slot || (e_ptr->rating != 0) != (good != 0) || !e_ptr->rarity)
+                    continue;
+
+                if (!is_ego_for_tval(i, (tval_type)tval, good))
+                    continue;
+
+                total += 255 / e_ptr->rarity;
+                table->egos[num] = i;
+                table->weights[num] = total;
+                num++;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief アイテムのエゴをレア度の重みに合わせてランダムに選択する
+ * Choose random ego type
+ * @param tval エゴを付けたいベースアイテムのtval
+ * @param good TRUEならば通常のエゴ、FALSEならば呪いのエゴが選択対象となる。
+ * @return 選択されたエゴ情報のID、候補がなければ0が返る。
+ */
+EGO_IDX get_random_ego(tval_type tval, bool good)
+{
+    if (tval > TV_EQUIP_END)
+        return 0;
+
+    ego_candidate_table *table = &ego_candidates[tval][good ? 1 : 0];
+    if (!table->num)
+        return 0;
+
+    s32b value = randint1(table->weights[table->num - 1]);
+    int low = 0;
+    int high = table->num - 1;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (table->weights[mid] < value)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return table->egos[low];
 }
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "system/angband.h"
+#include "object/tval-types.h"
 #include "system/object-type-definition.h"
 
 /* Body Armor */
@@ -243,4 +244,5 @@ extern ego_item_type *e_info;
 extern char *e_name;
 extern char *e_text;
 
-byte get_random_ego(byte slot, bool good);
+void init_ego_candidates(void);
+EGO_IDX get_random_ego(tval_type tval, bool good);
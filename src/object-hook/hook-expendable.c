@@ -7,6 +7,7 @@
 #include "object-enchant/special-object-flags.h"
 #include "object-hook/hook-checker.h"
 #include "object-hook/hook-enchant.h"
+#include "object/object-info.h"
 #include "object/object-kind.h"
 #include "perception/object-perception.h"
 #include "player/mimic-info-table.h"
@@ -125,6 +126,7 @@ bool can_player_destroy_object(player_type *player_ptr, object_type *o_ptr)
 
         o_ptr->feeling = feel;
         o_ptr->ident |= IDENT_SENSE;
+        update_object_state_version();
         player_ptr->update |= (PU_COMBINE);
         player_ptr->window |= (PW_INVEN | PW_EQUIP);
         return FALSE;
@@ -463,12 +463,7 @@ void exe_quaff_potion(player_type *creature_ptr, INVENTORY_IDX item)
             wiz_lite(creature_ptr, FALSE);
             (void)do_inc_stat(creature_ptr, A_INT);
             (void)do_inc_stat(creature_ptr, A_WIS);
-            (void)detect_traps(creature_ptr, DETECT_RAD_DEFAULT, TRUE);
-            (void)detect_doors(creature_ptr, DETECT_RAD_DEFAULT);
-            (void)detect_stairs(creature_ptr, DETECT_RAD_DEFAULT);
-            (void)detect_treasure(creature_ptr, DETECT_RAD_DEFAULT);
-            (void)detect_objects_gold(creature_ptr, DETECT_RAD_DEFAULT);
-            (void)detect_objects_normal(creature_ptr, DETECT_RAD_DEFAULT);
+            (void)detect_grids(creature_ptr, DETECT_RAD_DEFAULT, DETECT_GRID_FEATURES | DETECT_GRID_TREASURE | DETECT_GRID_OBJECTS_GOLD | DETECT_GRID_OBJECTS_NORMAL);
             identify_pack(creature_ptr);
             self_knowledge(creature_ptr);
             ident = TRUE;
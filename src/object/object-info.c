@@ -292,3 +292,21 @@ TERM_COLOR object_attr(object_type *o_ptr)
                     ? (k_info[o_ptr->k_idx].x_attr)
                     : (r_info[o_ptr->pval].x_attr)));
 }
+
+u32b object_state_version = 1; /*!< アイテムの状態の版 */
+
+/*!
+ * @brief アイテムの状態の版を進める / Advance the version of the object states
+ * @return なし
+ * @details
+ * 自動拾いの判定結果のキャッシュはこの版1つだけを鍵にするので、判定条件が変わる時は全てここを通す。
+ * アイテム自身の変化 (鑑定・簡易鑑定・銘・充填等) に加え、自動拾いの登録内容、ベースアイテムの認識、
+ * プレイヤーの所持品・職業領域 (PU_BONUS)、賞金首やクエストの達成状況が変わった時にも呼ぶ。
+ * 版が変わると、それまでに覚えた自動拾いの判定結果は全て使われなくなる。
+ */
+void update_object_state_version(void)
+{
+    object_state_version++;
+    if (object_state_version == 0)
+        object_state_version = 1;
+}
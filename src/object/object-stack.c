@@ -10,6 +10,7 @@
 #include "object-enchant/special-object-flags.h"
 #include "object-enchant/trc-types.h"
 #include "object-hook/hook-enchant.h"
+#include "object/object-info.h"
 #include "object/object-kind.h"
 #include "object/object-value.h"
 #include "perception/object-perception.h"
@@ -258,6 +259,8 @@ void object_absorb(object_type *o_ptr, object_type *j_ptr)
         o_ptr->inscription = j_ptr->inscription;
     if (j_ptr->feeling)
         o_ptr->feeling = j_ptr->feeling;
+    if (j_ptr->inscription || j_ptr->feeling)
+        update_object_state_version();
     if (o_ptr->discount < j_ptr->discount)
         o_ptr->discount = j_ptr->discount;
     if (o_ptr->tval == TV_ROD) {
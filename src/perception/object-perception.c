@@ -1,4 +1,5 @@
 ﻿#include "perception/object-perception.h"
+#include "flavor/flavor-cache.h"
 #include "flavor/flavor-describer.h"
 #include "flavor/object-flavor-types.h"
 #include "game-option/play-record-options.h"
@@ -8,6 +9,7 @@
 #include "object-enchant/trg-types.h"
 #include "object/item-tester-hooker.h" // 暫定、このファイルへ引っ越す.
 #include "object/object-generator.h"
+#include "object/object-info.h"
 #include "object/object-kind.h"
 
 /*!
@@ -34,6 +36,7 @@ void object_known(object_type *o_ptr)
     o_ptr->ident &= ~(IDENT_SENSE);
     o_ptr->ident &= ~(IDENT_EMPTY);
     o_ptr->ident |= (IDENT_KNOWN);
+    update_object_state_version();
 }
 
 /*!
@@ -46,6 +49,8 @@ void object_known(object_type *o_ptr)
 void object_aware(player_type *owner_ptr, object_type *o_ptr)
 {
     k_info[o_ptr->k_idx].aware = TRUE;
+    reset_flavor_cache();
+    update_object_state_version();
 
     bool mihanmei = !object_is_aware(o_ptr);
     bool is_undefined = mihanmei && !(k_info[o_ptr->k_idx].gen_flags & TRG_INSTA_ART) && record_ident && !owner_ptr->is_dead
@@ -72,7 +77,12 @@ void object_aware(player_type *owner_ptr, object_type *o_ptr)
  * @param o_ptr 試行済にするオブジェクトの構造体参照ポインタ
  * @return なし
  */
-void object_tried(object_type *o_ptr) { k_info[o_ptr->k_idx].tried = TRUE; }
+void object_tried(object_type *o_ptr)
+{
+    k_info[o_ptr->k_idx].tried = TRUE;
+    reset_flavor_cache();
+    update_object_state_version();
+}
 
 /*
  * @brief 与えられたオブジェクトのベースアイテムが鑑定済かを返す / Determine if a given inventory item is "aware"
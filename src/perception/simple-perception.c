@@ -107,6 +107,7 @@ static void sense_inventory_aux(player_type *creature_ptr, INVENTORY_IDX slot, b
 
     o_ptr->ident |= (IDENT_SENSE);
     o_ptr->feeling = feel;
+    update_object_state_version();
 
     autopick_alter_item(creature_ptr, slot, destroy_feeling);
     creature_ptr->update |= (PU_COMBINE | PU_REORDER);
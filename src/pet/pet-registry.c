@@ -0,0 +1,319 @@
+﻿/*!
+ * @brief ペット・友好モンスターの一覧 / Registry of the pets and friendly monsters of a floor
+ * @date 2026/10/19
+ * @details
+ * フロアごとにペットと友好モンスターの添字を昇順に並べた一覧を持ち、
+ * ペットを探すためにモンスター配列全体を走査しなくて済むようにする。
+ * 一覧は set_pet()・set_friendly()・set_hostile()・モンスターの削除と圧縮で更新し、
+ * 読み込みやフロア移動のようにモンスター配列をまとめて書き換えた後は無効化して、次の参照時に作り直す。
+ * 属性とペットの維持コストの元になる集計値も一覧が変わるまで保持する。
+ */
+
+#include "pet/pet-registry.h"
+#include "monster-race/monster-race.h"
+#include "monster-race/race-flags1.h"
+#include "monster-race/race-flags3.h"
+#include "monster-race/race-flags7.h"
+#include "monster/monster-info.h"
+#include "monster/monster-status.h"
+#include "player/player-classes-types.h"
+#include "system/floor-type-definition.h"
+#include "system/monster-race-definition.h"
+#include "system/monster-type-definition.h"
+#include "world/world.h"
+
+/*!
+ * @brief 一覧に登録するモンスターかを返す
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return ペットか友好モンスターならTRUE
+ */
+static bool is_registered_monster(monster_type *m_ptr) { return monster_is_valid(m_ptr) && (is_pet(m_ptr) || is_friendly(m_ptr)); }
+
+/*!
+ * @brief 一覧を作り直す / Rebuild the registry from the whole monster list
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ */
+static void rebuild_pet_registry(floor_type *floor_ptr)
+{
+    floor_ptr->pet_max = 0;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        if (is_registered_monster(&floor_ptr->m_list[i]))
+            floor_ptr->pet_list[floor_ptr->pet_max++] = (s16b)i;
+    }
+
+    floor_ptr->pet_list_ready = TRUE;
+    floor_ptr->pet_summary_ready = FALSE;
+}
+
+/*!
+ * @brief 一覧が無効化されていれば作り直す
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ */
+static void prepare_pet_registry(floor_type *floor_ptr)
+{
+    if (!floor_ptr->pet_list_ready)
+        rebuild_pet_registry(floor_ptr);
+}
+
+/*!
+ * @brief 添字が一覧に入るべき位置を二分探索で求める
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param m_idx モンスターの添字
+ * @return 一覧上の位置
+ */
+static MONSTER_NUMBER find_pet_registry_position(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    MONSTER_NUMBER lo = 0;
+    MONSTER_NUMBER hi = floor_ptr->pet_max;
+    while (lo < hi) {
+        MONSTER_NUMBER mid = (lo + hi) / 2;
+        if (floor_ptr->pet_list[mid] < m_idx)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/*!
+ * @brief 添字を一覧に加える
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param m_idx モンスターの添字
+ * @return なし
+ */
+static void insert_pet_registry(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    MONSTER_NUMBER pos = find_pet_registry_position(floor_ptr, m_idx);
+    if ((pos < floor_ptr->pet_max) && (floor_ptr->pet_list[pos] == m_idx))
+        return;
+
+    (void)memmove(&floor_ptr->pet_list[pos + 1], &floor_ptr->pet_list[pos], (floor_ptr->pet_max - pos) * sizeof(s16b));
+    floor_ptr->pet_list[pos] = (s16b)m_idx;
+    floor_ptr->pet_max++;
+}
+
+/*!
+ * @brief 添字を一覧から除く
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param m_idx モンスターの添字
+ * @return なし
+ */
+static void erase_pet_registry(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    MONSTER_NUMBER pos = find_pet_registry_position(floor_ptr, m_idx);
+    if ((pos >= floor_ptr->pet_max) || (floor_ptr->pet_list[pos] != m_idx))
+        return;
+
+    floor_ptr->pet_max--;
+    (void)memmove(&floor_ptr->pet_list[pos], &floor_ptr->pet_list[pos + 1], (floor_ptr->pet_max - pos) * sizeof(s16b));
+}
+
+/*!
+ * @brief 一覧を無効化し、次の参照時に作り直させる / Forget the registry after the monster list was rewritten in bulk
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ */
+void invalidate_pet_registry(floor_type *floor_ptr)
+{
+    floor_ptr->pet_list_ready = FALSE;
+    floor_ptr->pet_summary_ready = FALSE;
+}
+
+/*!
+ * @brief モンスターのいないフロアの一覧にする / Empty the registry along with the monster list
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ */
+void reset_pet_registry(floor_type *floor_ptr)
+{
+    floor_ptr->pet_max = 0;
+    floor_ptr->pet_list_ready = TRUE;
+    floor_ptr->pet_summary_ready = FALSE;
+}
+
+/*!
+ * @brief モンスターの友好状態の変化を一覧に反映する / Register or unregister a monster after set_pet() and friends
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param m_ptr モンスターへの参照ポインタ
+ * @return なし
+ * @details
+ * フロアのモンスター配列の外にあるモンスター (フロア移動中のペット等) は無視する。
+ */
+void update_pet_registry(floor_type *floor_ptr, monster_type *m_ptr)
+{
+    if ((m_ptr < floor_ptr->m_list) || (m_ptr >= floor_ptr->m_list + current_world_ptr->max_m_idx))
+        return;
+
+    floor_ptr->pet_summary_ready = FALSE;
+    if (!floor_ptr->pet_list_ready)
+        return;
+
+    MONSTER_IDX m_idx = (MONSTER_IDX)(m_ptr - floor_ptr->m_list);
+    if (is_registered_monster(m_ptr))
+        insert_pet_registry(floor_ptr, m_idx);
+    else
+        erase_pet_registry(floor_ptr, m_idx);
+}
+
+/*!
+ * @brief 削除されるモンスターを一覧から除く / Unregister a monster being deleted
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param m_idx モンスターの添字
+ * @return なし
+ */
+void remove_pet_registry(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    if (!floor_ptr->pet_list_ready)
+        return;
+
+    MONSTER_NUMBER old_max = floor_ptr->pet_max;
+    erase_pet_registry(floor_ptr, m_idx);
+    if (floor_ptr->pet_max != old_max)
+        floor_ptr->pet_summary_ready = FALSE;
+}
+
+/*!
+ * @brief 圧縮で移動するモンスターの添字を付け替える / Follow a monster moved by compact_monsters()
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param i1 移動元の添字
+ * @param i2 移動先の添字
+ * @return なし
+ */
+void move_pet_registry(floor_type *floor_ptr, MONSTER_IDX i1, MONSTER_IDX i2)
+{
+    if (!floor_ptr->pet_list_ready)
+        return;
+
+    MONSTER_NUMBER old_max = floor_ptr->pet_max;
+    erase_pet_registry(floor_ptr, i1);
+    if (floor_ptr->pet_max == old_max)
+        return;
+
+    insert_pet_registry(floor_ptr, i2);
+    floor_ptr->pet_summary_ready = FALSE;
+}
+
+/*!
+ * @brief 集計値を捨てる / Forget the aggregates after a registered monster changed its race
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ */
+void invalidate_pet_summary(floor_type *floor_ptr) { floor_ptr->pet_summary_ready = FALSE; }
+
+/*!
+ * @brief ペットの数を返す / Count the pets on the floor
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return ペットの数
+ */
+MONSTER_NUMBER count_pets(floor_type *floor_ptr)
+{
+    prepare_pet_registry(floor_ptr);
+    MONSTER_NUMBER num = 0;
+    for (MONSTER_NUMBER i = 0; i < floor_ptr->pet_max; i++) {
+        if (is_pet(&floor_ptr->m_list[floor_ptr->pet_list[i]]))
+            num++;
+    }
+
+    return num;
+}
+
+/*!
+ * @brief ペットの添字を降順に集める / Collect the pets as the backwards scans of m_list did
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param who 添字の格納先 (max_m_idx 要素)
+ * @return ペットの数
+ * @details
+ * 呼び出し元がペットを削除しながら処理できるよう、一覧の写しを返す。
+ */
+MONSTER_NUMBER collect_pets(floor_type *floor_ptr, MONSTER_IDX *who)
+{
+    prepare_pet_registry(floor_ptr);
+    MONSTER_NUMBER num = 0;
+    for (MONSTER_NUMBER i = floor_ptr->pet_max - 1; i >= 0; i--) {
+        MONSTER_IDX m_idx = floor_ptr->pet_list[i];
+        if (is_pet(&floor_ptr->m_list[m_idx]))
+            who[num++] = m_idx;
+    }
+
+    return num;
+}
+
+/*!
+ * @brief 属性と維持コストの集計値を必要なら計算し直す / Recompute the pet aggregates when stale
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details
+ * 騎兵はユニークのペットの扱いが添字の順と騎乗中のモンスターで変わるため、
+ * 従来通り添字の降順に数え、騎乗中のモンスターが変われば計算し直す。
+ */
+static void update_pet_summary(player_type *player_ptr)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    prepare_pet_registry(floor_ptr);
+    if (floor_ptr->pet_summary_ready && (floor_ptr->pet_summary_riding == player_ptr->riding))
+        return;
+
+    bool has_a_unique = FALSE;
+    floor_ptr->pet_num = 0;
+    floor_ptr->pet_align = 0;
+    floor_ptr->pet_upkeep_levels = 0;
+    for (MONSTER_NUMBER i = floor_ptr->pet_max - 1; i >= 0; i--) {
+        MONSTER_IDX m_idx = floor_ptr->pet_list[i];
+        monster_type *m_ptr = &floor_ptr->m_list[m_idx];
+        if (!is_pet(m_ptr))
+            continue;
+
+        monster_race *r_ptr = &r_info[m_ptr->r_idx];
+        if (r_ptr->flags3 & RF3_GOOD)
+            floor_ptr->pet_align += r_ptr->level;
+        if (r_ptr->flags3 & RF3_EVIL)
+            floor_ptr->pet_align -= r_ptr->level;
+
+        floor_ptr->pet_num++;
+        if (!(r_ptr->flags1 & RF1_UNIQUE)) {
+            floor_ptr->pet_upkeep_levels += r_ptr->level;
+            continue;
+        }
+
+        if (player_ptr->pclass != CLASS_CAVALRY)
+            floor_ptr->pet_upkeep_levels += (r_ptr->level + 5) * 10;
+        else if (player_ptr->riding == m_idx)
+            floor_ptr->pet_upkeep_levels += (r_ptr->level + 5) * 2;
+        else if (!has_a_unique && (r_ptr->flags7 & RF7_RIDING))
+            floor_ptr->pet_upkeep_levels += (r_ptr->level + 5) * 7 / 2;
+        else
+            floor_ptr->pet_upkeep_levels += (r_ptr->level + 5) * 10;
+
+        has_a_unique = TRUE;
+    }
+
+    floor_ptr->pet_summary_riding = player_ptr->riding;
+    floor_ptr->pet_summary_ready = TRUE;
+}
+
+/*!
+ * @brief ペットによる属性の増減を返す / Alignment contribution of the pets
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return 属性の増減
+ */
+s32b calc_pet_alignment(player_type *player_ptr)
+{
+    update_pet_summary(player_ptr);
+    return player_ptr->current_floor_ptr->pet_align;
+}
+
+/*!
+ * @brief ペットの維持コストの元になるレベルの合計を返す / Sum of the pet levels weighed for the upkeep
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param num ペットの数の格納先
+ * @return レベルの合計
+ */
+DEPTH calc_pet_upkeep_levels(player_type *player_ptr, MONSTER_NUMBER *num)
+{
+    update_pet_summary(player_ptr);
+    *num = player_ptr->current_floor_ptr->pet_num;
+    return player_ptr->current_floor_ptr->pet_upkeep_levels;
+}
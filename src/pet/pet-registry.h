@@ -0,0 +1,17 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+typedef struct floor_type floor_type;
+typedef struct monster_type monster_type;
+
+void invalidate_pet_registry(floor_type *floor_ptr);
+void reset_pet_registry(floor_type *floor_ptr);
+void update_pet_registry(floor_type *floor_ptr, monster_type *m_ptr);
+void remove_pet_registry(floor_type *floor_ptr, MONSTER_IDX m_idx);
+void move_pet_registry(floor_type *floor_ptr, MONSTER_IDX i1, MONSTER_IDX i2);
+void invalidate_pet_summary(floor_type *floor_ptr);
+MONSTER_NUMBER count_pets(floor_type *floor_ptr);
+MONSTER_NUMBER collect_pets(floor_type *floor_ptr, MONSTER_IDX *who);
+s32b calc_pet_alignment(player_type *player_ptr);
+DEPTH calc_pet_upkeep_levels(player_type *player_ptr, MONSTER_NUMBER *num);
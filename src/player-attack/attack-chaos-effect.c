@@ -12,6 +12,7 @@
 #include "flavor/object-flavor-types.h"
 #include "inventory/inventory-object.h"
 #include "inventory/inventory-slot-types.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
 #include "monster-race/race-flags1.h"
@@ -47,7 +48,7 @@ static void attack_confuse(player_type *attacker_ptr, player_attack_type *pa_ptr
     monster_race *r_ptr = &r_info[pa_ptr->m_ptr->r_idx];
     if (r_ptr->flags3 & RF3_NO_CONF) {
         if (is_original_ap_and_seen(attacker_ptr, pa_ptr->m_ptr))
-            r_ptr->r_flags3 |= RF3_NO_CONF;
+            lore_race_flags(r_ptr, LORE_FLAGS3, RF3_NO_CONF);
         msg_format(_("%^sには効果がなかった。", "%^s is unaffected."), pa_ptr->m_name);
 
     } else if (randint0(100) < r_ptr->level) {
@@ -72,7 +73,7 @@ static bool judge_tereprt_resistance(player_type *attacker_ptr, player_attack_ty
 
     if (r_ptr->flags1 & RF1_UNIQUE) {
         if (is_original_ap_and_seen(attacker_ptr, pa_ptr->m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_TELE;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
         msg_format(_("%^sには効果がなかった。", "%^s is unaffected!"), pa_ptr->m_name);
         return TRUE;
@@ -80,7 +81,7 @@ static bool judge_tereprt_resistance(player_type *attacker_ptr, player_attack_ty
 
     if (r_ptr->level > randint1(100)) {
         if (is_original_ap_and_seen(attacker_ptr, pa_ptr->m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_TELE;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
 
         msg_format(_("%^sは抵抗力を持っている！", "%^s resists!"), pa_ptr->m_name);
         return TRUE;
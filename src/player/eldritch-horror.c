@@ -5,6 +5,7 @@
  */
 
 #include "player/eldritch-horror.h"
+#include "lore/lore-journal.h"
 #include "player/player-status-flags.h"
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
@@ -62,7 +63,7 @@ static void see_eldritch_horror(GAME_TEXT *m_name, monster_race *r_ptr)
 {
     concptr horror_message = decide_horror_message(r_ptr);
     msg_format(_("%s%sの顔を見てしまった！", "You behold the %s visage of %s!"), horror_message, m_name);
-    r_ptr->r_flags2 |= RF2_ELDRITCH_HORROR;
+    lore_race_flags(r_ptr, LORE_FLAGS2, RF2_ELDRITCH_HORROR);
 }
 
 /*!
@@ -75,7 +76,7 @@ static void feel_eldritch_horror(concptr desc, monster_race *r_ptr)
 {
     concptr horror_message = decide_horror_message(r_ptr);
     msg_format(_("%s%sの顔を見てしまった！", "You behold the %s visage of %s!"), horror_message, desc);
-    r_ptr->r_flags2 |= RF2_ELDRITCH_HORROR;
+    lore_race_flags(r_ptr, LORE_FLAGS2, RF2_ELDRITCH_HORROR);
 }
 
 /*!
@@ -0,0 +1,460 @@
+﻿/*!
+ * @brief 能力値計算の依存関係の追跡 / Dependency tracking for calc_bonuses()
+ * @date 2026/10/19
+ * @details
+ * calc_bonuses()の各段は、読む値の分類 (依存先) を宣言している。
+ * 呼び出しの度に一次入力 (装備・一時効果・種族・職業・変異・歌・能力値等) の値を前回の呼び出しと比べ、
+ * 変わった依存先を読む段だけを計算し直す。
+ * 段が計算した値が変わればその値を読む後段も計算し直す。
+ * 前段が後段の値を読む (前回の呼び出しの値を使う) 箇所があるため、変わった計算値は次回の呼び出しにも持ち越す。
+ * 一時効果は効いているかどうか (朦朧は段階) だけを比べるので、残りターン数の減少では計算し直さない。
+ */
+
+#include "player/player-bonus-tracker.h"
+#include "grid/grid.h"
+#include "inventory/inventory-slot-types.h"
+#include "monster/monster-status.h"
+#include "object/object-kind.h"
+#include "object/tval-types.h"
+#include "player/player-status.h"
+#include "system/floor-type-definition.h"
+#include "system/monster-type-definition.h"
+#include "system/object-type-definition.h"
+#include "view/display-messages.h"
+
+/*!
+ * @brief 差分計算の結果を毎回全計算と突き合わせるか / Cross-check every incremental update against a full recomputation
+ */
+bool cross_check_bonuses = FALSE;
+
+/*!
+ * @brief 検証で見つかった食い違いの累計 / Number of mismatches the cross-check has found so far
+ */
+int bonus_cross_check_mismatches = 0;
+
+static bool bonus_dependencies_valid = FALSE; /*!< 前回の一次入力を記録済か */
+static BIT_FLAGS pending_bonus_dependencies = 0L; /*!< 次回の呼び出しに持ち越す変化 */
+static bonus_signature_type last_bonus_inputs[MAX_BONUS_PRIMARY_DEP]; /*!< 前回の呼び出し開始時の一次入力 */
+
+/*!
+ * @brief 計算値の依存先の名前 / Names of the computed dependencies for the cross-check report
+ */
+static concptr bonus_dependency_names[MAX_BONUS_DEP - MAX_BONUS_PRIMARY_DEP] = {
+    "flags",
+    "stat_add",
+    "stat_ind",
+    "armour",
+    "ammo",
+    "wield",
+    "casting",
+    "speed",
+    "skills",
+    "melee",
+    "missile",
+    "misc",
+    "dig",
+};
+
+/*!
+ * @brief 値を列に追加する / Append a value to the signature
+ * @param sig_ptr 追加先
+ * @param data 値への参照ポインタ
+ * @param size 値の長さ
+ * @return なし
+ */
+static void add_bonus_signature(bonus_signature_type *sig_ptr, const void *data, int size)
+{
+    if ((sig_ptr->len < 0) || (sig_ptr->len + size > BONUS_SIGNATURE_MAX)) {
+        sig_ptr->len = -1;
+        return;
+    }
+
+    (void)memcpy(&sig_ptr->data[sig_ptr->len], data, size);
+    sig_ptr->len += size;
+}
+
+#define ADD_BONUS_SIGNATURE(SIG, VALUE) add_bonus_signature((SIG), &(VALUE), sizeof(VALUE))
+
+/*!
+ * @brief 真偽値を列に追加する / Append whether a value is non-zero
+ * @param sig_ptr 追加先
+ * @param value 値
+ * @return なし
+ */
+static void add_bonus_signature_flag(bonus_signature_type *sig_ptr, int value)
+{
+    byte flag = (value != 0) ? 1 : 0;
+    ADD_BONUS_SIGNATURE(sig_ptr, flag);
+}
+
+/*!
+ * @brief 装備品を列に追加する / Append the equipment
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param sig_ptr 追加先
+ * @return なし
+ * @details
+ * 充填時間・光源の燃料の残り・自動拾いのキャッシュ等、能力値に関わらない変化は無視する。
+ * 鑑定済かどうかは未鑑定のベースアイテムの知識にも依るので、それも加える。
+ */
+static void add_bonus_signature_equipment(player_type *creature_ptr, bonus_signature_type *sig_ptr)
+{
+    for (INVENTORY_IDX i = INVEN_RARM; i < INVEN_TOTAL; i++) {
+        object_type item;
+        (void)memcpy(&item, &creature_ptr->inventory_list[i], sizeof(object_type));
+        item.timeout = 0;
+        item.marked = 0;
+        item.autopick_version = 0;
+        item.autopick_idx = 0;
+        if (item.tval == TV_LITE)
+            item.xtra4 = (item.xtra4 != 0) ? 1 : 0;
+
+        ADD_BONUS_SIGNATURE(sig_ptr, item);
+        if (item.k_idx)
+            ADD_BONUS_SIGNATURE(sig_ptr, k_info[item.k_idx].aware);
+    }
+}
+
+/*!
+ * @brief 乗馬を列に追加する / Append the riding state and the steed
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param sig_ptr 追加先
+ * @return なし
+ */
+static void add_bonus_signature_riding(player_type *creature_ptr, bonus_signature_type *sig_ptr)
+{
+    ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->riding);
+    ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->pet_extra_flags);
+    ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->riding_ryoute);
+    if (!creature_ptr->riding)
+        return;
+
+    monster_type *m_ptr = &creature_ptr->current_floor_ptr->m_list[creature_ptr->riding];
+    ADD_BONUS_SIGNATURE(sig_ptr, m_ptr->r_idx);
+    ADD_BONUS_SIGNATURE(sig_ptr, m_ptr->mspeed);
+    add_bonus_signature_flag(sig_ptr, monster_fast_remaining(m_ptr));
+    add_bonus_signature_flag(sig_ptr, monster_slow_remaining(m_ptr));
+}
+
+/*!
+ * @brief 一次入力を列に追加する / Append a primary input
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param dep 依存先
+ * @param sig_ptr 追加先
+ * @return なし
+ */
+static void add_bonus_signature_input(player_type *creature_ptr, BIT_FLAGS dep, bonus_signature_type *sig_ptr)
+{
+    switch (dep) {
+    case BONUS_DEP_EQUIPMENT:
+        add_bonus_signature_equipment(creature_ptr, sig_ptr);
+        break;
+    case BONUS_DEP_WEIGHT: {
+        WEIGHT weight = calc_inventory_weight(creature_ptr);
+        ADD_BONUS_SIGNATURE(sig_ptr, weight);
+        break;
+    }
+    case BONUS_DEP_RACE:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->prace);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->pseikaku);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->mimic_form);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->wt);
+        break;
+    case BONUS_DEP_CLASS:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->pclass);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->realm1);
+        break;
+    case BONUS_DEP_LEVEL:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->lev);
+        break;
+    case BONUS_DEP_MUTATION:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->muta3);
+        break;
+    case BONUS_DEP_STAT:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_max);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_cur);
+        break;
+    case BONUS_DEP_SKILL:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_exp);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->weapon_exp);
+        break;
+    case BONUS_DEP_SONG:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->magic_num1[0]);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->magic_num2[0]);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->concent);
+        break;
+    case BONUS_DEP_STANCE:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->special_defense);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->action);
+        break;
+    case BONUS_DEP_RIDING:
+        add_bonus_signature_riding(creature_ptr, sig_ptr);
+        break;
+    case BONUS_DEP_FOOD:
+        add_bonus_signature_flag(sig_ptr, creature_ptr->food >= PY_FOOD_MAX);
+        break;
+    case BONUS_DEP_TERRAIN: {
+        floor_type *floor_ptr = creature_ptr->current_floor_ptr;
+        ADD_BONUS_SIGNATURE(sig_ptr, floor_ptr->grid_array[creature_ptr->y][creature_ptr->x].feat);
+        break;
+    }
+    case BONUS_DEP_TIMED_SPEED:
+        add_bonus_signature_flag(sig_ptr, creature_ptr->fast);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->slow);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->lightspeed);
+        break;
+    case BONUS_DEP_TIMED_COMBAT: {
+        add_bonus_signature_flag(sig_ptr, creature_ptr->hero);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->shero);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->blessed);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tsuyoshi);
+        byte stun = (creature_ptr->stun > 50) ? 2 : ((creature_ptr->stun > 0) ? 1 : 0);
+        ADD_BONUS_SIGNATURE(sig_ptr, stun);
+        break;
+    }
+    case BONUS_DEP_TIMED_DEFENSE:
+        add_bonus_signature_flag(sig_ptr, creature_ptr->shield);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->magicdef);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tsubureru);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->ult_res);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->resist_magic);
+        break;
+    case BONUS_DEP_TIMED_SENSE:
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_esp);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_invis);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_infra);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_stealth);
+        break;
+    case BONUS_DEP_TIMED_BODY:
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_levitation);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_regen);
+        add_bonus_signature_flag(sig_ptr, creature_ptr->tim_sh_fire);
+        break;
+    default:
+        break;
+    }
+}
+
+/*!
+ * @brief 計算値を列に追加する / Append the values calc_bonuses() computes
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param dep 依存先
+ * @param sig_ptr 追加先
+ * @return なし
+ */
+static void add_bonus_signature_output(player_type *creature_ptr, BIT_FLAGS dep, bonus_signature_type *sig_ptr)
+{
+    switch (dep) {
+    case BONUS_DEP_FLAGS:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->xtra_might);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_evil);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_animal);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_undead);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_demon);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_orc);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_troll);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_giant);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_dragon);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_human);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_good);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_nonliving);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->esp_unique);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->telepathy);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->bless_blade);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->easy_2weapon);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->down_saving);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->yoiyami);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->mighty_throw);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dec_mana);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->see_nocto);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->warning);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->anti_magic);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->anti_tele);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->easy_spell);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->heavy_spell);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->hold_exp);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->see_inv);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->free_act);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->levitation);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->can_swim);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->slow_digest);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->regenerate);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->cursed);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->impact);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->extra_blows);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->lite);
+        break;
+    case BONUS_DEP_STAT_ADD:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_add);
+        break;
+    case BONUS_DEP_STAT_IND:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_top);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_use);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->stat_ind);
+        break;
+    case BONUS_DEP_ARMOUR:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->ac);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_a);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_ac);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_a);
+        break;
+    case BONUS_DEP_AMMO:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->tval_ammo);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->num_fire);
+        break;
+    case BONUS_DEP_WIELD:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->icky_wield);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->riding_wield);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->heavy_wield);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->num_blow);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_dd);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_ds);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_a);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_a);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_h);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_h);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_d);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_d);
+        break;
+    case BONUS_DEP_CASTING:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_m_chance);
+        break;
+    case BONUS_DEP_SPEED:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->pspeed);
+        break;
+    case BONUS_DEP_SKILLS:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->see_infra);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_stl);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_dis);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_dev);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_sav);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_srh);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_fos);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_thn);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_thb);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_tht);
+        break;
+    case BONUS_DEP_MELEE:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_h);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_h);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_d);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_d);
+        break;
+    case BONUS_DEP_MISSILE:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_h_b);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->dis_to_h_b);
+        break;
+    case BONUS_DEP_MISC:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_d_m);
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->to_h_m);
+        break;
+    case BONUS_DEP_DIG:
+        ADD_BONUS_SIGNATURE(sig_ptr, creature_ptr->skill_dig);
+        break;
+    default:
+        add_bonus_signature_input(creature_ptr, dep, sig_ptr);
+        break;
+    }
+}
+
+/*!
+ * @brief 依存先の現在の値を並べる / Lay out the current values of a set of dependencies
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param deps 依存先 (BONUS_DEP_*の組み合わせ)
+ * @param sig_ptr 並べた値の格納先
+ * @return なし
+ */
+void make_bonus_signature(player_type *creature_ptr, BIT_FLAGS deps, bonus_signature_type *sig_ptr)
+{
+    sig_ptr->len = 0;
+    for (int i = 0; i < MAX_BONUS_DEP; i++)
+        if (deps & (1UL << i))
+            add_bonus_signature_output(creature_ptr, 1UL << i, sig_ptr);
+}
+
+/*!
+ * @brief 並べた値が等しいかを返す / Whether two signatures match
+ * @param sig1_ptr 比較する値
+ * @param sig2_ptr 比較する値
+ * @return 等しければTRUE (どちらかが長すぎて収まらなかった場合は常にFALSE)
+ */
+bool same_bonus_signature(bonus_signature_type *sig1_ptr, bonus_signature_type *sig2_ptr)
+{
+    if ((sig1_ptr->len < 0) || (sig1_ptr->len != sig2_ptr->len))
+        return FALSE;
+
+    return memcmp(sig1_ptr->data, sig2_ptr->data, sig1_ptr->len) == 0;
+}
+
+/*!
+ * @brief 次の呼び出しで全て計算し直させる / Force the next calc_bonuses() to recompute everything
+ * @return なし
+ * @details プレーヤーの構造体を丸ごと初期化・置換した時に呼ぶ。
+ */
+void invalidate_bonus_dependencies(void)
+{
+    bonus_dependencies_valid = FALSE;
+    pending_bonus_dependencies = 0L;
+}
+
+/*!
+ * @brief 前回の呼び出しから変わった依存先を求める / Find the dependencies changed since the previous call
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return 計算し直すべき依存先
+ */
+BIT_FLAGS begin_bonus_dependencies(player_type *creature_ptr)
+{
+    BIT_FLAGS dirty = pending_bonus_dependencies;
+    pending_bonus_dependencies = 0L;
+    for (int i = 0; i < MAX_BONUS_PRIMARY_DEP; i++) {
+        bonus_signature_type *last_ptr = &last_bonus_inputs[i];
+        bonus_signature_type current;
+        make_bonus_signature(creature_ptr, 1UL << i, &current);
+        if (bonus_dependencies_valid && same_bonus_signature(&current, last_ptr))
+            continue;
+
+        dirty |= 1UL << i;
+        last_ptr->len = current.len;
+        if (current.len > 0)
+            (void)memcpy(last_ptr->data, current.data, current.len);
+    }
+
+    if (!bonus_dependencies_valid) {
+        bonus_dependencies_valid = TRUE;
+        return BONUS_DEP_ALL;
+    }
+
+    return dirty;
+}
+
+/*!
+ * @brief 今回変わった計算値を次回の呼び出しに持ち越す / Carry the changed computed values over to the next call
+ * @param changed 今回の呼び出しで変わった依存先
+ * @return なし
+ */
+void end_bonus_dependencies(BIT_FLAGS changed) { pending_bonus_dependencies = changed & ~BONUS_DEP_PRIMARY; }
+
+/*!
+ * @brief 差分計算の結果を全計算の結果と突き合わせる / Compare an incremental update with a full one
+ * @param expected_ptr 全て計算し直したプレーヤー
+ * @param actual_ptr 差分計算したプレーヤー
+ * @return 食い違った依存先の数
+ */
+int cross_check_bonus_dependencies(player_type *expected_ptr, player_type *actual_ptr)
+{
+    int mismatch = 0;
+    for (int i = MAX_BONUS_PRIMARY_DEP; i < MAX_BONUS_DEP; i++) {
+        bonus_signature_type expected;
+        bonus_signature_type actual;
+        make_bonus_signature(expected_ptr, 1UL << i, &expected);
+        make_bonus_signature(actual_ptr, 1UL << i, &actual);
+        if (same_bonus_signature(&expected, &actual))
+            continue;
+
+        msg_format(_("能力値の差分計算が全計算と食い違った (%s)。", "Incremental bonuses differ from a full update (%s)."),
+            bonus_dependency_names[i - MAX_BONUS_PRIMARY_DEP]);
+        mismatch++;
+    }
+
+    bonus_cross_check_mismatches += mismatch;
+    return mismatch;
+}
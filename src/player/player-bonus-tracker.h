@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+/*!
+ * @brief 能力値計算の依存先 / What the parts of calc_bonuses() depend on
+ * @details
+ * EQUIPMENT〜TIMED_BODYは計算の外から変わる一次入力、FLAGS以降はcalc_bonuses()自身が計算する値で、
+ * 後段の計算の入力にもなる。
+ */
+typedef enum bonus_dependency_type {
+    BONUS_DEP_EQUIPMENT = 0x00000001L, /*!< 装備品 */
+    BONUS_DEP_WEIGHT = 0x00000002L, /*!< 所持品の総重量 */
+    BONUS_DEP_RACE = 0x00000004L, /*!< 種族・性格・変身・体重 */
+    BONUS_DEP_CLASS = 0x00000008L, /*!< 職業・魔法領域 */
+    BONUS_DEP_LEVEL = 0x00000010L, /*!< レベル */
+    BONUS_DEP_MUTATION = 0x00000020L, /*!< 突然変異 */
+    BONUS_DEP_STAT = 0x00000040L, /*!< 基本能力値 */
+    BONUS_DEP_SKILL = 0x00000080L, /*!< 武器・技能の熟練度 */
+    BONUS_DEP_SONG = 0x00000100L, /*!< 歌・呪術・練気・集中度 */
+    BONUS_DEP_STANCE = 0x00000200L, /*!< 構え・型・行動 */
+    BONUS_DEP_RIDING = 0x00000400L, /*!< 乗馬 */
+    BONUS_DEP_FOOD = 0x00000800L, /*!< 満腹度 */
+    BONUS_DEP_TERRAIN = 0x00001000L, /*!< 足元の地形 */
+    BONUS_DEP_TIMED_SPEED = 0x00002000L, /*!< 一時効果: 加速・減速 */
+    BONUS_DEP_TIMED_COMBAT = 0x00004000L, /*!< 一時効果: 士気高揚・狂戦士化・祝福・朦朧等 */
+    BONUS_DEP_TIMED_DEFENSE = 0x00008000L, /*!< 一時効果: 防御・魔法防御等 */
+    BONUS_DEP_TIMED_SENSE = 0x00010000L, /*!< 一時効果: テレパシー・透明視・赤外線視・隠密 */
+    BONUS_DEP_TIMED_BODY = 0x00020000L, /*!< 一時効果: 浮遊・再生・火炎オーラ */
+    BONUS_DEP_FLAGS = 0x00040000L, /*!< 装備等から得る特性フラグ */
+    BONUS_DEP_STAT_ADD = 0x00080000L, /*!< 能力値修正 */
+    BONUS_DEP_STAT_IND = 0x00100000L, /*!< 現在の能力値と能力値テーブルの索引 */
+    BONUS_DEP_ARMOUR = 0x00200000L, /*!< AC */
+    BONUS_DEP_AMMO = 0x00400000L, /*!< 射撃の矢弾種別と射撃回数 */
+    BONUS_DEP_WIELD = 0x00800000L, /*!< 武器の持ち方と攻撃回数 */
+    BONUS_DEP_CASTING = 0x01000000L, /*!< 呪文の失敗率修正 */
+    BONUS_DEP_SPEED = 0x02000000L, /*!< 速度 */
+    BONUS_DEP_SKILLS = 0x04000000L, /*!< 技能値 */
+    BONUS_DEP_MELEE = 0x08000000L, /*!< 近接攻撃の命中・ダメージ修正 */
+    BONUS_DEP_MISSILE = 0x10000000L, /*!< 射撃の命中修正 */
+    BONUS_DEP_MISC = 0x20000000L, /*!< その他の攻撃の命中・ダメージ修正 */
+    BONUS_DEP_DIG = 0x40000000L, /*!< 掘削能力 */
+} bonus_dependency_type;
+
+#define MAX_BONUS_DEP 31 /*!< 依存先の数 */
+#define MAX_BONUS_PRIMARY_DEP 18 /*!< 一次入力の数 */
+#define BONUS_DEP_PRIMARY 0x0003FFFFL /*!< 一次入力全て */
+#define BONUS_DEP_ALL 0x7FFFFFFFL /*!< 依存先全て */
+
+#define BONUS_SIGNATURE_MAX 4096 /*!< 依存先の値を並べた列の最大長 */
+
+/*!
+ * @brief 依存先の値を並べたもの / The values a set of dependencies had, laid out for comparison
+ */
+typedef struct bonus_signature_type {
+    int len; /*!< 値の長さ (収まらなければ-1) */
+    byte data[BONUS_SIGNATURE_MAX]; /*!< 値の列 */
+} bonus_signature_type;
+
+extern bool cross_check_bonuses;
+extern int bonus_cross_check_mismatches;
+
+void make_bonus_signature(player_type *creature_ptr, BIT_FLAGS deps, bonus_signature_type *sig_ptr);
+bool same_bonus_signature(bonus_signature_type *sig1_ptr, bonus_signature_type *sig2_ptr);
+void invalidate_bonus_dependencies(void);
+BIT_FLAGS begin_bonus_dependencies(player_type *creature_ptr);
+void end_bonus_dependencies(BIT_FLAGS changed);
+int cross_check_bonus_dependencies(player_type *expected_ptr, player_type *actual_ptr);
@@ -11,10 +11,12 @@
 #include "core/player-redraw-types.h"
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
+#include "core/turn-profiler.h"
 #include "core/window-redrawer.h"
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "effect/effect-characteristics.h"
+#include "flavor/flavor-cache.h"
 #include "floor/cave.h"
 #include "floor/floor-events.h"
 #include "floor/floor-leaver.h"
@@ -57,12 +59,14 @@
 #include "object/object-info.h"
 #include "object/object-mark-types.h"
 #include "perception/object-perception.h"
+#include "pet/pet-registry.h"
 #include "pet/pet-util.h"
 #include "player-info/avatar.h"
 #include "player/attack-defense-types.h"
 #include "player/digestion-processor.h"
 #include "player/mimic-info-table.h"
 #include "player/patron.h"
+#include "player/player-bonus-tracker.h"
 #include "player/player-class.h"
 #include "player/player-damage.h"
 #include "player/player-move.h"
@@ -296,56 +300,24 @@ WEIGHT calc_inventory_weight(player_type *creature_ptr)
     return weight;
 }
 /*!
- * @brief プレイヤーの全ステータスを更新する /
- * Calculate the players current "state", taking into account
- * not only race/class intrinsics, but also objects being worn
- * and temporary spell effects.
- * @return なし
- * @details
- * <pre>
- * See also calc_mana() and calc_hitpoints().
- *
- * Take note of the new "speed code", in particular, a very strong
- * player will start slowing down as soon as he reaches 150 pounds,
- * but not until he reaches 450 pounds will he be half as fast as
- * a normal kobold.  This both hurts and helps the player, hurts
- * because in the old days a player could just avoid 300 pounds,
- * and helps because now carrying 300 pounds is not very painful.
- *
- * The "weapon" and "bow" do *not* add to the bonuses to hit or to
- * damage, since that would affect non-combat things.  These values
- * are actually added in later, at the appropriate place.
- *
- * This function induces various "status" messages.
- * </pre>
- * @todo ここで計算していた各値は一部の状態変化メッセージ処理を除き、今後必要な時に適示計算する形に移行するためほぼすべて削られる。
+ * @brief 差分計算の1段 / One stage of calc_bonuses()
  */
-void calc_bonuses(player_type *creature_ptr)
-{
-    int empty_hands_status = empty_hands(creature_ptr, TRUE);
-    object_type *o_ptr;
-
-    /* Save the old vision stuff */
-    BIT_FLAGS old_telepathy = creature_ptr->telepathy;
-    BIT_FLAGS old_esp_animal = creature_ptr->esp_animal;
-    BIT_FLAGS old_esp_undead = creature_ptr->esp_undead;
-    BIT_FLAGS old_esp_demon = creature_ptr->esp_demon;
-    BIT_FLAGS old_esp_orc = creature_ptr->esp_orc;
-    BIT_FLAGS old_esp_troll = creature_ptr->esp_troll;
-    BIT_FLAGS old_esp_giant = creature_ptr->esp_giant;
-    BIT_FLAGS old_esp_dragon = creature_ptr->esp_dragon;
-    BIT_FLAGS old_esp_human = creature_ptr->esp_human;
-    BIT_FLAGS old_esp_evil = creature_ptr->esp_evil;
-    BIT_FLAGS old_esp_good = creature_ptr->esp_good;
-    BIT_FLAGS old_esp_nonliving = creature_ptr->esp_nonliving;
-    BIT_FLAGS old_esp_unique = creature_ptr->esp_unique;
-    BIT_FLAGS old_see_inv = creature_ptr->see_inv;
-    BIT_FLAGS old_mighty_throw = creature_ptr->mighty_throw;
-    s16b old_speed = creature_ptr->pspeed;
+typedef struct bonus_node_type {
+    BIT_FLAGS inputs; /*!< 読む値の依存先 (BONUS_DEP_*) */
+    BIT_FLAGS outputs; /*!< 書く値の依存先 (BONUS_DEP_*) */
+    void (*calc)(player_type *creature_ptr); /*!< 計算処理 */
+} bonus_node_type;
 
-    ARMOUR_CLASS old_dis_ac = creature_ptr->dis_ac;
-    ARMOUR_CLASS old_dis_to_a = creature_ptr->dis_to_a;
+static ARMOUR_CLASS bonus_base_to_a; /*!< 玄武の構えを加える前の装備AC修正値 */
+static ARMOUR_CLASS bonus_base_dis_to_a; /*!< 玄武の構えを加える前の表記上の装備AC修正値 */
 
+/*!
+ * @brief 装備等から得る特性フラグを計算する / Stage: intrinsic flags
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_flags(player_type *creature_ptr)
+{
     creature_ptr->xtra_might = has_xtra_might(creature_ptr);
     creature_ptr->esp_evil = has_esp_evil(creature_ptr);
     creature_ptr->esp_animal = has_esp_animal(creature_ptr);
@@ -382,41 +354,110 @@ void calc_bonuses(player_type *creature_ptr)
     has_curses(creature_ptr);
     creature_ptr->impact = has_impact(creature_ptr);
     has_extra_blow(creature_ptr);
-
     creature_ptr->lite = has_lite(creature_ptr);
+}
 
-    if (creature_ptr->special_defense & KAMAE_MASK) {
-        if (!(empty_hands_status & EMPTY_HAND_RARM)) {
-            set_action(creature_ptr, ACTION_NONE);
-        }
-    }
+/*!
+ * @brief 構えを解くべきかを返す / Whether the current stance has to be dropped
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return 右手に武器を持ったまま構えていればTRUE
+ */
+static bool need_kamae_reset(player_type *creature_ptr)
+{
+    return (creature_ptr->special_defense & KAMAE_MASK) && !(empty_hands(creature_ptr, TRUE) & EMPTY_HAND_RARM);
+}
 
+/*!
+ * @brief 武器を持っていれば構えを解く / Stage: drop the stance when a weapon is wielded
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_kamae(player_type *creature_ptr)
+{
+    if (need_kamae_reset(creature_ptr))
+        set_action(creature_ptr, ACTION_NONE);
+}
+
+/*!
+ * @brief 能力値修正を計算する / Stage: stat modifiers
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_stat_addition(player_type *creature_ptr)
+{
     creature_ptr->stat_add[A_STR] = calc_strength_addition(creature_ptr);
     creature_ptr->stat_add[A_INT] = calc_intelligence_addition(creature_ptr);
     creature_ptr->stat_add[A_WIS] = calc_wisdom_addition(creature_ptr);
     creature_ptr->stat_add[A_DEX] = calc_dexterity_addition(creature_ptr);
     creature_ptr->stat_add[A_CON] = calc_constitution_addition(creature_ptr);
     creature_ptr->stat_add[A_CHR] = calc_charisma_addition(creature_ptr);
-    creature_ptr->to_m_chance = calc_to_magic_chance(creature_ptr);
+}
+
+/*!
+ * @brief 呪文の失敗率修正を計算する / Stage: casting penalty
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_casting(player_type *creature_ptr) { creature_ptr->to_m_chance = calc_to_magic_chance(creature_ptr); }
+
+/*!
+ * @brief ACを計算する / Stage: armour class
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details 玄武の構えの修正は後段のcalc_num_blow()が加えるので、加える前の値を取っておく。
+ */
+static void calc_bonus_armour(player_type *creature_ptr)
+{
     creature_ptr->ac = calc_base_ac(creature_ptr);
     creature_ptr->to_a = calc_to_ac(creature_ptr, TRUE);
     creature_ptr->dis_ac = calc_base_ac(creature_ptr);
     creature_ptr->dis_to_a = calc_to_ac(creature_ptr, FALSE);
+    bonus_base_to_a = creature_ptr->to_a;
+    bonus_base_dis_to_a = creature_ptr->dis_to_a;
+}
 
+/*!
+ * @brief 現在の能力値を計算する / Stage: current stats and table indexes
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_status(player_type *creature_ptr)
+{
     for (int i = 0; i < A_MAX; i++) {
         calc_top_status(creature_ptr, i);
         calc_use_status(creature_ptr, i);
         calc_ind_status(creature_ptr, i);
     }
+}
 
-    o_ptr = &creature_ptr->inventory_list[INVEN_BOW];
+/*!
+ * @brief 射撃の矢弾種別と射撃回数を計算する / Stage: ammo type and shots
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_ammo(player_type *creature_ptr)
+{
+    object_type *o_ptr = &creature_ptr->inventory_list[INVEN_BOW];
     if (o_ptr->k_idx) {
         creature_ptr->tval_ammo = (byte)bow_tval_ammo(o_ptr);
         if (o_ptr->k_idx && !is_heavy_shoot(creature_ptr, &creature_ptr->inventory_list[INVEN_BOW])) {
             creature_ptr->num_fire = calc_num_fire(creature_ptr, o_ptr);
         }
     }
+}
 
+/*!
+ * @brief 武器の持ち方と攻撃回数を計算する / Stage: wielding and blows
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details
+ * calc_num_blow()は玄武の構えのACを加算するので、先にAC計算直後の値へ戻す。
+ * 同時に近接攻撃の命中・ダメージ修正も書き換えるが、それらは後段で計算し直される。
+ */
+static void calc_bonus_wield(player_type *creature_ptr)
+{
+    creature_ptr->to_a = bonus_base_to_a;
+    creature_ptr->dis_to_a = bonus_base_dis_to_a;
     for (int i = 0; i < 2; i++) {
         creature_ptr->icky_wield[i] = has_icky_wield_weapon(creature_ptr, i);
         creature_ptr->riding_wield[i] = has_riding_wield_weapon(creature_ptr, i);
@@ -424,8 +465,22 @@ void calc_bonuses(player_type *creature_ptr)
         creature_ptr->to_dd[i] = calc_to_weapon_dice_num(creature_ptr, INVEN_RARM + i);
         creature_ptr->to_ds[i] = calc_to_weapon_dice_side(creature_ptr, INVEN_RARM + i);
     }
+}
+
+/*!
+ * @brief 速度を計算する / Stage: speed
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_speed(player_type *creature_ptr) { creature_ptr->pspeed = calc_speed(creature_ptr); }
 
-    creature_ptr->pspeed = calc_speed(creature_ptr);
+/*!
+ * @brief 技能値を計算する / Stage: skills
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_skills(player_type *creature_ptr)
+{
     creature_ptr->see_infra = calc_intra_vision(creature_ptr);
     creature_ptr->skill_stl = calc_stealth(creature_ptr);
     creature_ptr->skill_dis = calc_disarming(creature_ptr);
@@ -436,6 +491,15 @@ void calc_bonuses(player_type *creature_ptr)
     creature_ptr->skill_thn = calc_to_hit_melee(creature_ptr);
     creature_ptr->skill_thb = calc_to_hit_shoot(creature_ptr);
     creature_ptr->skill_tht = calc_to_hit_throw(creature_ptr);
+}
+
+/*!
+ * @brief 近接攻撃の命中・ダメージ修正を計算する / Stage: melee to-hit and to-dam
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_melee(player_type *creature_ptr)
+{
     creature_ptr->to_d[0] = calc_to_damage(creature_ptr, INVEN_RARM, TRUE);
     creature_ptr->to_d[1] = calc_to_damage(creature_ptr, INVEN_LARM, TRUE);
     creature_ptr->dis_to_d[0] = calc_to_damage(creature_ptr, INVEN_RARM, FALSE);
@@ -444,11 +508,184 @@ void calc_bonuses(player_type *creature_ptr)
     creature_ptr->to_h[1] = calc_to_hit(creature_ptr, INVEN_LARM, TRUE);
     creature_ptr->dis_to_h[0] = calc_to_hit(creature_ptr, INVEN_RARM, FALSE);
     creature_ptr->dis_to_h[1] = calc_to_hit(creature_ptr, INVEN_LARM, FALSE);
+}
+
+/*!
+ * @brief 射撃の命中修正を計算する / Stage: missile to-hit
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_missile(player_type *creature_ptr)
+{
     creature_ptr->to_h_b = calc_to_hit_bow(creature_ptr, TRUE);
     creature_ptr->dis_to_h_b = calc_to_hit_bow(creature_ptr, FALSE);
+}
+
+/*!
+ * @brief その他の攻撃の命中・ダメージ修正を計算する / Stage: misc to-hit and to-dam
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_misc(player_type *creature_ptr)
+{
     creature_ptr->to_d_m = calc_to_damage_misc(creature_ptr);
     creature_ptr->to_h_m = calc_to_hit_misc(creature_ptr);
-    creature_ptr->skill_dig = calc_skill_dig(creature_ptr);
+}
+
+/*!
+ * @brief 掘削能力を計算する / Stage: digging
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void calc_bonus_dig(player_type *creature_ptr) { creature_ptr->skill_dig = calc_skill_dig(creature_ptr); }
+
+/*!
+ * @brief calc_bonuses()の各段と依存先 / The stages of calc_bonuses() in their original order
+ * @details
+ * 構えを解く段はset_action()で構え・歌・呪術を変えるので、それらを出力に持つ。
+ * AC・攻撃回数・近接修正の3段はcalc_num_blow()の書き込みで結び付いているため、互いを入力に持つ。
+ */
+static const bonus_node_type bonus_nodes[] = {
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_SONG | BONUS_DEP_STANCE | BONUS_DEP_RIDING
+            | BONUS_DEP_TIMED_DEFENSE | BONUS_DEP_TIMED_SENSE | BONUS_DEP_TIMED_BODY | BONUS_DEP_FLAGS,
+        BONUS_DEP_FLAGS, calc_bonus_flags },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_STANCE, BONUS_DEP_STANCE | BONUS_DEP_SONG, calc_bonus_kamae },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_SONG | BONUS_DEP_STANCE
+            | BONUS_DEP_TIMED_COMBAT,
+        BONUS_DEP_STAT_ADD, calc_bonus_stat_addition },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE, BONUS_DEP_CASTING, calc_bonus_casting },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_SKILL | BONUS_DEP_SONG | BONUS_DEP_STANCE
+            | BONUS_DEP_RIDING | BONUS_DEP_TIMED_COMBAT | BONUS_DEP_TIMED_DEFENSE | BONUS_DEP_FLAGS | BONUS_DEP_STAT_IND,
+        BONUS_DEP_ARMOUR, calc_bonus_armour },
+    { BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_STAT | BONUS_DEP_STAT_ADD | BONUS_DEP_STAT_IND, BONUS_DEP_STAT_IND,
+        calc_bonus_status },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_STAT_IND, BONUS_DEP_AMMO, calc_bonus_ammo },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_SONG | BONUS_DEP_STANCE | BONUS_DEP_RIDING | BONUS_DEP_FLAGS | BONUS_DEP_STAT_IND
+            | BONUS_DEP_ARMOUR | BONUS_DEP_WIELD,
+        BONUS_DEP_WIELD, calc_bonus_wield },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_WEIGHT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_SKILL | BONUS_DEP_SONG
+            | BONUS_DEP_STANCE | BONUS_DEP_RIDING | BONUS_DEP_FOOD | BONUS_DEP_TERRAIN | BONUS_DEP_TIMED_SPEED | BONUS_DEP_FLAGS | BONUS_DEP_STAT_IND,
+        BONUS_DEP_SPEED, calc_bonus_speed },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_MUTATION | BONUS_DEP_SONG | BONUS_DEP_RIDING
+            | BONUS_DEP_TIMED_COMBAT | BONUS_DEP_TIMED_DEFENSE | BONUS_DEP_TIMED_SENSE | BONUS_DEP_FLAGS | BONUS_DEP_STAT_IND,
+        BONUS_DEP_SKILLS, calc_bonus_skills },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_SKILL | BONUS_DEP_SONG | BONUS_DEP_RIDING | BONUS_DEP_TIMED_COMBAT | BONUS_DEP_FLAGS
+            | BONUS_DEP_STAT_IND | BONUS_DEP_WIELD,
+        BONUS_DEP_MELEE, calc_bonus_melee },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_SKILL | BONUS_DEP_SONG | BONUS_DEP_RIDING | BONUS_DEP_TIMED_COMBAT
+            | BONUS_DEP_STAT_IND | BONUS_DEP_AMMO,
+        BONUS_DEP_MISSILE, calc_bonus_missile },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_SONG | BONUS_DEP_TIMED_COMBAT | BONUS_DEP_STAT_IND, BONUS_DEP_MISC,
+        calc_bonus_misc },
+    { BONUS_DEP_EQUIPMENT | BONUS_DEP_RACE | BONUS_DEP_CLASS | BONUS_DEP_LEVEL | BONUS_DEP_TIMED_COMBAT | BONUS_DEP_STAT_IND | BONUS_DEP_WIELD,
+        BONUS_DEP_DIG, calc_bonus_dig },
+};
+
+/*!
+ * @brief 依存先が変わった段を順に計算し直す / Run the stages whose inputs changed
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param dirty 変わった依存先
+ * @return 計算し直した結果として変わった依存先
+ */
+static BIT_FLAGS update_bonus_nodes(player_type *creature_ptr, BIT_FLAGS dirty)
+{
+    BIT_FLAGS changed = 0L;
+    for (size_t i = 0; i < sizeof(bonus_nodes) / sizeof(bonus_nodes[0]); i++) {
+        const bonus_node_type *node_ptr = &bonus_nodes[i];
+        if (!(node_ptr->inputs & dirty))
+            continue;
+
+        bonus_signature_type before;
+        bonus_signature_type after;
+        make_bonus_signature(creature_ptr, node_ptr->outputs, &before);
+        (*node_ptr->calc)(creature_ptr);
+        make_bonus_signature(creature_ptr, node_ptr->outputs, &after);
+        if (same_bonus_signature(&before, &after))
+            continue;
+
+        dirty |= node_ptr->outputs;
+        changed |= node_ptr->outputs;
+    }
+
+    return changed;
+}
+
+/*!
+ * @brief 差分計算の結果を全計算で検証する / Debug mode: recompute everything on a copy and compare
+ * @param expected_ptr 差分計算の前に複製したプレーヤー
+ * @param actual_ptr 差分計算したプレーヤー
+ * @return なし
+ */
+static void cross_check_bonus_nodes(player_type *expected_ptr, player_type *actual_ptr)
+{
+    ARMOUR_CLASS base_to_a = bonus_base_to_a;
+    ARMOUR_CLASS base_dis_to_a = bonus_base_dis_to_a;
+    (void)update_bonus_nodes(expected_ptr, BONUS_DEP_ALL);
+    bonus_base_to_a = base_to_a;
+    bonus_base_dis_to_a = base_dis_to_a;
+    (void)cross_check_bonus_dependencies(expected_ptr, actual_ptr);
+}
+
+/*!
+ * @brief プレイヤーの全ステータスを更新する /
+ * Calculate the players current "state", taking into account
+ * not only race/class intrinsics, but also objects being worn
+ * and temporary spell effects.
+ * @return なし
+ * @details
+ * <pre>
+ * See also calc_mana() and calc_hitpoints().
+ *
+ * Take note of the new "speed code", in particular, a very strong
+ * player will start slowing down as soon as he reaches 150 pounds,
+ * but not until he reaches 450 pounds will he be half as fast as
+ * a normal kobold.  This both hurts and helps the player, hurts
+ * because in the old days a player could just avoid 300 pounds,
+ * and helps because now carrying 300 pounds is not very painful.
+ *
+ * The "weapon" and "bow" do *not* add to the bonuses to hit or to
+ * damage, since that would affect non-combat things.  These values
+ * are actually added in later, at the appropriate place.
+ *
+ * This function induces various "status" messages.
+ * </pre>
+ * @todo ここで計算していた各値は一部の状態変化メッセージ処理を除き、今後必要な時に適示計算する形に移行するためほぼすべて削られる。
+ */
+void calc_bonuses(player_type *creature_ptr)
+{
+    /* Save the old vision stuff */
+    BIT_FLAGS old_telepathy = creature_ptr->telepathy;
+    BIT_FLAGS old_esp_animal = creature_ptr->esp_animal;
+    BIT_FLAGS old_esp_undead = creature_ptr->esp_undead;
+    BIT_FLAGS old_esp_demon = creature_ptr->esp_demon;
+    BIT_FLAGS old_esp_orc = creature_ptr->esp_orc;
+    BIT_FLAGS old_esp_troll = creature_ptr->esp_troll;
+    BIT_FLAGS old_esp_giant = creature_ptr->esp_giant;
+    BIT_FLAGS old_esp_dragon = creature_ptr->esp_dragon;
+    BIT_FLAGS old_esp_human = creature_ptr->esp_human;
+    BIT_FLAGS old_esp_evil = creature_ptr->esp_evil;
+    BIT_FLAGS old_esp_good = creature_ptr->esp_good;
+    BIT_FLAGS old_esp_nonliving = creature_ptr->esp_nonliving;
+    BIT_FLAGS old_esp_unique = creature_ptr->esp_unique;
+    BIT_FLAGS old_see_inv = creature_ptr->see_inv;
+    BIT_FLAGS old_mighty_throw = creature_ptr->mighty_throw;
+    s16b old_speed = creature_ptr->pspeed;
+
+    ARMOUR_CLASS old_dis_ac = creature_ptr->dis_ac;
+    ARMOUR_CLASS old_dis_to_a = creature_ptr->dis_to_a;
+
+    player_type *expected_ptr = NULL;
+    if (cross_check_bonuses && !need_kamae_reset(creature_ptr)) {
+        MAKE(expected_ptr, player_type);
+        *expected_ptr = *creature_ptr;
+    }
+
+    BIT_FLAGS changed = update_bonus_nodes(creature_ptr, begin_bonus_dependencies(creature_ptr));
+    end_bonus_dependencies(changed);
+    if (expected_ptr) {
+        cross_check_bonus_nodes(expected_ptr, creature_ptr);
+        KILL(expected_ptr, player_type);
+    }
 
     if (old_mighty_throw != creature_ptr->mighty_throw) {
         creature_ptr->window |= PW_INVEN;
@@ -486,24 +723,7 @@ void calc_bonuses(player_type *creature_ptr)
 
 static void calc_alignment(player_type *creature_ptr)
 {
-    creature_ptr->align = 0;
-    floor_type *floor_ptr = creature_ptr->current_floor_ptr;
-    for (MONSTER_IDX m_idx = floor_ptr->m_max - 1; m_idx >= 1; m_idx--) {
-        monster_type *m_ptr;
-        monster_race *r_ptr;
-        m_ptr = &floor_ptr->m_list[m_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-        r_ptr = &r_info[m_ptr->r_idx];
-
-        if (!is_pet(m_ptr))
-            continue;
-
-        if (r_ptr->flags3 & RF3_GOOD)
-            creature_ptr->align += r_ptr->level;
-        if (r_ptr->flags3 & RF3_EVIL)
-            creature_ptr->align -= r_ptr->level;
-    }
+    creature_ptr->align = calc_pet_alignment(creature_ptr);
 
     if (creature_ptr->mimic_form) {
         switch (creature_ptr->mimic_form) {
@@ -3465,8 +3685,12 @@ void update_creature(player_type *creature_ptr)
 
     if (creature_ptr->update & (PU_BONUS)) {
         creature_ptr->update &= ~(PU_BONUS);
+        update_object_state_version();
+        reset_flavor_cache();
         calc_alignment(creature_ptr);
+        TURN_PROFILE_BEGIN(TPS_CALC_BONUSES);
         calc_bonuses(creature_ptr);
+        TURN_PROFILE_END(TPS_CALC_BONUSES);
     }
 
     if (creature_ptr->update & (PU_TORCH)) {
@@ -3505,28 +3729,37 @@ void update_creature(player_type *creature_ptr)
 
     if (creature_ptr->update & (PU_VIEW)) {
         creature_ptr->update &= ~(PU_VIEW);
+        TURN_PROFILE_BEGIN(TPS_UPDATE_VIEW);
         update_view(creature_ptr);
+        TURN_PROFILE_END(TPS_UPDATE_VIEW);
     }
 
     if (creature_ptr->update & (PU_LITE)) {
         creature_ptr->update &= ~(PU_LITE);
+        TURN_PROFILE_BEGIN(TPS_UPDATE_LITE);
         update_lite(creature_ptr);
+        TURN_PROFILE_END(TPS_UPDATE_LITE);
     }
 
     if (creature_ptr->update & (PU_FLOW)) {
         creature_ptr->update &= ~(PU_FLOW);
+        TURN_PROFILE_BEGIN(TPS_UPDATE_FLOW);
         update_flow(creature_ptr);
+        TURN_PROFILE_END(TPS_UPDATE_FLOW);
     }
 
     if (creature_ptr->update & (PU_DISTANCE)) {
         creature_ptr->update &= ~(PU_DISTANCE);
-
+        TURN_PROFILE_BEGIN(TPS_UPDATE_MONSTERS);
         update_monsters(creature_ptr, TRUE);
+        TURN_PROFILE_END(TPS_UPDATE_MONSTERS);
     }
 
     if (creature_ptr->update & (PU_MON_LITE)) {
         creature_ptr->update &= ~(PU_MON_LITE);
+        TURN_PROFILE_BEGIN(TPS_UPDATE_MON_LITE);
         update_mon_lite(creature_ptr);
+        TURN_PROFILE_END(TPS_UPDATE_MON_LITE);
     }
 
     if (creature_ptr->update & (PU_DELAY_VIS)) {
@@ -3536,7 +3769,9 @@ void update_creature(player_type *creature_ptr)
 
     if (creature_ptr->update & (PU_MONSTERS)) {
         creature_ptr->update &= ~(PU_MONSTERS);
+        TURN_PROFILE_BEGIN(TPS_UPDATE_MONSTERS);
         update_monsters(creature_ptr, FALSE);
+        TURN_PROFILE_END(TPS_UPDATE_MONSTERS);
     }
 }
 
@@ -3961,38 +4196,9 @@ void stop_mouth(player_type *caster_ptr)
  */
 PERCENTAGE calculate_upkeep(player_type *creature_ptr)
 {
-    MONSTER_IDX m_idx;
-    bool has_a_unique = FALSE;
-    DEPTH total_friend_levels = 0;
-
-    total_friends = 0;
-
-    for (m_idx = creature_ptr->current_floor_ptr->m_max - 1; m_idx >= 1; m_idx--) {
-        monster_type *m_ptr;
-        monster_race *r_ptr;
-
-        m_ptr = &creature_ptr->current_floor_ptr->m_list[m_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-        r_ptr = &r_info[m_ptr->r_idx];
-
-        if (is_pet(m_ptr)) {
-            total_friends++;
-            if (r_ptr->flags1 & RF1_UNIQUE) {
-                if (creature_ptr->pclass == CLASS_CAVALRY) {
-                    if (creature_ptr->riding == m_idx)
-                        total_friend_levels += (r_ptr->level + 5) * 2;
-                    else if (!has_a_unique && (r_info[m_ptr->r_idx].flags7 & RF7_RIDING))
-                        total_friend_levels += (r_ptr->level + 5) * 7 / 2;
-                    else
-                        total_friend_levels += (r_ptr->level + 5) * 10;
-                    has_a_unique = TRUE;
-                } else
-                    total_friend_levels += (r_ptr->level + 5) * 10;
-            } else
-                total_friend_levels += r_ptr->level;
-        }
-    }
+    MONSTER_NUMBER num;
+    DEPTH total_friend_levels = calc_pet_upkeep_levels(creature_ptr, &num);
+    total_friends = num;
 
     if (total_friends) {
         int upkeep_factor;
@@ -353,6 +353,7 @@ typedef struct player_type {
 
     MONSTER_IDX pet_t_m_idx;
     MONSTER_IDX riding_t_m_idx;
+    u16b riding_t_m_generation; /*!< riding_t_m_idx を選んだ時の枠の世代 */
 
     /*** Extracted fields ***/
 
@@ -1,6 +1,7 @@
 ﻿#include "player/process-name.h"
 #include "autopick/autopick-reader-writer.h"
 #include "core/asking-player.h"
+#include "flavor/flavor-cache.h"
 #include "io/files-util.h"
 #include "player/player-personality.h"
 #include "term/screen-processor.h"
@@ -154,6 +155,7 @@ void get_name(player_type *creature_ptr)
 		strcpy(creature_ptr->name, "PLAYER");
 	}
 
+	reset_flavor_cache();
 	strcpy(tmp, ap_ptr->title);
 #ifdef JP
 	if (ap_ptr->no == 1)
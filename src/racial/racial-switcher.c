@@ -275,9 +275,7 @@ bool switch_race_racial_execution(player_type *creature_ptr, const s32b command)
     switch (creature_ptr->prace) {
     case RACE_DWARF:
         msg_print(_("周囲を調べた。", "You examine your surroundings."));
-        (void)detect_traps(creature_ptr, DETECT_RAD_DEFAULT, TRUE);
-        (void)detect_doors(creature_ptr, DETECT_RAD_DEFAULT);
-        (void)detect_stairs(creature_ptr, DETECT_RAD_DEFAULT);
+        (void)detect_grids(creature_ptr, DETECT_RAD_DEFAULT, DETECT_GRID_FEATURES);
         return TRUE;
     case RACE_HOBBIT:
         return create_ration(creature_ptr);
@@ -362,9 +360,7 @@ bool switch_race_racial_execution(player_type *creature_ptr, const s32b command)
         return TRUE;
     case RACE_NIBELUNG:
         msg_print(_("周囲を調査した。", "You examine your surroundings."));
-        (void)detect_traps(creature_ptr, DETECT_RAD_DEFAULT, TRUE);
-        (void)detect_doors(creature_ptr, DETECT_RAD_DEFAULT);
-        (void)detect_stairs(creature_ptr, DETECT_RAD_DEFAULT);
+        (void)detect_grids(creature_ptr, DETECT_RAD_DEFAULT, DETECT_GRID_FEATURES);
         return TRUE;
     case RACE_DARK_ELF:
         if (!get_aim_dir(creature_ptr, &dir))
@@ -114,9 +114,7 @@ concptr do_nature_spell(player_type *caster_ptr, SPELL_IDX spell, spell_type mod
                 return info_radius(rad);
 
             if (cast) {
-                detect_traps(caster_ptr, rad, TRUE);
-                detect_doors(caster_ptr, rad);
-                detect_stairs(caster_ptr, rad);
+                detect_grids(caster_ptr, rad, DETECT_GRID_FEATURES);
             }
         }
         break;
@@ -290,10 +288,7 @@ concptr do_nature_spell(player_type *caster_ptr, SPELL_IDX spell, spell_type mod
 
             if (cast) {
                 map_area(caster_ptr, rad1);
-                detect_traps(caster_ptr, rad2, TRUE);
-                detect_doors(caster_ptr, rad2);
-                detect_stairs(caster_ptr, rad2);
-                detect_monsters_normal(caster_ptr, rad2);
+                detect_grids(caster_ptr, rad2, DETECT_GRID_FEATURES | DETECT_GRID_MONSTERS_NORMAL);
             }
         }
         break;
@@ -339,9 +339,7 @@ concptr do_music_spell(player_type *caster_ptr, SPELL_IDX spell, spell_type mode
                     if (plev > 19 && count < A_MAX)
                         SINGING_COUNT(caster_ptr) = count + 1;
                 }
-                detect_traps(caster_ptr, rad, TRUE);
-                detect_doors(caster_ptr, rad);
-                detect_stairs(caster_ptr, rad);
+                detect_grids(caster_ptr, rad, DETECT_GRID_FEATURES);
 
                 if (plev > 14 && count < 3)
                     SINGING_COUNT(caster_ptr) = count + 1;
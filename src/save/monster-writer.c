@@ -64,27 +64,27 @@ static void write_monster_info(monster_type *m_ptr, const BIT_FLAGS flags)
 {
     byte tmp8u;
     if (flags & SAVE_MON_FAST) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_FAST];
+        tmp8u = (byte)monster_fast_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
     if (flags & SAVE_MON_SLOW) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_SLOW];
+        tmp8u = (byte)monster_slow_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
     if (flags & SAVE_MON_STUNNED) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_STUNNED];
+        tmp8u = (byte)monster_stunned_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
     if (flags & SAVE_MON_CONFUSED) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_CONFUSED];
+        tmp8u = (byte)monster_confused_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
     if (flags & SAVE_MON_MONFEAR) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_MONFEAR];
+        tmp8u = (byte)monster_fear_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
@@ -95,7 +95,7 @@ static void write_monster_info(monster_type *m_ptr, const BIT_FLAGS flags)
         wr_s16b((s16b)m_ptr->target_x);
 
     if (flags & SAVE_MON_INVULNER) {
-        tmp8u = (byte)m_ptr->mtimed[MTIMED_INVULNER];
+        tmp8u = (byte)monster_invulner_remaining(m_ptr);
         wr_byte(tmp8u);
     }
 
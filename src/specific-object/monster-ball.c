@@ -8,6 +8,7 @@
 #include "monster/monster-info.h"
 #include "monster/monster-util.h"
 #include "object-activation/activation-util.h"
+#include "object/object-info.h"
 #include "racial/racial-android.h"
 #include "spell-kind/spells-launcher.h"
 #include "spell/spell-types.h"
@@ -55,6 +56,7 @@ static void inscribe_nickname(ae_type *ae_ptr)
 #endif
     *s = '\0';
     ae_ptr->o_ptr->inscription = quark_add(buf);
+    update_object_state_version();
 }
 
 static bool set_activation_target(player_type *user_ptr, ae_type *ae_ptr)
@@ -118,6 +120,7 @@ static void add_quark_to_inscription(player_type *user_ptr, ae_type *ae_ptr, con
 
     *s = '\0';
     ae_ptr->o_ptr->inscription = quark_add(buf);
+    update_object_state_version();
 }
 
 static void check_inscription_value(player_type *user_ptr, ae_type *ae_ptr)
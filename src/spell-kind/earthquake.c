@@ -6,7 +6,9 @@
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
 #include "floor/floor-object.h"
+#include "floor/teleport-index.h"
 #include "game-option/play-record-options.h"
 #include "game-option/text-display-options.h"
 #include "grid/grid.h"
@@ -76,6 +78,8 @@ bool earthquake(player_type *caster_ptr, POSITION cy, POSITION cx, POSITION r, M
             g_ptr = &floor_ptr->grid_array[yy][xx];
             g_ptr->info &= ~(CAVE_ROOM | CAVE_ICKY | CAVE_UNSAFE);
             g_ptr->info &= ~(CAVE_GLOW | CAVE_MARK | CAVE_KNOWN);
+            update_teleport_index(floor_ptr, yy, xx);
+            update_feat_planes(floor_ptr, yy, xx);
             if (!dx && !dy)
                 continue;
 
@@ -3,9 +3,12 @@
 #include "dungeon/dungeon-flag-types.h"
 #include "dungeon/dungeon.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
+#include "floor/geometry.h"
 #include "floor/floor-save-util.h"
 #include "grid/grid.h"
 #include "grid/trap.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags2.h"
 #include "monster-race/race-flags3.h"
@@ -26,223 +29,293 @@
 #include "view/display-messages.h"
 
 /*!
- * @brief プレイヤー周辺の地形を感知する
- * @param caster_ptr プレーヤーへの参照ポインタ
+ * @brief 感知の範囲がある行で何マス左右に広がるかを返す / Half width of the detection range on a row
+ * @param dy 中心からの垂直距離
  * @param range 効果範囲
- * @param flag 特定地形ID
- * @param known 地形から危険フラグを外すならTRUE
- * @return 効力があった場合TRUEを返す
+ * @return 最大の水平距離。行全体が範囲外ならば-1
  */
-static bool detect_feat_flag(player_type *caster_ptr, POSITION range, int flag, bool known)
+static POSITION calc_detect_width(POSITION dy, POSITION range)
 {
-    if (d_info[caster_ptr->dungeon_idx].flags1 & DF1_DARKNESS)
-        range /= 3;
-
-    grid_type *g_ptr;
-    bool detect = FALSE;
-    for (POSITION y = 1; y < caster_ptr->current_floor_ptr->height - 1; y++) {
-        for (POSITION x = 1; x <= caster_ptr->current_floor_ptr->width - 1; x++) {
-            int dist = distance(caster_ptr->y, caster_ptr->x, y, x);
-            if (dist > range)
-                continue;
-            g_ptr = &caster_ptr->current_floor_ptr->grid_array[y][x];
-            if (flag == FF_TRAP) {
-                /* Mark as detected */
-                if (dist <= range && known) {
-                    if (dist <= range - 1)
-                        g_ptr->info |= (CAVE_IN_DETECT);
+    POSITION dx = range;
+    while ((dx >= 0) && (distance(0, 0, dy, dx) > range))
+        dx--;
 
-                    g_ptr->info &= ~(CAVE_UNSAFE);
-
-                    lite_spot(caster_ptr, y, x);
-                }
-            }
-
-            if (cave_has_flag_grid(g_ptr, flag)) {
-                disclose_grid(caster_ptr, y, x);
-                g_ptr->info |= (CAVE_MARK);
-                lite_spot(caster_ptr, y, x);
-                detect = TRUE;
-            }
-        }
-    }
-
-    return detect;
+    return dx;
 }
 
 /*!
- * @brief プレイヤー周辺のトラップを感知する / Detect all traps on current panel
+ * @brief 感知の結果を数える / What a pass over the range box found
+ */
+typedef struct detect_grid_result {
+    BIT_FLAGS found; /*!< 見つかったものの種類 (DETECT_GRID_*) */
+    bool gold_mimic; /*!< 財宝に化けたモンスターを見つけたか */
+    bool object_mimic; /*!< アイテムに化けたモンスターを見つけたか */
+} detect_grid_result;
+
+/*!
+ * @brief 範囲内の地形をビット平面から感知する / Detect flagged features on a row through the bitplanes
  * @param caster_ptr プレーヤーへの参照ポインタ
- * @param range 効果範囲
- * @param known 感知外範囲を超える警告フラグを立てる場合TRUEを返す
- * @return 効力があった場合TRUEを返す
+ * @param y 行のY座標
+ * @param x1 左端X座標
+ * @param x2 右端X座標
+ * @param detectors 感知するものの種類
+ * @param result_ptr 結果を返す参照ポインタ
+ * @return なし
  */
-bool detect_traps(player_type *caster_ptr, POSITION range, bool known)
+static void detect_grid_feats(player_type *caster_ptr, POSITION y, POSITION x1, POSITION x2, BIT_FLAGS detectors, detect_grid_result *result_ptr)
 {
-    bool detect = detect_feat_flag(caster_ptr, range, FF_TRAP, known);
+    static const BIT_FLAGS plane_detectors[MAX_FEAT_PLANE] = { DETECT_GRID_TRAPS, DETECT_GRID_DOORS, DETECT_GRID_STAIRS, DETECT_GRID_TREASURE };
+    floor_type *floor_ptr = caster_ptr->current_floor_ptr;
+    u32b *rows[MAX_FEAT_PLANE];
+    for (int plane = 0; plane < MAX_FEAT_PLANE; plane++)
+        rows[plane] = (detectors & plane_detectors[plane]) ? get_feat_plane_row(floor_ptr, (feat_plane_type)plane, y) : NULL;
+
+    for (int i = x1 / 32; i <= x2 / 32; i++) {
+        u32b bits = 0;
+        for (int plane = 0; plane < MAX_FEAT_PLANE; plane++)
+            if (rows[plane])
+                bits |= rows[plane][i];
+
+        if (!bits)
+            continue;
 
-    if (known)
-        caster_ptr->dtrap = TRUE;
+        for (int b = 0; b < 32; b++) {
+            POSITION x = i * 32 + b;
+            if (!(bits & (1UL << b)) || (x < x1) || (x > x2))
+                continue;
 
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 0)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("トラップの存在を感じとった！", "You sense the presence of traps!"));
-    }
+            for (int plane = 0; plane < MAX_FEAT_PLANE; plane++)
+                if (rows[plane] && (rows[plane][i] & (1UL << b)))
+                    result_ptr->found |= plane_detectors[plane];
 
-    return detect;
+            disclose_grid(caster_ptr, y, x);
+            floor_ptr->grid_array[y][x].info |= (CAVE_MARK);
+            lite_spot(caster_ptr, y, x);
+        }
+    }
 }
 
 /*!
- * @brief プレイヤー周辺のドアを感知する / Detect all doors on current panel
+ * @brief 1グリッドの上のアイテムとモンスターを感知する / Detect the objects and the monster on a grid
  * @param caster_ptr プレーヤーへの参照ポインタ
- * @param range 効果範囲
- * @return 効力があった場合TRUEを返す
+ * @param y Y座標
+ * @param x X座標
+ * @param detectors 感知するものの種類
+ * @param result_ptr 結果を返す参照ポインタ
+ * @return なし
  */
-bool detect_doors(player_type *caster_ptr, POSITION range)
+static void detect_grid_things(player_type *caster_ptr, POSITION y, POSITION x, BIT_FLAGS detectors, detect_grid_result *result_ptr)
 {
-    bool detect = detect_feat_flag(caster_ptr, range, FF_DOOR, TRUE);
+    floor_type *floor_ptr = caster_ptr->current_floor_ptr;
+    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+    if (detectors & (DETECT_GRID_OBJECTS_GOLD | DETECT_GRID_OBJECTS_NORMAL)) {
+        OBJECT_IDX next_o_idx = 0;
+        for (OBJECT_IDX this_o_idx = g_ptr->o_idx; this_o_idx; this_o_idx = next_o_idx) {
+            object_type *o_ptr = &floor_ptr->o_list[this_o_idx];
+            next_o_idx = o_ptr->next_o_idx;
+            BIT_FLAGS kind = (o_ptr->tval == TV_GOLD) ? DETECT_GRID_OBJECTS_GOLD : DETECT_GRID_OBJECTS_NORMAL;
+            if (!(detectors & kind))
+                continue;
 
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 0)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("ドアの存在を感じとった！", "You sense the presence of doors!"));
+            o_ptr->marked |= OM_FOUND;
+            lite_spot(caster_ptr, y, x);
+            result_ptr->found |= kind;
+        }
     }
 
-    return detect;
+    if (!g_ptr->m_idx || !(detectors & (DETECT_GRID_OBJECTS_GOLD | DETECT_GRID_OBJECTS_NORMAL | DETECT_GRID_MONSTERS_INVIS | DETECT_GRID_MONSTERS_NORMAL)))
+        return;
+
+    monster_type *m_ptr = &floor_ptr->m_list[g_ptr->m_idx];
+    monster_race *r_ptr = &r_info[m_ptr->r_idx];
+    if (!monster_is_valid(m_ptr))
+        return;
+
+    bool gold_mimic = (detectors & DETECT_GRID_OBJECTS_GOLD) && angband_strchr("$", r_ptr->d_char);
+    bool object_mimic = (detectors & DETECT_GRID_OBJECTS_NORMAL) && angband_strchr("!=?|/`", r_ptr->d_char);
+    bool invis = (detectors & DETECT_GRID_MONSTERS_INVIS) && (r_ptr->flags2 & RF2_INVISIBLE);
+    bool normal = (detectors & DETECT_GRID_MONSTERS_NORMAL) && (!(r_ptr->flags2 & RF2_INVISIBLE) || caster_ptr->see_inv);
+    if (!gold_mimic && !object_mimic && !invis && !normal)
+        return;
+
+    if ((gold_mimic || object_mimic || invis) && (caster_ptr->monster_race_idx == m_ptr->r_idx))
+        caster_ptr->window |= (PW_MONSTER);
+
+    result_ptr->gold_mimic |= gold_mimic;
+    result_ptr->object_mimic |= object_mimic;
+    if (invis)
+        result_ptr->found |= DETECT_GRID_MONSTERS_INVIS;
+
+    if (normal)
+        result_ptr->found |= DETECT_GRID_MONSTERS_NORMAL;
+
+    repair_monsters = TRUE;
+    m_ptr->mflag2 |= (MFLAG2_MARK | MFLAG2_SHOW);
+    update_monster(caster_ptr, g_ptr->m_idx, FALSE);
 }
 
 /*!
- * @brief プレイヤー周辺の階段を感知する / Detect all stairs on current panel
+ * @brief 呪歌「感知」の詠唱中でメッセージを抑えるかを返す
  * @param caster_ptr プレーヤーへの参照ポインタ
- * @param range 効果範囲
- * @return 効力があった場合TRUEを返す
+ * @param count この回数より長く歌っていれば抑える
+ * @return 抑えるならTRUE
  */
-bool detect_stairs(player_type *caster_ptr, POSITION range)
+static bool is_detect_song_quiet(player_type *caster_ptr, int count)
 {
-    bool detect = detect_feat_flag(caster_ptr, range, FF_STAIRS, TRUE);
-
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 0)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("階段の存在を感じとった！", "You sense the presence of stairs!"));
-    }
-
-    return detect;
+    return music_singing(caster_ptr, MUSIC_DETECT) && (SINGING_COUNT(caster_ptr) > count);
 }
 
 /*!
- * @brief プレイヤー周辺の地形財宝を感知する / Detect any treasure on the current panel
+ * @brief 感知の結果を表示する / Report what the pass found, in the order of the old separate detectors
  * @param caster_ptr プレーヤーへの参照ポインタ
- * @param range 効果範囲
+ * @param result_ptr 感知の結果
  * @return 効力があった場合TRUEを返す
  */
-bool detect_treasure(player_type *caster_ptr, POSITION range)
+static bool report_detect_grids(player_type *caster_ptr, detect_grid_result *result_ptr)
 {
-    bool detect = detect_feat_flag(caster_ptr, range, FF_HAS_GOLD, TRUE);
+    static const struct {
+        BIT_FLAGS detector;
+        int quiet;
+        concptr msg;
+    } feat_messages[] = {
+        { DETECT_GRID_TRAPS, 0, _("トラップの存在を感じとった！", "You sense the presence of traps!") },
+        { DETECT_GRID_DOORS, 0, _("ドアの存在を感じとった！", "You sense the presence of doors!") },
+        { DETECT_GRID_STAIRS, 0, _("階段の存在を感じとった！", "You sense the presence of stairs!") },
+        { DETECT_GRID_TREASURE, 6, _("埋蔵された財宝の存在を感じとった！", "You sense the presence of buried treasure!") },
+        { DETECT_GRID_OBJECTS_GOLD, 6, _("財宝の存在を感じとった！", "You sense the presence of treasure!") },
+        { DETECT_GRID_OBJECTS_NORMAL, 6, _("アイテムの存在を感じとった！", "You sense the presence of objects!") },
+        { DETECT_GRID_MONSTERS_INVIS, 3, _("透明な生物の存在を感じとった！", "You sense the presence of invisible creatures!") },
+        { DETECT_GRID_MONSTERS_NORMAL, 3, _("モンスターの存在を感じとった！", "You sense the presence of monsters!") },
+    };
 
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 6)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("埋蔵された財宝の存在を感じとった！", "You sense the presence of buried treasure!"));
+    bool detect = FALSE;
+    for (size_t i = 0; i < sizeof(feat_messages) / sizeof(feat_messages[0]); i++) {
+        if ((result_ptr->found & feat_messages[i].detector) && !is_detect_song_quiet(caster_ptr, feat_messages[i].quiet)) {
+            msg_print(feat_messages[i].msg);
+            detect = TRUE;
+        }
+
+        bool mimic = ((feat_messages[i].detector == DETECT_GRID_OBJECTS_GOLD) && result_ptr->gold_mimic)
+            || ((feat_messages[i].detector == DETECT_GRID_OBJECTS_NORMAL) && result_ptr->object_mimic);
+        if (mimic && !is_detect_song_quiet(caster_ptr, 3)) {
+            msg_print(_("モンスターの存在を感じとった！", "You sense the presence of monsters!"));
+            detect = TRUE;
+        }
     }
 
     return detect;
 }
+
 /*!
- * @brief プレイヤー周辺のアイテム財宝を感知する / Detect all "gold" objects on the current panel
+ * @brief プレイヤー周辺をまとめて感知する / Run several detectors in a single pass over the range box
  * @param caster_ptr プレーヤーへの参照ポインタ
  * @param range 効果範囲
+ * @param detectors 感知するものの種類 (DETECT_GRID_* の組み合わせ)
  * @return 効力があった場合TRUEを返す
+ * @details
+ * 範囲を囲む矩形を1度だけ行ごとに辿り、行の中で範囲に入る区間だけを調べる。
+ * 地形は地形フラグのビット平面から該当するグリッドだけを拾い、アイテムとモンスターはグリッドから辿る。
+ * メッセージと効果の判定は個別の感知を順に呼んだ場合と同じになる。
  */
-bool detect_objects_gold(player_type *caster_ptr, POSITION range)
+bool detect_grids(player_type *caster_ptr, POSITION range, BIT_FLAGS detectors)
 {
-    POSITION range2 = range;
     if (d_info[caster_ptr->dungeon_idx].flags1 & DF1_DARKNESS)
-        range2 /= 3;
+        range /= 3;
 
-    /* Scan objects */
-    bool detect = FALSE;
-    POSITION y, x;
-    for (OBJECT_IDX i = 1; i < caster_ptr->current_floor_ptr->o_max; i++) {
-        object_type *o_ptr = &caster_ptr->current_floor_ptr->o_list[i];
+    floor_type *floor_ptr = caster_ptr->current_floor_ptr;
+    detect_grid_result result = { 0, FALSE, FALSE };
+    bool feats = (detectors & (DETECT_GRID_TRAPS | DETECT_GRID_DOORS | DETECT_GRID_STAIRS | DETECT_GRID_TREASURE)) != 0;
+    bool things = (detectors & (DETECT_GRID_OBJECTS_GOLD | DETECT_GRID_OBJECTS_NORMAL | DETECT_GRID_MONSTERS_INVIS | DETECT_GRID_MONSTERS_NORMAL)) != 0;
+    POSITION y1 = MAX(0, caster_ptr->y - range);
+    POSITION y2 = MIN(floor_ptr->height - 1, caster_ptr->y + range);
+    for (POSITION y = y1; y <= y2; y++) {
+        POSITION dy = ABS(y - caster_ptr->y);
+        POSITION width = calc_detect_width(dy, range);
+        POSITION x1 = MAX(0, caster_ptr->x - width);
+        POSITION x2 = MIN(floor_ptr->width - 1, caster_ptr->x + width);
+        bool inner = (y > 0) && (y < floor_ptr->height - 1);
+        if (inner && (detectors & DETECT_GRID_TRAP_AREA)) {
+            POSITION inner_width = calc_detect_width(dy, range - 1);
+            for (POSITION x = MAX(1, x1); x <= x2; x++) {
+                grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+                if (ABS(x - caster_ptr->x) <= inner_width)
+                    g_ptr->info |= (CAVE_IN_DETECT);
+
+                g_ptr->info &= ~(CAVE_UNSAFE);
+                lite_spot(caster_ptr, y, x);
+            }
+        }
 
-        if (!object_is_valid(o_ptr))
-            continue;
-        if (object_is_held_monster(o_ptr))
-            continue;
+        if (inner && feats && (x2 >= 1))
+            detect_grid_feats(caster_ptr, y, MAX(1, x1), x2, detectors, &result);
 
-        y = o_ptr->iy;
-        x = o_ptr->ix;
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range2)
+        if (!things)
             continue;
 
-        if (o_ptr->tval == TV_GOLD) {
-            o_ptr->marked |= OM_FOUND;
-            lite_spot(caster_ptr, y, x);
-            detect = TRUE;
-        }
+        for (POSITION x = x1; x <= x2; x++)
+            detect_grid_things(caster_ptr, y, x, detectors, &result);
     }
 
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 6)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("財宝の存在を感じとった！", "You sense the presence of treasure!"));
-    }
+    if (detectors & DETECT_GRID_TRAP_AREA)
+        caster_ptr->dtrap = TRUE;
 
-    if (detect_monsters_string(caster_ptr, range, "$")) {
-        detect = TRUE;
-    }
+    if (detectors & DETECT_GRID_QUIET)
+        return result.found != 0;
 
-    return detect;
+    return report_detect_grids(caster_ptr, &result);
 }
 
 /*!
- * @brief 通常のアイテムオブジェクトを感知する / Detect all "normal" objects on the current panel
+ * @brief プレイヤー周辺のトラップを感知する / Detect all traps on current panel
  * @param caster_ptr プレーヤーへの参照ポインタ
  * @param range 効果範囲
+ * @param known 感知外範囲を超える警告フラグを立てる場合TRUEを返す
  * @return 効力があった場合TRUEを返す
  */
-bool detect_objects_normal(player_type *caster_ptr, POSITION range)
+bool detect_traps(player_type *caster_ptr, POSITION range, bool known)
 {
-    POSITION range2 = range;
-    if (d_info[caster_ptr->dungeon_idx].flags1 & DF1_DARKNESS)
-        range2 /= 3;
-
-    bool detect = FALSE;
-    for (OBJECT_IDX i = 1; i < caster_ptr->current_floor_ptr->o_max; i++) {
-        object_type *o_ptr = &caster_ptr->current_floor_ptr->o_list[i];
-
-        if (!object_is_valid(o_ptr))
-            continue;
-        if (object_is_held_monster(o_ptr))
-            continue;
-
-        POSITION y = o_ptr->iy;
-        POSITION x = o_ptr->ix;
+    return detect_grids(caster_ptr, range, DETECT_GRID_TRAPS | (known ? DETECT_GRID_TRAP_AREA : 0));
+}
 
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range2)
-            continue;
+/*!
+ * @brief プレイヤー周辺のドアを感知する / Detect all doors on current panel
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @return 効力があった場合TRUEを返す
+ */
+bool detect_doors(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_DOORS); }
 
-        if (o_ptr->tval != TV_GOLD) {
-            o_ptr->marked |= OM_FOUND;
-            lite_spot(caster_ptr, y, x);
-            detect = TRUE;
-        }
-    }
+/*!
+ * @brief プレイヤー周辺の階段を感知する / Detect all stairs on current panel
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @return 効力があった場合TRUEを返す
+ */
+bool detect_stairs(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_STAIRS); }
 
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 6)
-        detect = FALSE;
-    if (detect) {
-        msg_print(_("アイテムの存在を感じとった！", "You sense the presence of objects!"));
-    }
+/*!
+ * @brief プレイヤー周辺の地形財宝を感知する / Detect any treasure on the current panel
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @return 効力があった場合TRUEを返す
+ */
+bool detect_treasure(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_TREASURE); }
 
-    if (detect_monsters_string(caster_ptr, range, "!=?|/`")) {
-        detect = TRUE;
-    }
+/*!
+ * @brief プレイヤー周辺のアイテム財宝を感知する / Detect all "gold" objects on the current panel
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @return 効力があった場合TRUEを返す
+ */
+bool detect_objects_gold(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_OBJECTS_GOLD); }
 
-    return detect;
-}
+/*!
+ * @brief 通常のアイテムオブジェクトを感知する / Detect all "normal" objects on the current panel
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @return 効力があった場合TRUEを返す
+ */
+bool detect_objects_normal(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_OBJECTS_NORMAL); }
 
 /*!
  * @brief 魔法効果のあるのアイテムオブジェクトを感知する / Detect all "magic" objects on the current panel.
@@ -304,39 +377,7 @@ bool detect_objects_magic(player_type *caster_ptr, POSITION range)
  * @param range 効果範囲
  * @return 効力があった場合TRUEを返す
  */
-bool detect_monsters_normal(player_type *caster_ptr, POSITION range)
-{
-    if (d_info[caster_ptr->dungeon_idx].flags1 & DF1_DARKNESS)
-        range /= 3;
-
-    bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
-        monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
-        monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
-
-        if (!(r_ptr->flags2 & RF2_INVISIBLE) || caster_ptr->see_inv) {
-            repair_monsters = TRUE;
-            m_ptr->mflag2 |= (MFLAG2_MARK | MFLAG2_SHOW);
-            update_monster(caster_ptr, i, FALSE);
-            flag = TRUE;
-        }
-    }
-
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 3)
-        flag = FALSE;
-    if (flag) {
-        msg_print(_("モンスターの存在を感じとった！", "You sense the presence of monsters!"));
-    }
-
-    return flag;
-}
+bool detect_monsters_normal(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_MONSTERS_NORMAL); }
 
 /*!
  * @brief 不可視のモンスターを感知する / Detect all "invisible" monsters around the player
@@ -344,45 +385,7 @@ bool detect_monsters_normal(player_type *caster_ptr, POSITION range)
  * @param range 効果範囲
  * @return 効力があった場合TRUEを返す
  */
-bool detect_monsters_invis(player_type *caster_ptr, POSITION range)
-{
-    if (d_info[caster_ptr->dungeon_idx].flags1 & DF1_DARKNESS)
-        range /= 3;
-
-    bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
-        monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
-        monster_race *r_ptr = &r_info[m_ptr->r_idx];
-
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
-
-        if (r_ptr->flags2 & RF2_INVISIBLE) {
-            if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
-                caster_ptr->window |= (PW_MONSTER);
-            }
-
-            repair_monsters = TRUE;
-            m_ptr->mflag2 |= (MFLAG2_MARK | MFLAG2_SHOW);
-            update_monster(caster_ptr, i, FALSE);
-            flag = TRUE;
-        }
-    }
-
-    if (music_singing(caster_ptr, MUSIC_DETECT) && SINGING_COUNT(caster_ptr) > 3)
-        flag = FALSE;
-    if (flag) {
-        msg_print(_("透明な生物の存在を感じとった！", "You sense the presence of invisible creatures!"));
-    }
-
-    return flag;
-}
+bool detect_monsters_invis(player_type *caster_ptr, POSITION range) { return detect_grids(caster_ptr, range, DETECT_GRID_MONSTERS_INVIS); }
 
 /*!
  * @brief 邪悪なモンスターを感知する / Detect all "evil" monsters on current panel
@@ -410,7 +413,7 @@ bool detect_monsters_evil(player_type *caster_ptr, POSITION range)
 
         if (r_ptr->flags3 & RF3_EVIL) {
             if (is_original_ap(m_ptr)) {
-                r_ptr->r_flags3 |= (RF3_EVIL);
+                lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
                 if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
                     caster_ptr->window |= (PW_MONSTER);
                 }
@@ -587,7 +590,7 @@ bool detect_monsters_xxx(player_type *caster_ptr, POSITION range, u32b match_fla
 
         if (r_ptr->flags3 & (match_flag)) {
             if (is_original_ap(m_ptr)) {
-                r_ptr->r_flags3 |= (match_flag);
+                lore_race_flags(r_ptr, LORE_FLAGS3, match_flag);
                 if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
                     caster_ptr->window |= (PW_MONSTER);
                 }
@@ -626,20 +629,7 @@ bool detect_monsters_xxx(player_type *caster_ptr, POSITION range, u32b match_fla
  */
 bool detect_all(player_type *caster_ptr, POSITION range)
 {
-    bool detect = FALSE;
-    if (detect_traps(caster_ptr, range, TRUE))
-        detect = TRUE;
-    if (detect_doors(caster_ptr, range))
-        detect = TRUE;
-    if (detect_stairs(caster_ptr, range))
-        detect = TRUE;
-    if (detect_objects_gold(caster_ptr, range))
-        detect = TRUE;
-    if (detect_objects_normal(caster_ptr, range))
-        detect = TRUE;
-    if (detect_monsters_invis(caster_ptr, range))
-        detect = TRUE;
-    if (detect_monsters_normal(caster_ptr, range))
-        detect = TRUE;
-    return (detect);
+    return detect_grids(caster_ptr, range,
+        DETECT_GRID_TRAPS | DETECT_GRID_TRAP_AREA | DETECT_GRID_DOORS | DETECT_GRID_STAIRS | DETECT_GRID_OBJECTS_GOLD | DETECT_GRID_OBJECTS_NORMAL
+            | DETECT_GRID_MONSTERS_INVIS | DETECT_GRID_MONSTERS_NORMAL);
 }
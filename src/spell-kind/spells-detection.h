@@ -2,6 +2,24 @@
 
 #include "system/angband.h"
 
+/*!
+ * @brief detect_grids() でまとめて感知するものの種類 / Detectors run by detect_grids()
+ */
+enum detect_grid_type {
+    DETECT_GRID_TRAPS = 0x0001, /*!< トラップ */
+    DETECT_GRID_TRAP_AREA = 0x0002, /*!< トラップ感知済の範囲を記録する */
+    DETECT_GRID_DOORS = 0x0004, /*!< ドア */
+    DETECT_GRID_STAIRS = 0x0008, /*!< 階段 */
+    DETECT_GRID_TREASURE = 0x0010, /*!< 財宝を含む鉱脈 */
+    DETECT_GRID_OBJECTS_GOLD = 0x0020, /*!< 床の財宝と、それに化けたモンスター */
+    DETECT_GRID_OBJECTS_NORMAL = 0x0040, /*!< 床のアイテムと、それに化けたモンスター */
+    DETECT_GRID_MONSTERS_INVIS = 0x0080, /*!< 透明なモンスター */
+    DETECT_GRID_MONSTERS_NORMAL = 0x0100, /*!< 見えるモンスター */
+    DETECT_GRID_QUIET = 0x0200, /*!< 感知したことを知らせない (性能計測用) */
+    DETECT_GRID_FEATURES = DETECT_GRID_TRAPS | DETECT_GRID_TRAP_AREA | DETECT_GRID_DOORS | DETECT_GRID_STAIRS, /*!< トラップ・ドア・階段の感知 */
+};
+
+
 bool detect_traps(player_type* caster_ptr, POSITION range, bool known);
 bool detect_doors(player_type* caster_ptr, POSITION range);
 bool detect_stairs(player_type* caster_ptr, POSITION range);
@@ -17,3 +35,4 @@ bool detect_monsters_string(player_type* caster_ptr, POSITION range, concptr);
 bool detect_monsters_nonliving(player_type* caster_ptr, POSITION range);
 bool detect_monsters_mind(player_type* caster_ptr, POSITION range);
 bool detect_all(player_type* caster_ptr, POSITION range);
+bool detect_grids(player_type *caster_ptr, POSITION range, BIT_FLAGS detectors);
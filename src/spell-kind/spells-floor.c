@@ -16,9 +16,11 @@
 #include "flavor/flavor-describer.h"
 #include "flavor/object-flavor-types.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
 #include "floor/floor-object.h"
 #include "floor/floor-save.h"
 #include "floor/floor-util.h"
+#include "floor/teleport-index.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-options.h"
 #include "game-option/map-screen-options.h"
@@ -47,6 +49,7 @@
 #include "status/bad-status-setter.h"
 #include "system/artifact-type-definition.h"
 #include "system/floor-type-definition.h"
+#include "target/projection-path-calculator.h"
 #include "util/bit-flags-calculator.h"
 #include "view/display-messages.h"
 
@@ -405,6 +408,9 @@ bool destroy_area(player_type *caster_ptr, POSITION y1, POSITION x1, POSITION r,
         }
     }
 
+    invalidate_teleport_index(floor_ptr);
+    invalidate_feat_planes(floor_ptr);
+    invalidate_projection_cache();
     if (in_generate)
         return TRUE;
 
@@ -179,6 +179,7 @@ bool identify_fully(player_type *caster_ptr, bool only_equip, tval_type item_tes
     bool old_known = identify_item(caster_ptr, o_ptr);
 
     o_ptr->ident |= (IDENT_FULL_KNOWN);
+    update_object_state_version();
 
     /* Refrect item informaiton onto subwindows without updating inventory */
     caster_ptr->update &= ~(PU_COMBINE | PU_REORDER);
@@ -11,9 +11,11 @@
 #include "monster/monster-description-types.h"
 #include "monster/monster-info.h"
 #include "monster/smart-learn-types.h"
+#include "pet/pet-registry.h"
 #include "spell/spell-types.h"
 #include "system/floor-type-definition.h"
 #include "view/display-messages.h"
+#include "world/world.h"
 
 /*!
  * @brief ペット爆破処理 /
@@ -21,22 +23,26 @@
  */
 void discharge_minion(player_type *caster_ptr)
 {
+    floor_type *floor_ptr = caster_ptr->current_floor_ptr;
+    MONSTER_IDX *who;
+    C_MAKE(who, current_world_ptr->max_m_idx, MONSTER_IDX);
+    MONSTER_NUMBER max_pet = collect_pets(floor_ptr, who);
     bool okay = TRUE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
-        monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
-        if (!m_ptr->r_idx || !is_pet(m_ptr))
-            continue;
-        if (m_ptr->nickname)
+    for (MONSTER_NUMBER i = 0; i < max_pet; i++) {
+        if (floor_ptr->m_list[who[i]].nickname)
             okay = FALSE;
     }
 
     if (!okay || caster_ptr->riding) {
-        if (!get_check(_("本当に全ペットを爆破しますか？", "You will blast all pets. Are you sure? ")))
+        if (!get_check(_("本当に全ペットを爆破しますか？", "You will blast all pets. Are you sure? "))) {
+            C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
             return;
+        }
     }
 
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
-        monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
+    for (MONSTER_NUMBER i = max_pet - 1; i >= 0; i--) {
+        MONSTER_IDX m_idx = who[i];
+        monster_type *m_ptr = &floor_ptr->m_list[m_idx];
         if (!m_ptr->r_idx || !is_pet(m_ptr))
             continue;
 
@@ -46,7 +52,7 @@ void discharge_minion(player_type *caster_ptr)
             GAME_TEXT m_name[MAX_NLEN];
             monster_desc(caster_ptr, m_name, m_ptr, 0x00);
             msg_format(_("%sは爆破されるのを嫌がり、勝手に自分の世界へと帰った。", "%^s resists being blasted and runs away."), m_name);
-            delete_monster_idx(caster_ptr, i);
+            delete_monster_idx(caster_ptr, m_idx);
             continue;
         }
 
@@ -57,7 +63,7 @@ void discharge_minion(player_type *caster_ptr)
             dam = (dam - 400) / 2 + 400;
         if (dam > 800)
             dam = 800;
-        project(caster_ptr, i, 2 + (r_ptr->level / 20), m_ptr->fy, m_ptr->fx, dam, GF_PLASMA, PROJECT_STOP | PROJECT_GRID | PROJECT_ITEM | PROJECT_KILL, -1);
+        project(caster_ptr, m_idx, 2 + (r_ptr->level / 20), m_ptr->fy, m_ptr->fx, dam, GF_PLASMA, PROJECT_STOP | PROJECT_GRID | PROJECT_ITEM | PROJECT_KILL, -1);
 
         if (record_named_pet && m_ptr->nickname) {
             GAME_TEXT m_name[MAX_NLEN];
@@ -66,6 +72,8 @@ void discharge_minion(player_type *caster_ptr)
             exe_write_diary(caster_ptr, DIARY_NAMED_PET, RECORD_NAMED_PET_BLAST, m_name);
         }
 
-        delete_monster_idx(caster_ptr, i);
+        delete_monster_idx(caster_ptr, m_idx);
     }
+
+    C_KILL(who, current_world_ptr->max_m_idx, MONSTER_IDX);
 }
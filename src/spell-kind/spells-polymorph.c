@@ -1,6 +1,7 @@
 ﻿#include "spell-kind/spells-polymorph.h"
 #include "core/stuff-handler.h"
 #include "floor/floor-object.h"
+#include "floor/floor-slot-list.h"
 #include "grid/grid.h"
 #include "monster-floor/monster-generator.h"
 #include "monster-floor/monster-remover.h"
@@ -120,8 +121,11 @@ bool polymorph_monster(player_type *caster_ptr, POSITION y, POSITION x)
         }
     }
 
-    if (targeted)
+    if (targeted) {
         target_who = hack_m_idx_ii;
+        target_generation = slot_generation(&floor_ptr->m_slots, hack_m_idx_ii);
+    }
+
     if (health_tracked)
         health_track(caster_ptr, hack_m_idx_ii);
     return polymorphed;
@@ -11,8 +11,10 @@
 #include "effect/effect-characteristics.h"
 #include "floor/cave.h"
 #include "floor/line-of-sight.h"
+#include "floor/teleport-index.h"
 #include "grid/grid.h"
 #include "inventory/inventory-slot-types.h"
+#include "lore/lore-journal.h"
 #include "main/sound-definitions-table.h"
 #include "main/sound-of-music.h"
 #include "monster-floor/monster-move.h"
@@ -83,7 +85,7 @@ bool teleport_swap(player_type *caster_ptr, DIRECTION dir)
     if (r_ptr->flagsr & RFR_RES_TELE) {
         msg_print(_("テレポートを邪魔された！", "Your teleportation is blocked!"));
         if (is_original_ap_and_seen(caster_ptr, m_ptr))
-            r_ptr->r_flagsr |= RFR_RES_TELE;
+            lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_TELE);
         return FALSE;
     }
 
@@ -127,6 +129,8 @@ bool teleport_away(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION dis, tel
         chg_virtue(caster_ptr, V_VALOUR, -1);
     }
 
+    floor_type *floor_ptr = caster_ptr->current_floor_ptr;
+    teleport_index_type plane = (floor_ptr->inside_quest || floor_ptr->inside_arena) ? TELEPORT_INDEX_ANY : TELEPORT_INDEX_OUTSIDE_VAULT;
     POSITION oy = m_ptr->fy;
     POSITION ox = m_ptr->fx;
     POSITION min = dis / 2;
@@ -138,22 +142,13 @@ bool teleport_away(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION dis, tel
         if (dis > 200)
             dis = 200;
 
+        teleport_band_type band;
+        prepare_teleport_band(floor_ptr, plane, oy, ox, min, dis, &band);
         for (int i = 0; i < 500; i++) {
-            while (TRUE) {
-                ny = rand_spread(oy, dis);
-                nx = rand_spread(ox, dis);
-                POSITION d = distance(oy, ox, ny, nx);
-                if ((d >= min) && (d <= dis))
-                    break;
-            }
-
-            if (!in_bounds(caster_ptr->current_floor_ptr, ny, nx))
-                continue;
+            if (!pick_teleport_band(floor_ptr, &band, &ny, &nx))
+                break;
             if (!cave_monster_teleportable_bold(caster_ptr, m_idx, ny, nx, mode))
                 continue;
-            if (!(caster_ptr->current_floor_ptr->inside_quest || caster_ptr->current_floor_ptr->inside_arena))
-                if (caster_ptr->current_floor_ptr->grid_array[ny][nx].info & CAVE_ICKY)
-                    continue;
 
             look = FALSE;
             break;
@@ -216,17 +211,11 @@ void teleport_monster_to(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION ty
         if (dis > 200)
             dis = 200;
 
+        teleport_band_type band;
+        prepare_teleport_band(caster_ptr->current_floor_ptr, TELEPORT_INDEX_ANY, ty, tx, min, dis, &band);
         for (int i = 0; i < 500; i++) {
-            while (TRUE) {
-                ny = rand_spread(ty, dis);
-                nx = rand_spread(tx, dis);
-                int d = distance(ty, tx, ny, nx);
-                if ((d >= min) && (d <= dis))
-                    break;
-            }
-
-            if (!in_bounds(caster_ptr->current_floor_ptr, ny, nx))
-                continue;
+            if (!pick_teleport_band(caster_ptr->current_floor_ptr, &band, &ny, &nx))
+                break;
             if (!cave_monster_teleportable_bold(caster_ptr, m_idx, ny, nx, mode))
                 continue;
 
@@ -257,45 +246,22 @@ void teleport_monster_to(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION ty
 }
 
 /*!
- * @brief プレイヤーのテレポート先選定と移動処理 /
- * Teleport the player to a location up to "dis" grids away.
+ * @brief 全候補を走査してプレイヤーのテレポート先を選ぶ /
+ * Choose the destination by scanning every grid within the distance.
  * @param creature_ptr プレーヤーへの参照ポインタ
- * @param dis 基本移動距離
- * @param is_quantum_effect 量子的効果 (反テレポ無効)によるテレポートアウェイならばTRUE
+ * @param dis 移動距離
  * @param mode オプション
- * @return 実際にテレポート処理が行われたらtrue
- * @details
- * <pre>
- * If no such spaces are readily available, the distance may increase.
- * Try very hard to move the player at least a quarter that distance.
- *
- * There was a nasty tendency for a long time; which was causing the
- * player to "bounce" between two or three different spots because
- * these are the only spots that are "far enough" way to satisfy the
- * algorithm.
- *
- * But this tendency is now removed; in the new algorithm, a list of
- * candidates is selected first, which includes at least 50% of all
- * floor grids within the distance, and any single grid in this list
- * of candidates has equal possibility to be choosen as a destination.
- * </pre>
+ * @param yp 選ばれたY座標を返す参照ポインタ
+ * @param xp 選ばれたX座標を返す参照ポインタ
+ * @return テレポート先が見つかったらtrue
+ * @details 索引からの抽出で移動可能なグリッドが見つからなかった時に用いる。
  */
-bool teleport_player_aux(player_type *creature_ptr, POSITION dis, bool is_quantum_effect, teleport_flags mode)
+static bool scan_teleport_player_destination(player_type *creature_ptr, POSITION dis, teleport_flags mode, POSITION *yp, POSITION *xp)
 {
-    if (creature_ptr->wild_mode)
-        return FALSE;
-    if (!is_quantum_effect && creature_ptr->anti_tele && !(mode & TELEPORT_NONMAGICAL)) {
-        msg_print(_("不思議な力がテレポートを防いだ！", "A mysterious force prevents you from teleporting!"));
-        return FALSE;
-    }
-
     int candidates_at[MAX_TELEPORT_DISTANCE + 1];
     for (int i = 0; i <= MAX_TELEPORT_DISTANCE; i++)
         candidates_at[i] = 0;
 
-    if (dis > MAX_TELEPORT_DISTANCE)
-        dis = MAX_TELEPORT_DISTANCE;
-
     int left = MAX(1, creature_ptr->x - dis);
     int right = MIN(creature_ptr->current_floor_ptr->width - 2, creature_ptr->x + dis);
     int top = MAX(1, creature_ptr->y - dis);
@@ -353,6 +319,86 @@ bool teleport_player_aux(player_type *creature_ptr, POSITION dis, bool is_quantu
     if (player_bold(creature_ptr, yy, xx))
         return FALSE;
 
+    *yp = yy;
+    *xp = xx;
+    return TRUE;
+}
+
+/*!
+ * @brief プレイヤーのテレポート先選定と移動処理 /
+ * Teleport the player to a location up to "dis" grids away.
+ * @param creature_ptr プレーヤーへの参照ポインタ
+ * @param dis 基本移動距離
+ * @param is_quantum_effect 量子的効果 (反テレポ無効)によるテレポートアウェイならばTRUE
+ * @param mode オプション
+ * @return 実際にテレポート処理が行われたらtrue
+ * @details
+ * <pre>
+ * If no such spaces are readily available, the distance may increase.
+ * Try very hard to move the player at least a quarter that distance.
+ *
+ * There was a nasty tendency for a long time; which was causing the
+ * player to "bounce" between two or three different spots because
+ * these are the only spots that are "far enough" way to satisfy the
+ * algorithm.
+ *
+ * But this tendency is now removed; in the new algorithm, a list of
+ * candidates is selected first, which includes at least 50% of all
+ * floor grids within the distance, and any single grid in this list
+ * of candidates has equal possibility to be choosen as a destination.
+ *
+ * The candidates are counted and drawn from the teleport index of
+ * the floor, so only the drawn grids are checked for occupants.
+ * </pre>
+ */
+bool teleport_player_aux(player_type *creature_ptr, POSITION dis, bool is_quantum_effect, teleport_flags mode)
+{
+    if (creature_ptr->wild_mode)
+        return FALSE;
+    if (!is_quantum_effect && creature_ptr->anti_tele && !(mode & TELEPORT_NONMAGICAL)) {
+        msg_print(_("不思議な力がテレポートを防いだ！", "A mysterious force prevents you from teleporting!"));
+        return FALSE;
+    }
+
+    if (dis > MAX_TELEPORT_DISTANCE)
+        dis = MAX_TELEPORT_DISTANCE;
+
+    floor_type *floor_ptr = creature_ptr->current_floor_ptr;
+    teleport_index_type plane = (mode & TELEPORT_NONMAGICAL) ? TELEPORT_INDEX_ANY : TELEPORT_INDEX_OUTSIDE_VAULT;
+    int total_candidates = count_teleport_candidates(floor_ptr, plane, creature_ptr->y, creature_ptr->x, 0, dis);
+    if (0 == total_candidates)
+        return FALSE;
+
+    /* Find the farthest band holding at least half of the candidates */
+    POSITION min = 0;
+    POSITION max_min = dis;
+    while (min < max_min) {
+        POSITION mid = (min + max_min + 1) / 2;
+        int cur_candidates = count_teleport_candidates(floor_ptr, plane, creature_ptr->y, creature_ptr->x, mid, dis);
+        if (cur_candidates && (cur_candidates >= total_candidates / 2))
+            min = mid;
+        else
+            max_min = mid - 1;
+    }
+
+    teleport_band_type band;
+    prepare_teleport_band(floor_ptr, plane, creature_ptr->y, creature_ptr->x, min, dis, &band);
+    POSITION yy = 0, xx = 0;
+    bool is_found = FALSE;
+    const int MAX_TELEPORT_PICKS = 100;
+    for (int i = 0; i < MAX_TELEPORT_PICKS; i++) {
+        if (!pick_teleport_band(floor_ptr, &band, &yy, &xx))
+            break;
+        if (player_bold(creature_ptr, yy, xx) || !cave_player_teleportable_bold(creature_ptr, yy, xx, mode))
+            continue;
+
+        is_found = TRUE;
+        break;
+    }
+
+    if (!is_found && !scan_teleport_player_destination(creature_ptr, dis, mode, &yy, &xx))
+        return FALSE;
+
     sound(SOUND_TELEPORT);
 #ifdef JP
     if (is_echizen(creature_ptr))
@@ -6,6 +6,8 @@
 #include "effect/effect-characteristics.h"
 #include "effect/effect-processor.h"
 #include "floor/cave.h"
+#include "floor/feature-plane.h"
+#include "floor/teleport-index.h"
 #include "grid/feature.h"
 #include "grid/grid.h"
 #include "monster/monster-describer.h"
@@ -129,6 +131,10 @@ bool vanish_dungeon(player_type *caster_ptr)
         }
     }
 
+    invalidate_teleport_index(caster_ptr->current_floor_ptr);
+    invalidate_feat_planes(caster_ptr->current_floor_ptr);
+    invalidate_projection_cache();
+
     for (POSITION x = 0; x < caster_ptr->current_floor_ptr->width; x++) {
         g_ptr = &caster_ptr->current_floor_ptr->grid_array[0][x];
         f_ptr = &f_info[g_ptr->mimic];
@@ -1,4 +1,5 @@
 ﻿#include "spell/spells-diceroll.h"
+#include "lore/lore-journal.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags-resistance.h"
 #include "monster-race/race-flags1.h"
@@ -27,13 +28,13 @@ bool common_saving_throw_charm(player_type *operator_ptr, HIT_POINT pow, monster
 	/* Memorize a flag */
 	if (r_ptr->flagsr & RFR_RES_ALL)
 	{
-		if (is_original_ap_and_seen(operator_ptr, m_ptr)) r_ptr->r_flagsr |= (RFR_RES_ALL);
+		if (is_original_ap_and_seen(operator_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_ALL);
 		return TRUE;
 	}
 
 	if (r_ptr->flags3 & RF3_NO_CONF)
 	{
-		if (is_original_ap_and_seen(operator_ptr, m_ptr)) r_ptr->r_flags3 |= (RF3_NO_CONF);
+		if (is_original_ap_and_seen(operator_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGS3, RF3_NO_CONF);
 		return TRUE;
 	}
 
@@ -59,7 +60,7 @@ bool common_saving_throw_control(player_type *operator_ptr, HIT_POINT pow, monst
 	/* Memorize a flag */
 	if (r_ptr->flagsr & RFR_RES_ALL)
 	{
-		if (is_original_ap_and_seen(operator_ptr, m_ptr)) r_ptr->r_flagsr |= (RFR_RES_ALL);
+		if (is_original_ap_and_seen(operator_ptr, m_ptr)) lore_race_flags(r_ptr, LORE_FLAGSR, RFR_RES_ALL);
 		return TRUE;
 	}
 
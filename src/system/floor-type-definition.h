@@ -1,7 +1,10 @@
 ﻿#pragma once
 
+#include "floor/feature-plane-types.h"
 #include "floor/floor-base-definitions.h"
+#include "floor/floor-slot-list.h"
 #include "floor/sight-definitions.h"
+#include "floor/teleport-index-types.h"
 #include "monster/monster-timed-effect-types.h"
 
 typedef struct grid_type grid_type;
@@ -23,13 +26,27 @@ typedef struct floor_type {
     object_type *o_list; /*!< The array of dungeon items [max_o_idx] */
     OBJECT_IDX o_max; /* Number of allocated objects */
     OBJECT_IDX o_cnt; /* Number of live objects */
+    slot_list_type o_slots; /*!< o_listの空き枠の一覧 */
 
     monster_type *m_list; /*!< The array of dungeon monsters [max_m_idx] */
     MONSTER_IDX m_max; /* Number of allocated monsters */
     MONSTER_IDX m_cnt; /* Number of live monsters */
+    slot_list_type m_slots; /*!< m_listの空き枠の一覧 */
 
     s16b *mproc_list[MAX_MTIMED]; /*!< The array to process dungeon monsters[max_m_idx] */
     s16b mproc_max[MAX_MTIMED]; /*!< Number of monsters to be processed */
+    s16b *mproc_pos[MAX_MTIMED]; /*!< モンスター毎のmproc_list内の位置 (所属はmproc_list側と突き合わせて判定する) [max_m_idx] */
+    int *mtimed_wheel_next[MAX_MTIMED]; /*!< 時限効果の満了する回毎の循環リストの次の要素 (max_m_idx以降は各枠の番兵) [max_m_idx + MTIMED_WHEEL_SIZE] */
+    int *mtimed_wheel_prev[MAX_MTIMED]; /*!< 同じく前の要素 */
+
+    s16b *pet_list; /*!< ペット・友好モンスターの添字の昇順の一覧 [max_m_idx] */
+    MONSTER_NUMBER pet_max; /*!< 一覧に登録されたモンスター数 */
+    bool pet_list_ready; /*!< 一覧が現在のモンスター配列に対して構築済か */
+    bool pet_summary_ready; /*!< 以下の集計値が一覧に対して計算済か */
+    MONSTER_IDX pet_summary_riding; /*!< 集計時の騎乗モンスター */
+    MONSTER_NUMBER pet_num; /*!< ペットの数 */
+    s32b pet_align; /*!< ペットによる属性の増減 */
+    DEPTH pet_upkeep_levels; /*!< ペットの維持コストの元になるレベルの合計 */
 
     POSITION_IDX lite_n; //!< Array of grids lit by player lite
     POSITION lite_y[LITE_MAX];
@@ -51,4 +68,11 @@ typedef struct floor_type {
     QUEST_IDX inside_quest; /* Inside quest level */
     bool inside_arena; /* Is character inside on_defeat_arena_monster? */
 
+    bool teleport_index_ready; /*!< テレポート先索引が現在の地形に対して構築済か */
+    byte teleport_grid_flags[MAX_HGT][MAX_WID]; /*!< グリッドごとの索引への登録状況 (teleport_index_typeのビット) */
+    s16b teleport_index[MAX_TELEPORT_INDEX][MAX_HGT][MAX_WID + 1]; /*!< 行ごとのテレポート先候補数のFenwick木 */
+
+    bool feat_plane_ready; /*!< 地形フラグのビット平面が現在の地形に対して構築済か */
+    u32b feat_plane[MAX_FEAT_PLANE][MAX_HGT][FEAT_PLANE_WORDS]; /*!< 地形フラグごとのビット平面 */
+
 } floor_type;
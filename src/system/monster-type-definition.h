@@ -12,36 +12,55 @@
 typedef struct floor_type floor_type;
 typedef struct monster_race monster_race;
 typedef struct monster_type {
+	/*
+	 * 毎ターンの走査 (sweep_monster_process()・update_monsters()・update_mon_lite()) が読む項目。
+	 * 先頭64バイト(1キャッシュライン)に収まるよう並べているため、項目を足す時は下の冷たい側に置くこと。
+	 * Hot fields read by the per-turn sweeps; keep them within the leading 64 bytes.
+	 */
 	MONRACE_IDX r_idx;		/*!< モンスターの実種族ID (これが0の時は死亡扱いになる) / Monster race index 0 = dead. */
 	MONRACE_IDX ap_r_idx;	/*!< モンスターの外見種族ID（あやしい影、たぬき、ジュラル星人誤認などにより変化する）Monster race appearance index */
-	floor_type *current_floor_ptr; /*!< 所在フロアID（現状はfloor_type構造体によるオブジェクトは1つしかないためソースコード設計上の意義以外はない）*/
-
-	/* Sub-alignment flags for neutral monsters */
-	#define SUB_ALIGN_NEUTRAL 0x0000 /*!< モンスターのサブアライメント:中立 */
-	#define SUB_ALIGN_EVIL    0x0001 /*!< モンスターのサブアライメント:善 */
-	#define SUB_ALIGN_GOOD    0x0002 /*!< モンスターのサブアライメント:悪 */
-	BIT_FLAGS8 sub_align;	/*!< 中立属性のモンスターが召喚主のアライメントに従い一時的に立っている善悪陣営 / Sub-alignment for a neutral monster */
-
 	POSITION fy;		/*!< 所在グリッドY座標 / Y location on map */
 	POSITION fx;		/*!< 所在グリッドX座標 / X location on map */
-	HIT_POINT hp;		/*!< 現在のHP / Current Hit points */
-	HIT_POINT maxhp;		/*!< 現在の最大HP(衰弱効果などにより低下したものの反映) / Max Hit points */
-	HIT_POINT max_maxhp;		/*!< 生成時の初期最大HP / Max Max Hit points */
-	HIT_POINT dealt_damage;		/*!< これまでに蓄積して与えてきたダメージ / Sum of damages dealt by player */
-	TIME_EFFECT mtimed[MAX_MTIMED];	/*!< 与えられた時限効果の残りターン / Timed status counter */
-	SPEED mspeed;	        /*!< モンスターの個体加速値 / Monster "speed" */
-	ACTION_ENERGY energy_need;	/*!< モンスター次ターンまでに必要な行動エネルギー / Monster "energy" */
 	POSITION cdis;		/*!< 現在のプレイヤーから距離(逐一計算を避けるためのテンポラリ変数) Current dis from player */
+	ACTION_ENERGY energy_need;	/*!< モンスター次ターンまでに必要な行動エネルギー / Monster "energy" */
+	SPEED mspeed;	        /*!< モンスターの個体加速値 / Monster "speed" */
+	TIME_EFFECT mtimed[MAX_MTIMED];	/*!< 与えられた時限効果の残りターン / Timed status counter */
 	BIT_FLAGS8 mflag;	/*!< モンスター個体に与えられた特殊フラグ1 / Extra monster flags */
 	BIT_FLAGS8 mflag2;	/*!< モンスター個体に与えられた特殊フラグ2 /   Extra monster flags */
+
+	/* TODO: クローン、ペット、有効化は意義が異なるので別変数に切り離すこと。save/loadのバージョン更新が面倒そうだけど */
+	BIT_FLAGS smart; /*!< モンスターのプレイヤーに対する学習状態 / Field for "smart_learn" - Some bit-flags for the "smart" field */
+
+	u32b sight_stamp; /*!< 視認判定をした時のプレーヤーの感覚の世代 (0は未判定) / Sense generation of the last visibility check */
+	POSITION sight_y; /*!< 視認判定をした時のY座標 */
+	POSITION sight_x; /*!< 視認判定をした時のX座標 */
+	BIT_FLAGS16 sight_info; /*!< 視認判定をした時の所在グリッドの視界・照明フラグ */
+	MONRACE_IDX sight_r_idx; /*!< 視認判定をした時の実種族ID */
+	MONRACE_IDX sight_ap_r_idx; /*!< 視認判定をした時の外見種族ID */
 	bool ml;		/*!< モンスターがプレイヤーにとって視認できるか(処理のためのテンポラリ変数) Monster is "visible" */
-	OBJECT_IDX hold_o_idx;	/*!< モンスターが盗み処理により保持しているアイテム(object_type構造体自身がリスト構造を持つ) Object being held (if any) */
+	BIT_FLAGS8 sight_flags; /*!< 視認判定の結果 (ml・MFLAG_VIEW・MFLAG2_MARK) と、判定を省けないモンスターの印 */
 	POSITION target_y;		/*!< モンスターの攻撃目標対象Y座標 / Can attack !los player */
+
+	/* 以下は走査では読まない項目 / Cold fields, not touched by the per-turn sweeps */
 	POSITION target_x;		/*!< モンスターの攻撃目標対象X座標 /  Can attack !los player */
+	floor_type *current_floor_ptr; /*!< 所在フロアID（現状はfloor_type構造体によるオブジェクトは1つしかないためソースコード設計上の意義以外はない）*/
+	HIT_POINT hp;		/*!< 現在のHP / Current Hit points */
+	HIT_POINT maxhp;		/*!< 現在の最大HP(衰弱効果などにより低下したものの反映) / Max Hit points */
+	HIT_POINT max_maxhp;		/*!< 生成時の初期最大HP / Max Max Hit points */
+	HIT_POINT dealt_damage;		/*!< これまでに蓄積して与えてきたダメージ / Sum of damages dealt by player */
+	OBJECT_IDX hold_o_idx;	/*!< モンスターが盗み処理により保持しているアイテム(object_type構造体自身がリスト構造を持つ) Object being held (if any) */
+	MONSTER_IDX parent_m_idx; /*!< 召喚主のモンスターID */
 	STR_OFFSET nickname;	/*!< ペットに与えられた名前の保存先文字列オフセット Monster's Nickname */
-    EXP exp; /*!< モンスターの現在所持経験値 */
+	EXP exp; /*!< モンスターの現在所持経験値 */
+	/*
+	 * 走査からは加速・減速・無敵のいずれかが残っているモンスターについてだけ読まれる (mtimed[] が0なら読まない) ため、冷たい側に置く。
+	 * Read by the sweeps only while one of the countdown effects is active.
+	 */
+	u32b mtimed_stamp; /*!< 加速・減速・無敵の残りターンを記録した時のmtimed_tick / Timer tick at which the countdown effects were last stored */
 
-	/* TODO: クローン、ペット、有効化は意義が異なるので別変数に切り離すこと。save/loadのバージョン更新が面倒そうだけど */
-	BIT_FLAGS smart; /*!< モンスターのプレイヤーに対する学習状態 / Field for "smart_learn" - Some bit-flags for the "smart" field */
-	MONSTER_IDX parent_m_idx; /*!< 召喚主のモンスターID */
+	/* Sub-alignment flags for neutral monsters */
+	#define SUB_ALIGN_NEUTRAL 0x0000 /*!< モンスターのサブアライメント:中立 */
+	#define SUB_ALIGN_EVIL    0x0001 /*!< モンスターのサブアライメント:善 */
+	#define SUB_ALIGN_GOOD    0x0002 /*!< モンスターのサブアライメント:悪 */
+	BIT_FLAGS8 sub_align;	/*!< 中立属性のモンスターが召喚主のアライメントに従い一時的に立っている善悪陣営 / Sub-alignment for a neutral monster */
 } monster_type;
@@ -44,4 +44,7 @@ typedef struct object_type {
     OBJECT_IDX next_o_idx; /* Next object in stack (if any) */
     MONSTER_IDX held_m_idx; /*!< アイテムを所持しているモンスターID (いないなら 0) / Monster holding us (if any) */
     ARTIFACT_BIAS_IDX artifact_bias; /*!< ランダムアーティファクト生成時のバイアスID */
+
+    u32b autopick_version; /*!< 自動拾い判定のキャッシュを作った時のアイテムの状態の版 (0なら未判定) */
+    s16b autopick_idx; /*!< キャッシュした自動拾いの登録番号 (一致しなければ-1) */
 } object_type;
@@ -5,6 +5,7 @@
 #include "grid/feature-flag-types.h"
 #include "grid/grid.h"
 #include "system/floor-type-definition.h"
+#include "world/world.h"
 
 typedef struct projection_path_type {
     u16b *gp;
@@ -28,6 +29,30 @@ typedef struct projection_path_type {
     int k;
 } projection_path_type;
 
+/*! 射線キャッシュの大きさ (2の冪) / Number of memo slots, a power of two */
+#define PROJECTION_CACHE_BITS 12
+#define PROJECTION_CACHE_SIZE (1 << PROJECTION_CACHE_BITS)
+
+/*!
+ * @brief 射線キャッシュの1件 / One memoised projection query
+ * @details
+ * 経路が終点に届くかどうかは始点・終点・射程・フラグと地形だけで決まる (PROJECT_STOPを除く)。
+ * 同じゲームターン内で地形が変わっていない間は同じ答えを返せる。
+ */
+typedef struct projection_cache_entry {
+    u32b ends; /*!< 始点と終点を1バイトずつ詰めたもの / Both endpoints packed a byte each */
+    BIT_FLAGS flag; /*!< 経路のフラグ */
+    POSITION range; /*!< 射程 */
+    GAME_TURN turn; /*!< 記録したゲームターン */
+    u32b gen; /*!< 記録した時の地形の世代 */
+    bool reach; /*!< 経路が終点に届くか */
+} projection_cache_entry;
+
+static projection_cache_entry projection_cache[PROJECTION_CACHE_SIZE];
+static u32b projection_cache_gen = 1;
+
+projection_cache_stats projection_stats;
+
 /*
  * @brief Convert a "location" (Y, X) into a "grid" (G)
  * @param y Y座標
@@ -236,6 +261,63 @@ int projection_path(player_type *player_ptr, u16b *gp, POSITION range, POSITION
     return pp_ptr->n;
 }
 
+/*!
+ * @brief 射線キャッシュを破棄する / Drop every memoised projection query
+ * @return なし
+ * @details 地形が変わった時とフロアを作り直した時に呼ぶ。世代を進めるだけで表は消さない。
+ */
+void invalidate_projection_cache(void)
+{
+    projection_cache_gen++;
+    projection_stats.invalidations++;
+}
+
+/*!
+ * @brief 経路が終点に届くかを射線キャッシュを介して判定する / Whether a projection arrives at its destination, memoised
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param range 射程
+ * @param y1 始点Y座標
+ * @param x1 始点X座標
+ * @param y2 終点Y座標
+ * @param x2 終点X座標
+ * @param flag フラグID
+ * @return 終点に届くならTRUE
+ * @details PROJECT_STOPは経路上のクリーチャーに左右されるため記録しない。
+ */
+static bool projection_reaches(player_type *player_ptr, POSITION range, POSITION y1, POSITION x1, POSITION y2, POSITION x2, BIT_FLAGS flag)
+{
+    if ((y1 == y2) && (x1 == x2))
+        return TRUE;
+
+    projection_cache_entry *entry = NULL;
+    if (!((y1 | x1 | y2 | x2) & ~0xFF) && !(flag & PROJECT_STOP)) {
+        u32b ends = ((u32b)y1 << 24) | ((u32b)x1 << 16) | ((u32b)y2 << 8) | (u32b)x2;
+        u32b hash = (u32b)((ends ^ ((u32b)range << 3) ^ flag) * 2654435761UL);
+        entry = &projection_cache[(hash >> (32 - PROJECTION_CACHE_BITS)) & (PROJECTION_CACHE_SIZE - 1)];
+        if ((entry->ends == ends) && (entry->range == range) && (entry->flag == flag) && (entry->gen == projection_cache_gen)
+            && (entry->turn == current_world_ptr->game_turn)) {
+            projection_stats.hits++;
+            return entry->reach;
+        }
+
+        entry->ends = ends;
+    }
+
+    projection_stats.misses++;
+    u16b grid_g[512];
+    int grid_n = projection_path(player_ptr, grid_g, range, y1, x1, y2, x2, flag);
+    bool reach = (grid_n == 0) || ((get_grid_y(grid_g[grid_n - 1]) == y2) && (get_grid_x(grid_g[grid_n - 1]) == x2));
+    if (entry == NULL)
+        return reach;
+
+    entry->flag = flag;
+    entry->range = range;
+    entry->turn = current_world_ptr->game_turn;
+    entry->gen = projection_cache_gen;
+    entry->reach = reach;
+    return reach;
+}
+
 /*
  * Determine if a bolt spell cast from (y1,x1) to (y2,x2) will arrive
  * at the final destination, assuming no monster gets in the way.
@@ -244,17 +326,28 @@ int projection_path(player_type *player_ptr, u16b *gp, POSITION range, POSITION
  */
 bool projectable(player_type *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2)
 {
-    u16b grid_g[512];
-    int grid_n = projection_path(player_ptr, grid_g, (project_length ? project_length : get_max_range(player_ptr)), y1, x1, y2, x2, 0);
-    if (!grid_n)
-        return TRUE;
-
-    POSITION y = get_grid_y(grid_g[grid_n - 1]);
-    POSITION x = get_grid_x(grid_g[grid_n - 1]);
-    if ((y != y2) || (x != x2))
-        return FALSE;
+    return projection_reaches(player_ptr, (project_length ? project_length : get_max_range(player_ptr)), y1, x1, y2, x2, 0);
+}
 
-    return TRUE;
+/*!
+ * @brief 1つの始点から複数の終点へのprojectable()を終点ごとに判定する / projectable() from one source to each of many targets
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param y1 始点Y座標
+ * @param x1 始点X座標
+ * @param num 終点の数
+ * @param ys 終点Y座標の配列
+ * @param xs 終点X座標の配列
+ * @param results 各終点に届くかを返す配列
+ * @return なし
+ * @details
+ * 射程の決定を1度で済ませ、終点ごとに射線キャッシュを引いて、無ければ経路を1本ずつ辿る。
+ * 経路は終点への傾きで決まり、終点が違えば途中の経路も共有できないため、全終点を1度の走査で判定することはしない。
+ */
+void projectable_targets(player_type *player_ptr, POSITION y1, POSITION x1, int num, const POSITION *ys, const POSITION *xs, bool *results)
+{
+    POSITION range = project_length ? project_length : get_max_range(player_ptr);
+    for (int i = 0; i < num; i++)
+        results[i] = projection_reaches(player_ptr, range, y1, x1, ys[i], xs[i], 0);
 }
 
 /*!
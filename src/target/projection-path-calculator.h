@@ -1,9 +1,22 @@
-#pragma once
+﻿#pragma once
 
 #include "system/angband.h"
 
+/*!
+ * @brief 射線キャッシュの統計 / Statistics of the projectable() memo
+ */
+typedef struct projection_cache_stats {
+    u32b hits; /*!< キャッシュから答えた回数 / Queries answered from the memo */
+    u32b misses; /*!< 経路を計算した回数 / Queries that traced a path */
+    u32b invalidations; /*!< 地形変化で破棄した回数 / Times the memo was dropped for a terrain change */
+} projection_cache_stats;
+
+extern projection_cache_stats projection_stats;
+
 int projection_path(player_type *player_ptr, u16b *gp, POSITION range, POSITION y1, POSITION x1, POSITION y2, POSITION x2, BIT_FLAGS flg);
 bool projectable(player_type *player_ptr, POSITION y1, POSITION x1, POSITION y2, POSITION x2);
+void projectable_targets(player_type *player_ptr, POSITION y1, POSITION x1, int num, const POSITION *ys, const POSITION *xs, bool *results);
+void invalidate_projection_cache(void);
 int get_max_range(player_type *creature_ptr);
 POSITION get_grid_y(u16b grid);
 POSITION get_grid_x(u16b grid);
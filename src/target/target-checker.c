@@ -14,6 +14,7 @@
 #include "core/player-update-types.h"
 #include "core/window-redrawer.h"
 #include "core/disturbance.h"
+#include "floor/floor-slot-list.h"
 #include "game-option/disturbance-options.h"
 #include "game-option/map-screen-options.h"
 #include "io/cursor.h"
@@ -26,6 +27,7 @@
 
 /* Targetting variables */
 MONSTER_IDX target_who;
+u16b target_generation; /*!< target_who を選んだ時の枠の世代 */
 POSITION target_col;
 POSITION target_row;
 
@@ -124,6 +126,11 @@ bool target_okay(player_type *creature_ptr)
     if (target_who <= 0)
         return FALSE;
 
+    if (!is_slot_current(&creature_ptr->current_floor_ptr->m_slots, target_who, target_generation)) {
+        target_who = 0;
+        return FALSE;
+    }
+
     if (!target_able(creature_ptr, target_who))
         return FALSE;
 
@@ -3,6 +3,7 @@
 #include "system/angband.h"
 
 extern MONSTER_IDX target_who;
+extern u16b target_generation;
 extern POSITION target_col;
 extern POSITION target_row;
 
@@ -3,6 +3,7 @@
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
 #include "core/window-redrawer.h"
+#include "floor/floor-slot-list.h"
 #include "floor/line-of-sight.h"
 #include "game-option/cheat-options.h"
 #include "game-option/game-play-options.h"
@@ -174,6 +175,7 @@ static void switch_target_input(player_type *creature_ptr, ts_type *ts_ptr)
 
         health_track(creature_ptr, ts_ptr->g_ptr->m_idx);
         target_who = ts_ptr->g_ptr->m_idx;
+        target_generation = slot_generation(&creature_ptr->current_floor_ptr->m_slots, target_who);
         target_row = ts_ptr->y;
         target_col = ts_ptr->x;
         ts_ptr->done = TRUE;
@@ -123,7 +123,11 @@ const concptr window_flag_desc[32] =
 	_("アイテムの詳細", "Display object recall"),
 	_("自分の周囲を表示", "Display dungeon view"),
 	_("記念撮影", "Display snap-shot"),
+#ifdef TURN_PROFILER
+	_("ターン処理の計測結果", "Display turn profile"),
+#else
 	NULL,
+#endif
 	NULL,
 	NULL,
 	NULL,
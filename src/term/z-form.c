@@ -180,6 +180,345 @@ static uint vstrnfmt_aux_dflt(char *buf, uint max, concptr fmt, vptr arg)
 static vstrnfmt_aux_func vstrnfmt_aux = vstrnfmt_aux_dflt;
 
 
+/*
+ * Compiled format strings.
+ *
+ * Most format strings are literals which are formatted over and over
+ * (combat messages in particular), so the result of scanning one is
+ * remembered: the literal runs, and for each format sequence the "aux"
+ * string handed to "sprintf()" plus the "long" and "capitalize" flags.
+ * A plain "%s" or "%d" is then appended directly, without "sprintf()".
+ *
+ * The cache is keyed on the address of the format string, and a copy of
+ * the text is kept to make sure that a reused buffer is not mistaken for
+ * the string it held before.  Formats using "%n", "%r", "*", "%v" or any
+ * unusual sequence are never compiled and take the normal path below.
+ */
+
+/* Number of compiled format strings (a power of two) */
+#define FORMAT_CACHE_SIZE	256
+
+/* Longest format string which is compiled */
+#define FORMAT_CACHE_TEXT	128
+
+/* Most format sequences in a compiled format string */
+#define FORMAT_CACHE_SPECS	12
+
+/* Longest "aux" string of a compiled format sequence */
+#define FORMAT_CACHE_AUX	16
+
+/*
+ * One compiled format sequence, and the literal run before it
+ */
+typedef struct format_spec
+{
+	byte lit_start;		/* Offset of the preceding literal run */
+	byte lit_len;		/* Length of the preceding literal run */
+	char conv;		/* Conversion character, or '%' for "%%" */
+	bool do_long;		/* The argument is "long" */
+	bool do_xtra;		/* Capitalize the result */
+	bool plain;		/* The sequence is exactly "%s" or "%d" */
+	char aux[FORMAT_CACHE_AUX];	/* The sequence as passed to "sprintf()" */
+} format_spec;
+
+/*
+ * One compiled format string
+ */
+typedef struct format_cache_entry
+{
+	concptr fmt;		/* Address of the format string, or NULL */
+	int num;		/* Number of sequences, or -1 if not compilable */
+	byte tail_start;	/* Offset of the final literal run */
+	byte tail_len;		/* Length of the final literal run */
+	char text[FORMAT_CACHE_TEXT];	/* Copy of the format string */
+	format_spec spec[FORMAT_CACHE_SPECS];
+} format_cache_entry;
+
+/* Whether compiled format strings are used (for benchmarking) */
+bool use_format_cache = TRUE;
+
+/* Statistics of the compiled format strings */
+format_cache_stats_type format_cache_stats;
+
+static format_cache_entry format_cache[FORMAT_CACHE_SIZE];
+
+
+/*
+ * Scan a format string into "entry".  Return FALSE if the string uses
+ * anything which only the normal path handles.
+ */
+static bool compile_format(format_cache_entry *entry, concptr fmt)
+{
+	concptr s = fmt;
+	uint lit = 0;
+	int num = 0;
+
+	while (*s)
+	{
+		format_spec *spec;
+		uint q = 0;
+
+		/* Literal characters are copied as runs */
+		if (*s != '%')
+		{
+			s++;
+			continue;
+		}
+
+		if (num == FORMAT_CACHE_SPECS) return FALSE;
+
+		spec = &entry->spec[num++];
+		spec->lit_start = (byte)lit;
+		spec->lit_len = (byte)((s - fmt) - lit);
+		spec->do_long = FALSE;
+		spec->do_xtra = FALSE;
+		spec->plain = FALSE;
+
+		/* Skip the "percent" */
+		s++;
+
+		/* Handle "%%" */
+		if (*s == '%')
+		{
+			spec->conv = '%';
+			s++;
+			lit = (uint)(s - fmt);
+			continue;
+		}
+
+		/* Build the "aux" string, as "vstrnfmt()" does */
+		spec->aux[q++] = '%';
+		while (TRUE)
+		{
+			if (!*s || (q >= FORMAT_CACHE_AUX - 1)) return FALSE;
+
+			if (isalpha(*s))
+			{
+				if (*s == 'L') return FALSE;
+
+				if (*s == 'l')
+				{
+					spec->aux[q++] = *s++;
+					spec->do_long = TRUE;
+					continue;
+				}
+
+				spec->aux[q++] = *s++;
+				break;
+			}
+
+			if (*s == '*') return FALSE;
+
+			if (*s == '^')
+			{
+				spec->do_xtra = TRUE;
+				s++;
+				continue;
+			}
+
+			spec->aux[q++] = *s++;
+		}
+
+		spec->aux[q] = '\0';
+		spec->conv = spec->aux[q - 1];
+		if (!strchr("cdiouxXeEfgGps", spec->conv)) return FALSE;
+
+		spec->plain = (q == 2) && ((spec->conv == 's') || (spec->conv == 'd'));
+		lit = (uint)(s - fmt);
+	}
+
+	entry->num = num;
+	entry->tail_start = (byte)lit;
+	entry->tail_len = (byte)((s - fmt) - lit);
+	return TRUE;
+}
+
+
+/*
+ * Find the compiled form of a format string, compiling it if needed.
+ * Return NULL if the string must take the normal path.
+ */
+static format_cache_entry *find_format_cache(concptr fmt)
+{
+	format_cache_entry *entry;
+	size_t len;
+
+	if (!use_format_cache) return NULL;
+
+	entry = &format_cache[(((size_t)fmt >> 2) * 2654435761UL >> 8) & (FORMAT_CACHE_SIZE - 1)];
+	if ((entry->fmt == fmt) && streq(entry->text, fmt))
+	{
+		if (entry->num < 0) return NULL;
+
+		format_cache_stats.hit++;
+		return entry;
+	}
+
+	len = strlen(fmt);
+	if (len >= FORMAT_CACHE_TEXT)
+	{
+		format_cache_stats.skip++;
+		return NULL;
+	}
+
+	format_cache_stats.miss++;
+	entry->fmt = fmt;
+	memcpy(entry->text, fmt, len + 1);
+	if (!compile_format(entry, fmt))
+	{
+		entry->num = -1;
+		format_cache_stats.skip++;
+		return NULL;
+	}
+
+	return entry;
+}
+
+
+/*
+ * Append "len" bytes of "str" to "buf", stopping at "max - 1"
+ */
+static uint append_format_text(char *buf, uint max, uint n, concptr str, uint len)
+{
+	if (len > max - 1 - n) len = max - 1 - n;
+	memcpy(buf + n, str, len);
+	return n + len;
+}
+
+
+/*
+ * Format an "int" in decimal, as "sprintf(tmp, "%d", arg)" would
+ */
+static void format_decimal(char *tmp, int arg)
+{
+	char digits[16];
+	unsigned long v = (arg < 0) ? (0UL - (unsigned long)arg) : (unsigned long)arg;
+	int k = 0;
+
+	do
+	{
+		digits[k++] = (char)('0' + (v % 10));
+		v /= 10;
+	}
+	while (v);
+
+	if (arg < 0) *tmp++ = '-';
+	while (k) *tmp++ = digits[--k];
+	*tmp = '\0';
+}
+
+
+/*
+ * Format the arguments with a compiled format string.  The result is
+ * the same as that of the normal path in "vstrnfmt()".
+ */
+static uint vstrnfmt_compiled(char *buf, uint max, format_cache_entry *entry, va_list vp)
+{
+	uint n = 0;
+	int i;
+
+	/* Resulting string of a format sequence */
+	char tmp[1024];
+
+	for (i = 0; i < entry->num; i++)
+	{
+		format_spec *spec = &entry->spec[i];
+		concptr res = tmp;
+		uint start, q;
+
+		n = append_format_text(buf, max, n, entry->text + spec->lit_start, spec->lit_len);
+
+		if (spec->conv == '%')
+		{
+			n = append_format_text(buf, max, n, "%", 1);
+			continue;
+		}
+
+		switch (spec->conv)
+		{
+			case 'c':
+			{
+				sprintf(tmp, "%c", va_arg(vp, int));
+				break;
+			}
+
+			case 'd': case 'i':
+			{
+				if (spec->plain) format_decimal(tmp, va_arg(vp, int));
+				else if (spec->do_long) sprintf(tmp, spec->aux, va_arg(vp, long));
+				else sprintf(tmp, spec->aux, va_arg(vp, int));
+				break;
+			}
+
+			case 'u': case 'o': case 'x': case 'X':
+			{
+				if (spec->do_long) sprintf(tmp, spec->aux, va_arg(vp, unsigned long));
+				else sprintf(tmp, spec->aux, va_arg(vp, unsigned int));
+				break;
+			}
+
+			case 'f':
+			case 'e': case 'E':
+			case 'g': case 'G':
+			{
+				sprintf(tmp, spec->aux, va_arg(vp, double));
+				break;
+			}
+
+			case 'p':
+			{
+				sprintf(tmp, spec->aux, va_arg(vp, vptr));
+				break;
+			}
+
+			case 's':
+			{
+				concptr arg = va_arg(vp, concptr);
+
+				/* Hack -- convert NULL to EMPTY */
+				if (!arg) arg = "";
+
+				if (spec->plain) res = arg;
+				else sprintf(tmp, spec->aux, arg);
+				break;
+			}
+		}
+
+		start = n;
+		n = append_format_text(buf, max, n, res, (uint)strlen(res));
+
+		/* Mega-Hack -- handle "capitilization" */
+		if (!spec->do_xtra) continue;
+
+#ifdef JP
+		for (q = 0; res[q]; q++) if (iskanji(res[q])) break;
+		if (res[q]) continue;
+#endif
+		for (q = start; q < n; q++)
+		{
+			/* Notice first non-space */
+			if (!iswspace(buf[q]))
+			{
+				/* Capitalize if possible */
+				if (islower(buf[q]))
+					buf[q] = (char)toupper(buf[q]);
+
+				break;
+			}
+		}
+	}
+
+	n = append_format_text(buf, max, n, entry->text + entry->tail_start, entry->tail_len);
+
+	/* Terminate buffer */
+	buf[n] = '\0';
+
+	/* Return length */
+	return (n);
+}
+
+
+
 
 /*
  * Basic "vararg" format function.
@@ -253,6 +592,9 @@ uint vstrnfmt(char *buf, uint max, concptr fmt, va_list vp)
 	/* Resulting string */
 	char tmp[1024];
 
+	/* Compiled format string */
+	format_cache_entry *entry;
+
 
 	/* Mega-Hack -- treat "illegal" length as "infinite" */
 	if (!max) max = 32767;
@@ -260,6 +602,10 @@ uint vstrnfmt(char *buf, uint max, concptr fmt, va_list vp)
 	/* Mega-Hack -- treat "no format" as "empty string" */
 	if (!fmt) fmt = "";
 
+	/* Use the compiled form of a known format string */
+	entry = find_format_cache(fmt);
+	if (entry) return vstrnfmt_compiled(buf, max, entry, vp);
+
 
 	/* Begin the buffer */
 	n = 0;
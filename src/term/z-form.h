@@ -25,6 +25,26 @@
  */
 
 
+/*
+ * Statistics of the compiled format strings
+ */
+typedef struct format_cache_stats_type
+{
+	u32b hit;	/* Formats served by a compiled string */
+	u32b miss;	/* Format strings compiled */
+	u32b skip;	/* Format strings left to the normal path */
+} format_cache_stats_type;
+
+
+/**** Available Variables ****/
+
+/* Whether compiled format strings are used */
+extern bool use_format_cache;
+
+/* Statistics of the compiled format strings */
+extern format_cache_stats_type format_cache_stats;
+
+
 /**** Available Functions ****/
 
 /* Format arguments into given bounded-length buffer */
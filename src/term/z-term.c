@@ -8,6 +8,7 @@
  */
 
 #include "term/z-term.h"
+#include "core/turn-profiler.h"
 #include "game-option/runtime-arguments.h"
 #include "game-option/special-options.h"
 #include "term/term-color-types.h"
@@ -1024,7 +1025,7 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 /*
  * @brief Actually perform all requested changes to the window
  */
-errr term_fresh(void)
+static errr refresh_term(void)
 {
     int w = Term->wid;
     int h = Term->hgt;
@@ -1264,6 +1265,17 @@ errr term_fresh(void)
     return 0;
 }
 
+/*
+ * @brief Actually perform all requested changes to the window, timed by the turn profiler
+ */
+errr term_fresh(void)
+{
+    TURN_PROFILE_BEGIN(TPS_TERM_FRESH);
+    errr result = refresh_term();
+    TURN_PROFILE_END(TPS_TERM_FRESH);
+    return result;
+}
+
 /*** Output routines ***/
 
 /*
@@ -1849,11 +1861,16 @@ errr term_inkey(char *ch, bool wait, bool take)
 
     /* Wait */
     if (wait) {
+        /* Keep the wait out of the profiled sections */
+        TURN_PROFILE_IDLE_BEGIN();
+
         /* Process pending events while necessary */
         while (Term->key_head == Term->key_tail) {
             /* Process events (wait for one) */
             term_xtra(TERM_XTRA_EVENT, TRUE);
         }
+
+        TURN_PROFILE_IDLE_END();
     }
 
     /* Do not Wait */
@@ -410,7 +410,7 @@ int fd_open(concptr file, int flags)
 /*
  * Hack -- attempt to lock a file descriptor
  *
- * Legal lock types -- F_UNLCK, F_RDLCK, F_WRLCK
+ * Legal lock types -- F_UNLCK, F_RDLCK (shared), F_WRLCK (exclusive)
  */
 errr fd_lock(int fd, int what)
 {
@@ -421,6 +421,9 @@ errr fd_lock(int fd, int what)
 #if defined(SET_UID) && defined(LOCK_UN) && defined(LOCK_EX)
     if (what == F_UNLCK) {
         (void)flock(fd, LOCK_UN);
+    } else if (what == F_RDLCK) {
+        if (flock(fd, LOCK_SH) != 0)
+            return 1;
     } else {
         if (flock(fd, LOCK_EX) != 0)
             return 1;
@@ -1,692 +1,658 @@
-﻿#include "util/sort.h"
+﻿/*!
+ * @brief ソート処理 / Sorting engine and sort orders for in-game lists
+ * @details
+ * 汎用ソートはイントロソート (中央値3点選択のクイックソートを基本とし、
+ * 再帰が深くなり過ぎたらヒープソートへ、小区間は挿入ソートへ切り替える) で、
+ * 最悪でもO(n log n) を保証する。安定ソートが必要な場合はマージソートを使う。
+ * 各リストの並べ替えは、比較の度にr_info等を参照する代わりに、
+ * 要素ごとに比較キーを一度だけ計算してから添字をソートする。
+ */
+
+#include "util/sort.h"
 #include "dungeon/quest.h"
 #include "grid/feature.h"
 #include "grid/grid.h"
 #include "monster-race/monster-race.h"
 #include "monster-race/race-flags1.h"
 #include "monster/monster-flag-types.h"
+#include "room/rooms-pit-nest.h"
 #include "system/artifact-type-definition.h"
 #include "system/floor-type-definition.h"
+#include "system/monster-race-definition.h"
+#include "system/monster-type-definition.h"
 
-/*
- * @brief クイックソートの実行 / Quick sort in place
- * @param u アイテムやモンスター等への配列
- * @param v 条件基準IDへの参照ポインタ
- * @param a 比較対象のID1
- * @param b 比較対象のID2
- * @param ang_sort_comp 比較用の関数ポインタ
- * @param ang_sort_swap スワップ用の関数ポインタ
- * @return なし
- */
-static void exe_ang_sort(player_type *player_ptr, vptr u, vptr v, int p, int q, bool (*ang_sort_comp)(player_type *, vptr, vptr, int, int),
-    void (*ang_sort_swap)(player_type *, vptr, vptr, int, int))
-{
-    if (p >= q)
-        return;
+/*!< これ以下の長さの区間は挿入ソートで整列する */
+#define SORT_INSERTION_THRESHOLD 12
 
-    int z = p;
-    int a = p;
-    int b = q;
-    while (TRUE) {
-        /* Slide i2 */
-        while (!(*ang_sort_comp)(player_ptr, u, v, b, z))
-            b--;
+/*!< 要素交換用の一時バッファの大きさ (これより大きい要素はバイト単位で交換する) */
+#define SORT_SWAP_BUFFER_SIZE 64
 
-        /* Slide i1 */
-        while (!(*ang_sort_comp)(player_ptr, u, v, z, a))
-            a++;
+/*!
+ * @brief 汎用ソートの作業情報 / Working state of one sort_array() call
+ */
+typedef struct sort_work_type {
+    byte *base; /*!< 配列の先頭 */
+    size_t size; /*!< 要素1つの大きさ */
+    sort_comp_func comp; /*!< 比較関数 */
+    const void *ctx; /*!< 比較関数へ渡す付随情報 */
+} sort_work_type;
 
-        if (a >= b)
-            break;
+#define SORT_ELEM(W, I) ((W)->base + (size_t)(I) * (W)->size)
 
-        (*ang_sort_swap)(player_ptr, u, v, a, b);
+static int compare_elems(sort_work_type *w, int a, int b)
+{
+    return (*w->comp)(SORT_ELEM(w, a), SORT_ELEM(w, b), w->ctx);
+}
 
-        a++, b--;
-    }
+static void swap_elems(sort_work_type *w, int a, int b)
+{
+    if (a == b)
+        return;
 
-    /* Recurse left side */
-    exe_ang_sort(player_ptr, u, v, p, b, ang_sort_comp, ang_sort_swap);
+    byte *pa = SORT_ELEM(w, a);
+    byte *pb = SORT_ELEM(w, b);
+    if (w->size <= SORT_SWAP_BUFFER_SIZE) {
+        byte tmp[SORT_SWAP_BUFFER_SIZE];
+        memcpy(tmp, pa, w->size);
+        memcpy(pa, pb, w->size);
+        memcpy(pb, tmp, w->size);
+        return;
+    }
 
-    /* Recurse right side */
-    exe_ang_sort(player_ptr, u, v, b + 1, q, ang_sort_comp, ang_sort_swap);
+    for (size_t i = 0; i < w->size; i++) {
+        byte tmp = pa[i];
+        pa[i] = pb[i];
+        pb[i] = tmp;
+    }
 }
 
-/*
- * @brief クイックソートの受け付け / Accepting auick sort in place
- * @param u アイテムやモンスター等への配列
- * @param v 条件基準IDへの参照ポインタ
- * @param a 比較対象のID1
- * @param b 比較対象のID2
- * @param ang_sort_comp 比較用の関数ポインタ
- * @param ang_sort_swap スワップ用の関数ポインタ
- * @return なし
+/*!
+ * @brief 挿入ソート (区間[lo, hi]、安定) / Insertion sort
  */
-void ang_sort(player_type *player_ptr, vptr u, vptr v, int n, bool (*ang_sort_comp)(player_type *, vptr, vptr, int, int),
-    void (*ang_sort_swap)(player_type *, vptr, vptr, int, int))
+static void insertion_sort(sort_work_type *w, int lo, int hi)
 {
-    exe_ang_sort(player_ptr, u, v, 0, n - 1, ang_sort_comp, ang_sort_swap);
+    for (int i = lo + 1; i <= hi; i++)
+        for (int j = i; (j > lo) && (compare_elems(w, j - 1, j) > 0); j--)
+            swap_elems(w, j - 1, j);
 }
 
-/*
- * Sorting hook -- comp function -- by "distance to player"
- *
- * We use "u" and "v" to point to arrays of "x" and "y" positions,
- * and sort the arrays by double-distance to the player.
+/*!
+ * @brief ヒープの要素を下方へ移動させる / Sift an element down a max-heap rooted at lo
  */
-bool ang_sort_comp_distance(player_type *player_ptr, vptr u, vptr v, int a, int b)
+static void sift_down(sort_work_type *w, int lo, int root, int n)
 {
-    POSITION *x = (POSITION *)(u);
-    POSITION *y = (POSITION *)(v);
-
-    /* Absolute distance components */
-    POSITION kx = x[a];
-    kx -= player_ptr->x;
-    kx = ABS(kx);
-    POSITION ky = y[a];
-    ky -= player_ptr->y;
-    ky = ABS(ky);
-
-    /* Approximate Double Distance to the first point */
-    POSITION da = ((kx > ky) ? (kx + kx + ky) : (ky + ky + kx));
-
-    /* Absolute distance components */
-    kx = x[b];
-    kx -= player_ptr->x;
-    kx = ABS(kx);
-    ky = y[b];
-    ky -= player_ptr->y;
-    ky = ABS(ky);
-
-    /* Approximate Double Distance to the first point */
-    POSITION db = ((kx > ky) ? (kx + kx + ky) : (ky + ky + kx));
-
-    /* Compare the distances */
-    return (da <= db);
+    while (TRUE) {
+        int child = 2 * root + 1;
+        if (child >= n)
+            return;
+
+        if ((child + 1 < n) && (compare_elems(w, lo + child, lo + child + 1) < 0))
+            child++;
+
+        if (compare_elems(w, lo + root, lo + child) >= 0)
+            return;
+
+        swap_elems(w, lo + root, lo + child);
+        root = child;
+    }
 }
 
-/*
- * Sorting hook -- comp function -- by importance level of grids
- *
- * We use "u" and "v" to point to arrays of "x" and "y" positions,
- * and sort the arrays by level of monster
+/*!
+ * @brief ヒープソート (区間[lo, hi]) / Heap sort, the fallback of intro sort
  */
-bool ang_sort_comp_importance(player_type *player_ptr, vptr u, vptr v, int a, int b)
+static void heap_sort(sort_work_type *w, int lo, int hi)
 {
-    POSITION *x = (POSITION *)(u);
-    POSITION *y = (POSITION *)(v);
-    grid_type *ca_ptr = &player_ptr->current_floor_ptr->grid_array[y[a]][x[a]];
-    grid_type *cb_ptr = &player_ptr->current_floor_ptr->grid_array[y[b]][x[b]];
-    monster_type *ma_ptr = &player_ptr->current_floor_ptr->m_list[ca_ptr->m_idx];
-    monster_type *mb_ptr = &player_ptr->current_floor_ptr->m_list[cb_ptr->m_idx];
-    monster_race *ap_ra_ptr, *ap_rb_ptr;
-
-    /* The player grid */
-    if (y[a] == player_ptr->y && x[a] == player_ptr->x)
-        return TRUE;
-
-    if (y[b] == player_ptr->y && x[b] == player_ptr->x)
-        return FALSE;
-
-    /* Extract monster race */
-    if (ca_ptr->m_idx && ma_ptr->ml)
-        ap_ra_ptr = &r_info[ma_ptr->ap_r_idx];
-    else
-        ap_ra_ptr = NULL;
-
-    if (cb_ptr->m_idx && mb_ptr->ml)
-        ap_rb_ptr = &r_info[mb_ptr->ap_r_idx];
-    else
-        ap_rb_ptr = NULL;
-
-    if (ap_ra_ptr && !ap_rb_ptr)
-        return TRUE;
-
-    if (!ap_ra_ptr && ap_rb_ptr)
-        return FALSE;
-
-    /* Compare two monsters */
-    if (ap_ra_ptr && ap_rb_ptr) {
-        /* Unique monsters first */
-        if ((ap_ra_ptr->flags1 & RF1_UNIQUE) && !(ap_rb_ptr->flags1 & RF1_UNIQUE))
-            return TRUE;
-        if (!(ap_ra_ptr->flags1 & RF1_UNIQUE) && (ap_rb_ptr->flags1 & RF1_UNIQUE))
-            return FALSE;
-
-        /* Shadowers first (あやしい影) */
-        if ((ma_ptr->mflag2 & MFLAG2_KAGE) && !(mb_ptr->mflag2 & MFLAG2_KAGE))
-            return TRUE;
-        if (!(ma_ptr->mflag2 & MFLAG2_KAGE) && (mb_ptr->mflag2 & MFLAG2_KAGE))
-            return FALSE;
-
-        /* Unknown monsters first */
-        if (!ap_ra_ptr->r_tkills && ap_rb_ptr->r_tkills)
-            return TRUE;
-        if (ap_ra_ptr->r_tkills && !ap_rb_ptr->r_tkills)
-            return FALSE;
-
-        /* Higher level monsters first (if known) */
-        if (ap_ra_ptr->r_tkills && ap_rb_ptr->r_tkills) {
-            if (ap_ra_ptr->level > ap_rb_ptr->level)
-                return TRUE;
-            if (ap_ra_ptr->level < ap_rb_ptr->level)
-                return FALSE;
-        }
+    int n = hi - lo + 1;
+    for (int i = n / 2 - 1; i >= 0; i--)
+        sift_down(w, lo, i, n);
 
-        /* Sort by index if all conditions are same */
-        if (ma_ptr->ap_r_idx > mb_ptr->ap_r_idx)
-            return TRUE;
-        if (ma_ptr->ap_r_idx < mb_ptr->ap_r_idx)
-            return FALSE;
+    for (int i = n - 1; i > 0; i--) {
+        swap_elems(w, lo, lo + i);
+        sift_down(w, lo, 0, i);
     }
+}
 
-    /* An object get higher priority */
-    if (player_ptr->current_floor_ptr->grid_array[y[a]][x[a]].o_idx && !player_ptr->current_floor_ptr->grid_array[y[b]][x[b]].o_idx)
-        return TRUE;
+/*!
+ * @brief イントロソート本体 (区間[lo, hi]) / Intro sort
+ * @param depth ヒープソートへ切り替えるまでの残り分割回数
+ * @details
+ * 3点の中央値をピボットとしてhi - 1へ退避し、lo及びhiを番兵として分割する。
+ * 短い側を再帰し長い側はループで処理するので、スタックの深さはO(log n)に収まる。
+ */
+static void intro_sort(sort_work_type *w, int lo, int hi, int depth)
+{
+    while (hi - lo + 1 > SORT_INSERTION_THRESHOLD) {
+        if (depth-- <= 0) {
+            heap_sort(w, lo, hi);
+            return;
+        }
 
-    if (!player_ptr->current_floor_ptr->grid_array[y[a]][x[a]].o_idx && player_ptr->current_floor_ptr->grid_array[y[b]][x[b]].o_idx)
-        return FALSE;
+        int mid = lo + (hi - lo) / 2;
+        if (compare_elems(w, mid, lo) < 0)
+            swap_elems(w, mid, lo);
 
-    /* Priority from the terrain */
-    if (f_info[ca_ptr->feat].priority > f_info[cb_ptr->feat].priority)
-        return TRUE;
+        if (compare_elems(w, hi, lo) < 0)
+            swap_elems(w, hi, lo);
 
-    if (f_info[ca_ptr->feat].priority < f_info[cb_ptr->feat].priority)
-        return FALSE;
+        if (compare_elems(w, hi, mid) < 0)
+            swap_elems(w, hi, mid);
 
-    /* If all conditions are same, compare distance */
-    return ang_sort_comp_distance(player_ptr, u, v, a, b);
-}
+        int pivot = hi - 1;
+        swap_elems(w, mid, pivot);
+        int i = lo;
+        int j = pivot;
+        while (TRUE) {
+            while (compare_elems(w, ++i, pivot) < 0)
+                ;
 
-/*
- * Sorting hook -- swap function -- by "distance to player"
- *
- * We use "u" and "v" to point to arrays of "x" and "y" positions,
- * and sort the arrays by distance to the player.
- */
-void ang_sort_swap_distance(player_type *player_ptr, vptr u, vptr v, int a, int b)
-{
-    /* Unused */
-    (void)player_ptr;
+            while (compare_elems(w, pivot, --j) < 0)
+                ;
+
+            if (i >= j)
+                break;
 
-    POSITION *x = (POSITION *)(u);
-    POSITION *y = (POSITION *)(v);
+            swap_elems(w, i, j);
+        }
 
-    POSITION temp = x[a];
-    x[a] = x[b];
-    x[b] = temp;
+        swap_elems(w, i, pivot);
+        if (i - lo < hi - i) {
+            intro_sort(w, lo, i - 1, depth);
+            lo = i + 1;
+        } else {
+            intro_sort(w, i + 1, hi, depth);
+            hi = i - 1;
+        }
+    }
 
-    temp = y[a];
-    y[a] = y[b];
-    y[b] = temp;
+    insertion_sort(w, lo, hi);
 }
 
-/*
- * Sorting hook -- Comp function -- see below
- *
- * We use "u" to point to array of monster indexes,
- * and "v" to select the type of sorting to perform on "u".
+/*!
+ * @brief マージソート本体 (区間[lo, hi]、安定) / Stable merge sort
+ * @param tmp 区間と同じ大きさの作業領域
  */
-bool ang_sort_art_comp(player_type *player_ptr, vptr u, vptr v, int a, int b)
+static void merge_sort(sort_work_type *w, byte *tmp, int lo, int hi)
 {
-    /* Unused */
-    (void)player_ptr;
-
-    u16b *who = (u16b *)(u);
-    u16b *why = (u16b *)(v);
-
-    int w1 = who[a];
-    int w2 = who[b];
+    if (hi - lo + 1 <= SORT_INSERTION_THRESHOLD) {
+        insertion_sort(w, lo, hi);
+        return;
+    }
 
-    int z1, z2;
+    int mid = lo + (hi - lo) / 2;
+    merge_sort(w, tmp, lo, mid);
+    merge_sort(w, tmp, mid + 1, hi);
 
-    /* Sort by total kills */
-    if (*why >= 3) {
-        /* Extract total kills */
-        z1 = a_info[w1].tval;
-        z2 = a_info[w2].tval;
+    /* 既に整列済なら併合不要 */
+    if (compare_elems(w, mid, mid + 1) <= 0)
+        return;
 
-        /* Compare total kills */
-        if (z1 < z2)
-            return TRUE;
+    size_t left_bytes = (size_t)(mid - lo + 1) * w->size;
+    memcpy(tmp, SORT_ELEM(w, lo), left_bytes);
+    byte *left = tmp;
+    byte *left_end = tmp + left_bytes;
+    byte *right = SORT_ELEM(w, mid + 1);
+    byte *right_end = SORT_ELEM(w, hi + 1);
+    byte *out = SORT_ELEM(w, lo);
+    while ((left < left_end) && (right < right_end)) {
+        if ((*w->comp)(right, left, w->ctx) < 0) {
+            memcpy(out, right, w->size);
+            right += w->size;
+        } else {
+            memcpy(out, left, w->size);
+            left += w->size;
+        }
 
-        if (z1 > z2)
-            return FALSE;
+        out += w->size;
     }
 
-    /* Sort by monster level */
-    if (*why >= 2) {
-        /* Extract levels */
-        z1 = a_info[w1].sval;
-        z2 = a_info[w2].sval;
+    memcpy(out, left, (size_t)(left_end - left));
+}
 
-        /* Compare levels */
-        if (z1 < z2)
-            return TRUE;
+/*!
+ * @brief 配列をソートする / Sort an array in place
+ * @param base 配列の先頭
+ * @param n 要素数
+ * @param size 要素1つの大きさ
+ * @param comp 比較関数
+ * @param ctx 比較関数へ渡す付随情報
+ * @param stable TRUEなら同順の要素の並びを保存する (作業領域を確保する)
+ * @return なし
+ */
+void sort_array(void *base, int n, size_t size, sort_comp_func comp, const void *ctx, bool stable)
+{
+    if (n < 2)
+        return;
 
-        if (z1 > z2)
-            return FALSE;
+    sort_work_type tmp_work;
+    sort_work_type *w = &tmp_work;
+    w->base = (byte *)base;
+    w->size = size;
+    w->comp = comp;
+    w->ctx = ctx;
+    if (stable) {
+        byte *tmp;
+        C_MAKE(tmp, (n / 2 + 1) * size, byte);
+        merge_sort(w, tmp, 0, n - 1);
+        C_KILL(tmp, (n / 2 + 1) * size, byte);
+        return;
     }
 
-    /* Sort by monster experience */
-    if (*why >= 1) {
-        /* Extract experience */
-        z1 = a_info[w1].level;
-        z2 = a_info[w2].level;
+    int depth = 0;
+    for (int i = n; i > 1; i >>= 1)
+        depth += 2;
+
+    intro_sort(w, 0, n - 1, depth);
+}
 
-        /* Compare experience */
-        if (z1 < z2)
-            return TRUE;
+static int compare_sort_keys(const void *a, const void *b, const void *ctx)
+{
+    /* Unused */
+    (void)ctx;
 
-        if (z1 > z2)
-            return FALSE;
+    const sort_key_type *ka = (const sort_key_type *)a;
+    const sort_key_type *kb = (const sort_key_type *)b;
+    for (int i = 0; i < SORT_KEY_MAX; i++) {
+        if (ka->key[i] != kb->key[i])
+            return (ka->key[i] < kb->key[i]) ? -1 : 1;
     }
 
-    /* Compare indexes */
-    return (w1 <= w2);
+    return (ka->idx < kb->idx) ? -1 : (ka->idx > kb->idx);
 }
 
-/*
- * Sorting hook -- Swap function -- see below
- *
- * We use "u" to point to array of monster indexes,
- * and "v" to select the type of sorting to perform.
+/*!
+ * @brief 事前計算キーの配列をソートする / Sort precomputed keys
+ * @param keys キー配列
+ * @param n 要素数
+ * @return なし
+ * @details idxが一意であれば全順序になるので、安定ソートにする必要はない
  */
-void ang_sort_art_swap(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_keys(sort_key_type *keys, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    u16b *who = (u16b *)(u);
-    u16b holder = who[a];
-    who[a] = who[b];
-    who[b] = holder;
+    sort_array(keys, n, sizeof(sort_key_type), compare_sort_keys, NULL, FALSE);
 }
 
-bool ang_sort_comp_quest_num(player_type *player_ptr, vptr u, vptr v, int a, int b)
+/*!
+ * @brief 添字値そのものをidxとして並べ替えた結果を配列へ書き戻す / Sort and write back index values
+ */
+static void sort_keys_to_index(sort_key_type *keys, IDX *who, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    QUEST_IDX *q_num = (QUEST_IDX *)u;
-    quest_type *qa = &quest[q_num[a]];
-    quest_type *qb = &quest[q_num[b]];
-    return (qa->comptime != qb->comptime) ? (qa->comptime < qb->comptime) : (qa->level <= qb->level);
+    sort_keys(keys, n);
+    for (int i = 0; i < n; i++)
+        who[i] = (IDX)keys[i].idx;
 }
 
-void ang_sort_swap_quest_num(player_type *player_ptr, vptr u, vptr v, int a, int b)
+/*!
+ * @brief 座標リストとプレイヤーとの近似距離(の2倍)を返す / Approximate double distance to the player
+ */
+static s32b pos_double_distance(player_type *player_ptr, POSITION y, POSITION x)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    QUEST_IDX *q_num = (QUEST_IDX *)u;
-    QUEST_IDX tmp = q_num[a];
-    q_num[a] = q_num[b];
-    q_num[b] = tmp;
+    POSITION kx = ABS(x - player_ptr->x);
+    POSITION ky = ABS(y - player_ptr->y);
+    return (kx > ky) ? (kx + kx + ky) : (ky + ky + kx);
 }
 
 /*!
- * @brief ペット入りモンスターボールをソートするための比較関数
- * @param u 所持品配列の参照ポインタ
- * @param v 未使用
- * @param a 所持品ID1
- * @param b 所持品ID2
- * @return 1の方が大であればTRUE
+ * @brief ソート済のキーの順に座標リストを並べ替える / Permute a position list along sorted keys
  */
-bool ang_sort_comp_pet(player_type *player_ptr, vptr u, vptr v, int a, int b)
+static void sort_keys_to_pos_list(sort_key_type *keys, pos_list *plist)
 {
-    /* Unused */
-    (void)v;
-
-    u16b *who = (u16b *)(u);
-
-    int w1 = who[a];
-    int w2 = who[b];
-
-    monster_type *m_ptr1 = &player_ptr->current_floor_ptr->m_list[w1];
-    monster_type *m_ptr2 = &player_ptr->current_floor_ptr->m_list[w2];
-    monster_race *r_ptr1 = &r_info[m_ptr1->r_idx];
-    monster_race *r_ptr2 = &r_info[m_ptr2->r_idx];
-
-    if (m_ptr1->nickname && !m_ptr2->nickname)
-        return TRUE;
-
-    if (m_ptr2->nickname && !m_ptr1->nickname)
-        return FALSE;
-
-    if ((r_ptr1->flags1 & RF1_UNIQUE) && !(r_ptr2->flags1 & RF1_UNIQUE))
-        return TRUE;
-
-    if ((r_ptr2->flags1 & RF1_UNIQUE) && !(r_ptr1->flags1 & RF1_UNIQUE))
-        return FALSE;
-
-    if (r_ptr1->level > r_ptr2->level)
-        return TRUE;
-
-    if (r_ptr2->level > r_ptr1->level)
-        return FALSE;
-
-    if (m_ptr1->hp > m_ptr2->hp)
-        return TRUE;
-
-    if (m_ptr2->hp > m_ptr1->hp)
-        return FALSE;
+    int n = plist->n;
+    POSITION *old_y, *old_x;
+    C_MAKE(old_y, n, POSITION);
+    C_MAKE(old_x, n, POSITION);
+    (void)C_COPY(old_y, plist->y, n, POSITION);
+    (void)C_COPY(old_x, plist->x, n, POSITION);
+    sort_keys(keys, n);
+    for (int i = 0; i < n; i++) {
+        plist->y[i] = old_y[keys[i].idx];
+        plist->x[i] = old_x[keys[i].idx];
+    }
 
-    return w1 <= w2;
+    C_KILL(old_x, n, POSITION);
+    C_KILL(old_y, n, POSITION);
 }
 
 /*!
- * @brief モンスター種族情報を特定の基準によりソートするための比較処理
- * Sorting hook -- Comp function -- see below
- * @param u モンスター種族情報の入れるポインタ
- * @param v 条件基準ID
- * @param a 比較するモンスター種族のID1
- * @param b 比較するモンスター種族のID2
- * @return 2の方が大きければTRUEを返す
- * We use "u" to point to array of monster indexes,
- * and "v" to select the type of sorting to perform on "u".
+ * @brief 座標リストをプレイヤーからの距離順に並べる / Sort grids by distance to the player
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param plist 座標リスト
+ * @return なし
  */
-bool ang_sort_comp_hook(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_pos_by_distance(player_type *player_ptr, pos_list *plist)
 {
-    /* Unused */
-    (void)player_ptr;
+    if (plist->n < 2)
+        return;
 
-    u16b *who = (u16b *)(u);
-    u16b *why = (u16b *)(v);
+    sort_key_type *keys;
+    C_MAKE(keys, plist->n, sort_key_type);
+    for (int i = 0; i < plist->n; i++) {
+        keys[i].key[0] = pos_double_distance(player_ptr, plist->y[i], plist->x[i]);
+        keys[i].idx = i;
+    }
 
-    int w1 = who[a];
-    int w2 = who[b];
+    sort_keys_to_pos_list(keys, plist);
+    C_KILL(keys, plist->n, sort_key_type);
+}
 
-    int z1, z2;
+/*!
+ * @brief 座標リストを重要度順に並べる / Sort grids by importance for targetting
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param plist 座標リスト
+ * @return なし
+ * @details
+ * プレイヤーの位置、見えているモンスター (ユニーク、あやしい影、未知の種族、
+ * 既知なら高レベル、種族IDの大きい順)、アイテム、地形の表示優先度の順に前へ並べ、
+ * 全て等しければ距離の近い順とする。
+ */
+void sort_pos_by_importance(player_type *player_ptr, pos_list *plist)
+{
+    if (plist->n < 2)
+        return;
 
-    /* Sort by player kills */
-    if (*why >= 4) {
-        /* Extract player kills */
-        z1 = r_info[w1].r_pkills;
-        z2 = r_info[w2].r_pkills;
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    sort_key_type *keys;
+    C_MAKE(keys, plist->n, sort_key_type);
+    for (int i = 0; i < plist->n; i++) {
+        POSITION y = plist->y[i];
+        POSITION x = plist->x[i];
+        grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+        monster_type *m_ptr = &floor_ptr->m_list[g_ptr->m_idx];
+        s32b rank = 0;
+        if ((y == player_ptr->y) && (x == player_ptr->x))
+            rank |= 0x10;
+
+        if (g_ptr->m_idx && m_ptr->ml) {
+            monster_race *ap_r_ptr = &r_info[m_ptr->ap_r_idx];
+            rank |= 0x08;
+            if (ap_r_ptr->flags1 & RF1_UNIQUE)
+                rank |= 0x04;
+
+            if (m_ptr->mflag2 & MFLAG2_KAGE)
+                rank |= 0x02;
+
+            if (!ap_r_ptr->r_tkills)
+                rank |= 0x01;
+            else
+                keys[i].key[1] = -ap_r_ptr->level;
+
+            keys[i].key[2] = -m_ptr->ap_r_idx;
+        }
 
-        /* Compare player kills */
-        if (z1 < z2)
-            return TRUE;
-        if (z1 > z2)
-            return FALSE;
+        keys[i].key[0] = -rank;
+        keys[i].key[3] = -((g_ptr->o_idx ? 0x10000 : 0) + f_info[g_ptr->feat].priority);
+        keys[i].key[4] = pos_double_distance(player_ptr, y, x);
+        keys[i].idx = i;
     }
 
-    /* Sort by total kills */
-    if (*why >= 3) {
-        /* Extract total kills */
-        z1 = r_info[w1].r_tkills;
-        z2 = r_info[w2].r_tkills;
-
-        /* Compare total kills */
-        if (z1 < z2)
-            return TRUE;
-        if (z1 > z2)
-            return FALSE;
-    }
+    sort_keys_to_pos_list(keys, plist);
+    C_KILL(keys, plist->n, sort_key_type);
+}
 
-    /* Sort by monster level */
-    if (*why >= 2) {
-        /* Extract levels */
-        z1 = r_info[w1].level;
-        z2 = r_info[w2].level;
-
-        /* Compare levels */
-        if (z1 < z2)
-            return TRUE;
-        if (z1 > z2)
-            return FALSE;
-    }
+/*!
+ * @brief 固定アーティファクトIDを並べる / Sort artifact indexes
+ * @param who 固定アーティファクトIDの配列
+ * @param n 要素数
+ * @param why 比較基準 (3以上でtval、2以上でsval、1以上でレベル、最後にID)
+ * @return なし
+ */
+void sort_art_index(ARTIFACT_IDX *who, int n, int why)
+{
+    if (n < 2)
+        return;
 
-    /* Sort by monster experience */
-    if (*why >= 1) {
-        /* Extract experience */
-        z1 = r_info[w1].mexp;
-        z2 = r_info[w2].mexp;
-
-        /* Compare experience */
-        if (z1 < z2)
-            return TRUE;
-        if (z1 > z2)
-            return FALSE;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        artifact_type *a_ptr = &a_info[who[i]];
+        keys[i].key[0] = (why >= 3) ? a_ptr->tval : 0;
+        keys[i].key[1] = (why >= 2) ? a_ptr->sval : 0;
+        keys[i].key[2] = (why >= 1) ? a_ptr->level : 0;
+        keys[i].idx = who[i];
     }
 
-    /* Compare indexes */
-    return (w1 <= w2);
+    sort_keys_to_index(keys, who, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
 /*!
- * @brief モンスター種族情報を特定の基準によりソートするためのスワップ処理
- * Sorting hook -- Swap function -- see below
- * @param u モンスター種族情報の入れるポインタ
- * @param v 未使用
- * @param a スワップするモンスター種族のID1
- * @param b スワップするモンスター種族のID2
+ * @brief クエストIDを達成時刻順に並べる / Sort quest numbers by completion time
+ * @param q_num クエストIDの配列
+ * @param n 要素数
  * @return なし
- * @details
- * We use "u" to point to array of monster indexes,
- * and "v" to select the type of sorting to perform.
  */
-void ang_sort_swap_hook(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_quest_num(QUEST_IDX *q_num, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
+    if (n < 2)
+        return;
 
-    u16b *who = (u16b *)(u);
-    u16b holder;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        quest_type *q_ptr = &quest[q_num[i]];
+        keys[i].key[0] = (s32b)q_ptr->comptime;
+        keys[i].key[1] = q_ptr->level;
+        keys[i].idx = q_num[i];
+    }
 
-    holder = who[a];
-    who[a] = who[b];
-    who[b] = holder;
+    sort_keys_to_index(keys, q_num, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
-/*
- * hook function to sort monsters by level
+/*!
+ * @brief ペットを捕獲の候補順に並べる / Sort pets for capturing into a monster ball
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param who モンスターIDの配列
+ * @param n 要素数
+ * @return なし
+ * @details 名前付き、ユニーク、高レベル、HPの多い順
  */
-bool ang_sort_comp_monster_level(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_pet_index(player_type *player_ptr, MONSTER_IDX *who, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    u16b *who = (u16b *)(u);
-
-    int w1 = who[a];
-    int w2 = who[b];
-
-    monster_race *r_ptr1 = &r_info[w1];
-    monster_race *r_ptr2 = &r_info[w2];
-
-    if (r_ptr2->level > r_ptr1->level)
-        return TRUE;
-
-    if (r_ptr1->level > r_ptr2->level)
-        return FALSE;
-
-    if ((r_ptr2->flags1 & RF1_UNIQUE) && !(r_ptr1->flags1 & RF1_UNIQUE))
-        return TRUE;
+    if (n < 2)
+        return;
 
-    if ((r_ptr1->flags1 & RF1_UNIQUE) && !(r_ptr2->flags1 & RF1_UNIQUE))
-        return FALSE;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        monster_type *m_ptr = &player_ptr->current_floor_ptr->m_list[who[i]];
+        monster_race *r_ptr = &r_info[m_ptr->r_idx];
+        s32b rank = 0;
+        if (m_ptr->nickname)
+            rank |= 0x02;
+
+        if (r_ptr->flags1 & RF1_UNIQUE)
+            rank |= 0x01;
+
+        keys[i].key[0] = -rank;
+        keys[i].key[1] = -r_ptr->level;
+        keys[i].key[2] = -m_ptr->hp;
+        keys[i].idx = who[i];
+    }
 
-    return w1 <= w2;
+    sort_keys_to_index(keys, who, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
 /*!
- * @brief ペットになっているモンスターをソートするための比較処理
- * @param u モンスターの構造体配列
- * @param v 未使用
- * @param a 比較対象のモンスターID1
- * @param b 比較対象のモンスターID2
- * @return 2番目が大ならばTRUEを返す
+ * @brief ペットを解放の候補順に並べる / Sort pets for dismissal
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param who モンスターIDの配列
+ * @param n 要素数
+ * @return なし
+ * @details 騎乗中、名前付き、親なし、ユニーク、高レベル、HPの多い順
  */
-bool ang_sort_comp_pet_dismiss(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_pet_dismiss_index(player_type *player_ptr, MONSTER_IDX *who, int n)
 {
-    /* Unused */
-    (void)v;
-
-    u16b *who = (u16b *)(u);
-
-    int w1 = who[a];
-    int w2 = who[b];
-
-    monster_type *m_ptr1 = &player_ptr->current_floor_ptr->m_list[w1];
-    monster_type *m_ptr2 = &player_ptr->current_floor_ptr->m_list[w2];
-    monster_race *r_ptr1 = &r_info[m_ptr1->r_idx];
-    monster_race *r_ptr2 = &r_info[m_ptr2->r_idx];
-
-    if (w1 == player_ptr->riding)
-        return TRUE;
-
-    if (w2 == player_ptr->riding)
-        return FALSE;
-
-    if (m_ptr1->nickname && !m_ptr2->nickname)
-        return TRUE;
-
-    if (m_ptr2->nickname && !m_ptr1->nickname)
-        return FALSE;
-
-    if (!m_ptr1->parent_m_idx && m_ptr2->parent_m_idx)
-        return TRUE;
-
-    if (!m_ptr2->parent_m_idx && m_ptr1->parent_m_idx)
-        return FALSE;
-
-    if ((r_ptr1->flags1 & RF1_UNIQUE) && !(r_ptr2->flags1 & RF1_UNIQUE))
-        return TRUE;
+    if (n < 2)
+        return;
 
-    if ((r_ptr2->flags1 & RF1_UNIQUE) && !(r_ptr1->flags1 & RF1_UNIQUE))
-        return FALSE;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        monster_type *m_ptr = &player_ptr->current_floor_ptr->m_list[who[i]];
+        monster_race *r_ptr = &r_info[m_ptr->r_idx];
+        s32b rank = 0;
+        if (who[i] == player_ptr->riding)
+            rank |= 0x08;
 
-    if (r_ptr1->level > r_ptr2->level)
-        return TRUE;
+        if (m_ptr->nickname)
+            rank |= 0x04;
 
-    if (r_ptr2->level > r_ptr1->level)
-        return FALSE;
+        if (!m_ptr->parent_m_idx)
+            rank |= 0x02;
 
-    if (m_ptr1->hp > m_ptr2->hp)
-        return TRUE;
+        if (r_ptr->flags1 & RF1_UNIQUE)
+            rank |= 0x01;
 
-    if (m_ptr2->hp > m_ptr1->hp)
-        return FALSE;
+        keys[i].key[0] = -rank;
+        keys[i].key[1] = -r_ptr->level;
+        keys[i].key[2] = -m_ptr->hp;
+        keys[i].idx = who[i];
+    }
 
-    return w1 <= w2;
+    sort_keys_to_index(keys, who, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
 /*!
- * @brief フロア保存時のgrid情報テンプレートをソートするための比較処理
- * @param u gridテンプレートの参照ポインタ
- * @param v 未使用
- * @param a スワップするモンスター種族のID1
- * @param b スワップするモンスター種族のID2
- * @return aの方が大きければtrue
+ * @brief モンスター種族IDを思い出の基準で並べる / Sort monster race indexes
+ * @param who モンスター種族IDの配列
+ * @param n 要素数
+ * @param why 比較基準 (4以上で今回の殺害数、3以上で全殺害数、2以上でレベル、1以上で経験値、最後にID)
+ * @return なし
  */
-bool ang_sort_comp_cave_temp(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_race_index(MONRACE_IDX *who, int n, int why)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
-
-    grid_template_type *who = (grid_template_type *)(u);
+    if (n < 2)
+        return;
 
-    u16b o1 = who[a].occurrence;
-    u16b o2 = who[b].occurrence;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        monster_race *r_ptr = &r_info[who[i]];
+        keys[i].key[0] = (why >= 4) ? r_ptr->r_pkills : 0;
+        keys[i].key[1] = (why >= 3) ? r_ptr->r_tkills : 0;
+        keys[i].key[2] = (why >= 2) ? r_ptr->level : 0;
+        keys[i].key[3] = (why >= 1) ? r_ptr->mexp : 0;
+        keys[i].idx = who[i];
+    }
 
-    return o2 <= o1;
+    sort_keys_to_index(keys, who, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
 /*!
- * @brief フロア保存時のgrid情報テンプレートをソートするためのスワップ処理 / Sorting hook -- Swap function
- * @param u gridテンプレートの参照ポインタ
- * @param v 未使用
- * @param a スワップするモンスター種族のID1
- * @param b スワップするモンスター種族のID2
+ * @brief モンスター種族IDをレベル順に並べる / Sort monster race indexes by level
+ * @param who モンスター種族IDの配列
+ * @param n 要素数
  * @return なし
+ * @details 低レベル、非ユニーク、IDの小さい順
  */
-void ang_sort_swap_cave_temp(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_race_index_by_level(MONRACE_IDX *who, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
+    if (n < 2)
+        return;
 
-    grid_template_type *who = (grid_template_type *)(u);
-    grid_template_type holder;
+    sort_key_type *keys;
+    C_MAKE(keys, n, sort_key_type);
+    for (int i = 0; i < n; i++) {
+        monster_race *r_ptr = &r_info[who[i]];
+        keys[i].key[0] = r_ptr->level;
+        keys[i].key[1] = (r_ptr->flags1 & RF1_UNIQUE) ? 1 : 0;
+        keys[i].idx = who[i];
+    }
 
-    holder = who[a];
-    who[a] = who[b];
-    who[b] = holder;
+    sort_keys_to_index(keys, who, n);
+    C_KILL(keys, n, sort_key_type);
 }
 
-/*!
- * @brief 進化ツリーをソートするためモンスター種族の判定関数 /
- * Sorting hook -- Comp function
- * @param u 進化木構造データ
- * @param v 未使用
- * @param a 比較したいモンスター種族ID1
- * @param b 比較したいモンスター種族ID2
- * @return 2が大きければTRUEを返す
- */
-bool ang_sort_comp_evol_tree(player_type *player_ptr, vptr u, vptr v, int a, int b)
+static int compare_grid_templates(const void *a, const void *b, const void *ctx)
 {
     /* Unused */
-    (void)player_ptr;
-    (void)v;
+    (void)ctx;
 
-    int **evol_tree = (int **)u;
-
-    int w1 = evol_tree[a][0];
-    int w2 = evol_tree[b][0];
-    monster_race *r1_ptr = &r_info[w1];
-    monster_race *r2_ptr = &r_info[w2];
-
-    /* Used tree first */
-    if (w1 && !w2)
-        return TRUE;
-
-    if (!w1 && w2)
-        return FALSE;
+    u16b o1 = ((const grid_template_type *)a)->occurrence;
+    u16b o2 = ((const grid_template_type *)b)->occurrence;
+    return (o1 > o2) ? -1 : (o1 < o2);
+}
 
-    /* Sort by monster level */
-    if (r1_ptr->level < r2_ptr->level)
-        return TRUE;
+/*!
+ * @brief フロア保存時のgrid情報テンプレートを出現数の多い順に並べる / Sort grid templates by occurrence
+ * @param templates gridテンプレートの配列
+ * @param n 要素数
+ * @return なし
+ * @details 安定ソートなので、同数のテンプレートはフロア上の出現順を保つ
+ */
+void sort_grid_templates(grid_template_type *templates, int n)
+{
+    sort_array(templates, n, sizeof(grid_template_type), compare_grid_templates, NULL, TRUE);
+}
 
-    if (r1_ptr->level > r2_ptr->level)
-        return FALSE;
+/*!
+ * @brief 進化ツリーを並べる / Sort evolution trees
+ * @param evol_tree 進化木構造データ
+ * @param n 要素数
+ * @return なし
+ * @details 使用中の木、根の種族の低レベル、低経験値、IDの小さい順
+ */
+void sort_evol_tree(int **evol_tree, int n)
+{
+    if (n < 2)
+        return;
 
-    /* Sort by monster experience */
-    if (r1_ptr->mexp < r2_ptr->mexp)
-        return TRUE;
+    sort_key_type *keys;
+    int **old_tree;
+    C_MAKE(keys, n, sort_key_type);
+    C_MAKE(old_tree, n, int *);
+    for (int i = 0; i < n; i++) {
+        int r_idx = evol_tree[i][0];
+        monster_race *r_ptr = &r_info[r_idx];
+        keys[i].key[0] = r_idx ? 0 : 1;
+        keys[i].key[1] = r_ptr->level;
+        keys[i].key[2] = r_ptr->mexp;
+        keys[i].key[3] = r_idx;
+        keys[i].idx = i;
+        old_tree[i] = evol_tree[i];
+    }
 
-    if (r1_ptr->mexp > r2_ptr->mexp)
-        return FALSE;
+    sort_keys(keys, n);
+    for (int i = 0; i < n; i++)
+        evol_tree[i] = old_tree[keys[i].idx];
 
-    /* Compare indexes */
-    return w1 <= w2;
+    C_KILL(old_tree, n, int *);
+    C_KILL(keys, n, sort_key_type);
 }
 
 /*!
- * @brief 進化ツリーをソートするため木構造のスワップ関数 /
- * Sorting hook -- Swap function
- * @param u 進化木構造データ
- * @param v 未使用
- * @param a スワップしたい木構造1
- * @param b スワップしたい木構造2
- * @return 2が大きければTRUEを返す
+ * @brief nestのモンスターリストを並べる / Sort nest monster information
+ * @param nest_mon_info nestのモンスター情報配列
+ * @param n 要素数
+ * @return なし
+ * @details 配置済、低レベル、低経験値、IDの小さい順
  */
-void ang_sort_swap_evol_tree(player_type *player_ptr, vptr u, vptr v, int a, int b)
+void sort_nest_mon_info(nest_mon_info_type *nest_mon_info, int n)
 {
-    /* Unused */
-    (void)player_ptr;
-    (void)v;
+    if (n < 2)
+        return;
+
+    sort_key_type *keys;
+    nest_mon_info_type *old_info;
+    C_MAKE(keys, n, sort_key_type);
+    C_MAKE(old_info, n, nest_mon_info_type);
+    for (int i = 0; i < n; i++) {
+        monster_race *r_ptr = &r_info[nest_mon_info[i].r_idx];
+        keys[i].key[0] = nest_mon_info[i].used ? 0 : 1;
+        keys[i].key[1] = r_ptr->level;
+        keys[i].key[2] = r_ptr->mexp;
+        keys[i].key[3] = nest_mon_info[i].r_idx;
+        keys[i].idx = i;
+        old_info[i] = nest_mon_info[i];
+    }
 
-    int **evol_tree = (int **)u;
-    int *holder;
+    sort_keys(keys, n);
+    for (int i = 0; i < n; i++)
+        nest_mon_info[i] = old_info[keys[i].idx];
 
-    holder = evol_tree[a];
-    evol_tree[a] = evol_tree[b];
-    evol_tree[b] = holder;
+    C_KILL(old_info, n, nest_mon_info_type);
+    C_KILL(keys, n, sort_key_type);
 }
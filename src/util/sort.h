@@ -1,30 +1,44 @@
 ﻿#pragma once
 
 #include "system/angband.h"
-
-void ang_sort(player_type *player_ptr, vptr u, vptr v, int n, bool (*ang_sort_comp)(player_type *, vptr, vptr, int, int),
-    void (*ang_sort_swap)(player_type *, vptr, vptr, int, int));
-
-bool ang_sort_comp_distance(player_type *player_ptr, vptr u, vptr v, int a, int b);
-bool ang_sort_comp_importance(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_distance(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_art_comp(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_art_swap(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_quest_num(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_quest_num(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_pet(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_hook(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_hook(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_monster_level(player_type *player_ptr, vptr u, vptr v, int a, int b);
-bool ang_sort_comp_pet_dismiss(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_cave_temp(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_cave_temp(player_type *player_ptr, vptr u, vptr v, int a, int b);
-
-bool ang_sort_comp_evol_tree(player_type *player_ptr, vptr u, vptr v, int a, int b);
-void ang_sort_swap_evol_tree(player_type *player_ptr, vptr u, vptr v, int a, int b);
+#include "floor/geometry.h"
+
+typedef struct grid_template_type grid_template_type;
+typedef struct nest_mon_info_type nest_mon_info_type;
+
+/*!
+ * @brief 汎用ソートの比較関数型 / Comparison hook for sort_array()
+ * @param a 比較対象の要素1への参照ポインタ
+ * @param b 比較対象の要素2への参照ポインタ
+ * @param ctx 呼び出し元から渡される付随情報
+ * @return aを先に並べるなら負、同順なら0、bを先に並べるなら正
+ */
+typedef int (*sort_comp_func)(const void *a, const void *b, const void *ctx);
+
+#define SORT_KEY_MAX 5 /*!< 事前計算キーの最大段数 */
+
+/*!
+ * @brief 事前計算済みキーによる添字ソートの要素 / An entry for sorting indexes by precomputed keys
+ * @details key[0]から順に昇順で比較し、全て等しければidxの昇順とする。
+ * 降順に並べたいキーは符号を反転して格納する。
+ */
+typedef struct sort_key_type {
+    s32b key[SORT_KEY_MAX];
+    int idx;
+} sort_key_type;
+
+void sort_array(void *base, int n, size_t size, sort_comp_func comp, const void *ctx, bool stable);
+void sort_keys(sort_key_type *keys, int n);
+
+void sort_pos_by_distance(player_type *player_ptr, pos_list *plist);
+void sort_pos_by_importance(player_type *player_ptr, pos_list *plist);
+
+void sort_art_index(ARTIFACT_IDX *who, int n, int why);
+void sort_quest_num(QUEST_IDX *q_num, int n);
+void sort_pet_index(player_type *player_ptr, MONSTER_IDX *who, int n);
+void sort_pet_dismiss_index(player_type *player_ptr, MONSTER_IDX *who, int n);
+void sort_race_index(MONRACE_IDX *who, int n, int why);
+void sort_race_index_by_level(MONRACE_IDX *who, int n);
+void sort_grid_templates(grid_template_type *templates, int n);
+void sort_evol_tree(int **evol_tree, int n);
+void sort_nest_mon_info(nest_mon_info_type *nest_mon_info, int n);
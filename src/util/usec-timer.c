@@ -0,0 +1,32 @@
+﻿/*!
+ * @brief 処理時間計測用の時計 / Wall clock for measuring elapsed time
+ * @date 2026/10/19
+ */
+
+#include "util/usec-timer.h"
+
+#ifdef WINDOWS
+#include <windows.h>
+#else
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#endif
+
+/*!
+ * @brief 現在時刻をマイクロ秒単位で返す / Get the current time in microseconds
+ * @return 任意の起点からの経過時間
+ */
+double get_usec_time(void)
+{
+#ifdef WINDOWS
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart * 1000000.0 / (double)freq.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec * 1000000.0 + (double)tv.tv_usec;
+#endif
+}
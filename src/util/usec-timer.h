@@ -0,0 +1,5 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+double get_usec_time(void);
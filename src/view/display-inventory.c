@@ -13,6 +13,7 @@
 #include "term/gameterm.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
+#include "window/item-line-cache.h"
 
 /*!
  * @brief 所持アイテムの表示を行う /
@@ -125,6 +126,7 @@ COMMAND_CODE show_inventory(player_type *owner_ptr, int target_item, BIT_FLAGS m
  * @brief 所持アイテム一覧を表示する /
  * Choice window "shadow" of the "show_inven()" function
  * @return なし
+ * @details 前回から表示内容が変わった行だけを描き直す。
  */
 void display_inventory(player_type *owner_ptr, tval_type tval)
 {
@@ -132,6 +134,7 @@ void display_inventory(player_type *owner_ptr, tval_type tval)
     object_type *o_ptr;
     TERM_COLOR attr = TERM_WHITE;
     char tmp_val[80];
+    char wgt_val[80];
     GAME_TEXT o_name[MAX_NLEN];
     TERM_LEN wid, hgt;
 
@@ -139,6 +142,7 @@ void display_inventory(player_type *owner_ptr, tval_type tval)
         return;
 
     term_get_size(&wid, &hgt);
+    item_line_memo *memo = get_item_line_memo(ITEM_LINE_INVEN);
     for (i = 0; i < INVEN_PACK; i++) {
         o_ptr = &owner_ptr->inventory_list[i];
         if (!o_ptr->k_idx)
@@ -149,29 +153,36 @@ void display_inventory(player_type *owner_ptr, tval_type tval)
     for (i = 0; i < z; i++) {
         o_ptr = &owner_ptr->inventory_list[i];
         tmp_val[0] = tmp_val[1] = tmp_val[2] = ' ';
+        tmp_val[3] = '\0';
         if (item_tester_okay(owner_ptr, o_ptr, tval)) {
             tmp_val[0] = index_to_label(i);
             tmp_val[1] = ')';
         }
 
-        term_putstr(0, i, 3, TERM_WHITE, tmp_val);
         describe_flavor(owner_ptr, o_name, o_ptr, 0);
-        n = strlen(o_name);
         attr = tval_to_attr[o_ptr->tval % 128];
         if (o_ptr->timeout) {
             attr = TERM_L_DARK;
         }
 
-        term_putstr(3, i, n, attr, o_name);
-        term_erase(3 + n, i, 255);
-
         if (show_weights) {
             int wgt = o_ptr->weight * o_ptr->number;
-            sprintf(tmp_val, _("%3d.%1d kg", "%3d.%1d lb"), _(lbtokg1(wgt), wgt / 10), _(lbtokg2(wgt), wgt % 10));
-            prt(tmp_val, i, wid - 9);
+            sprintf(wgt_val, _("%3d.%1d kg", "%3d.%1d lb"), _(lbtokg1(wgt), wgt / 10), _(lbtokg2(wgt), wgt % 10));
         }
+
+        if (!is_item_line_changed(memo, i, tmp_val, attr, o_name, show_weights ? wgt_val : NULL, NULL))
+            continue;
+
+        term_putstr(0, i, 3, TERM_WHITE, tmp_val);
+        n = strlen(o_name);
+        term_putstr(3, i, n, attr, o_name);
+        term_erase(3 + n, i, 255);
+        if (show_weights)
+            prt(wgt_val, i, wid - 9);
     }
 
-    for (i = z; i < hgt; i++)
-        term_erase(0, i, 255);
+    for (i = z; i < hgt; i++) {
+        if (is_item_blank_line_changed(memo, i))
+            term_erase(0, i, 255);
+    }
 }
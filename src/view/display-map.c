@@ -199,7 +199,7 @@ void map_info(player_type *player_ptr, POSITION y, POSITION x, TERM_COLOR *ap, S
         if (display_autopick) {
             byte act;
 
-            match_autopick = find_autopick_list(player_ptr, o_ptr);
+            match_autopick = find_autopick_list_cached(player_ptr, o_ptr);
             if (match_autopick == -1)
                 continue;
 
@@ -30,11 +30,36 @@ u32b *message__ptr;
 /* The array of chars, by offset [MESSAGE_BUF] */
 char *message__buf;
 
+/* The array of text hashes, by index [MESSAGE_MAX] */
+u32b *message__hash;
+
 /* Used in msg_print() for "buffering" */
 bool msg_flag;
 
 COMMAND_CODE now_message;
 
+/* Nesting depth of msg_batch_begin() */
+static int msg_batch_depth;
+
+/* A message was printed in the batch and the screen is not updated yet */
+static bool msg_batch_dirty;
+
+/*!
+ * @brief メッセージの重複を探すためのハッシュ値を計算する / Hash of a message text
+ * @param str メッセージ
+ * @return ハッシュ値
+ */
+static u32b calc_message_hash(concptr str)
+{
+    u32b hash = 2166136261UL;
+    for (; *str; str++) {
+        hash ^= (byte)*str;
+        hash *= 16777619UL;
+    }
+
+    return hash & 0xFFFFFFFFUL;
+}
+
 /*!
  * @brief 保存中の過去ゲームメッセージの数を返す。 / How many messages are "available"?
  * @return 残っているメッセージの数
@@ -166,6 +191,7 @@ void message_add(concptr str)
         break;
     }
 
+    u32b hash = calc_message_hash(str);
     for (i = message__next; k; k--) {
         int q;
         concptr old;
@@ -176,6 +202,9 @@ void message_add(concptr str)
         if (i == message__last)
             break;
 
+        if (message__hash[i] != hash)
+            continue;
+
         q = (message__head + MESSAGE_BUF - message__ptr[i]) % MESSAGE_BUF;
 
         if (q > MESSAGE_BUF / 2)
@@ -194,6 +223,7 @@ void message_add(concptr str)
             message__last = 0;
 
         message__ptr[x] = message__ptr[i];
+        message__hash[x] = hash;
         if (splitted2 != NULL) {
             message_add(splitted2);
         }
@@ -243,6 +273,7 @@ void message_add(concptr str)
         message__last = 0;
 
     message__ptr[x] = message__head;
+    message__hash[x] = hash;
     for (i = 0; i < n; i++) {
         message__buf[message__head + i] = str[i];
     }
@@ -255,12 +286,27 @@ void message_add(concptr str)
     }
 }
 
+/*!
+ * @brief まとめて表示中のメッセージに伴う画面の更新を行う / Catch the screen up with the messages printed in a batch
+ * @return なし
+ */
+static void update_msg_batch(void)
+{
+    msg_batch_dirty = FALSE;
+    update_output(p_ptr);
+    if (fresh_message)
+        term_fresh();
+}
+
 /*
  * Hack -- flush
  */
 static void msg_flush(player_type *player_ptr, int x)
 {
     byte a = TERM_L_BLUE;
+    if (msg_batch_dirty)
+        update_msg_batch();
+
     bool nagasu = FALSE;
     if ((auto_more && !player_ptr->now_damaged) || num_more < 0) {
         int i;
@@ -412,7 +458,10 @@ void msg_print(concptr msg)
 
     term_putstr(p, 0, n, TERM_WHITE, t);
     p_ptr->window |= (PW_MESSAGE);
-    update_output(p_ptr);
+    if (msg_batch_depth)
+        msg_batch_dirty = TRUE;
+    else
+        update_output(p_ptr);
 
     msg_flag = TRUE;
 #ifdef JP
@@ -421,10 +470,33 @@ void msg_print(concptr msg)
     p += n + 1;
 #endif
 
-    if (fresh_message)
+    if (fresh_message && !msg_batch_depth)
         term_fresh();
 }
 
+/*!
+ * @brief メッセージをまとめて表示し始める / Begin a batch of messages
+ * @return なし
+ * @details
+ * msg_batch_end() までの間、msg_print() は1件ごとの画面とサブウィンドウの更新を行わず、
+ * 最後にまとめて1度だけ行う。-more- で入力を待つ前には必ず更新する。
+ * 範囲魔法が多数のモンスターに当たった時や、打撃が続く時に使う。
+ */
+void msg_batch_begin(void) { msg_batch_depth++; }
+
+/*!
+ * @brief メッセージをまとめて表示し終える / End a batch of messages
+ * @return なし
+ */
+void msg_batch_end(void)
+{
+    if (--msg_batch_depth > 0)
+        return;
+
+    if (msg_batch_dirty)
+        update_msg_batch();
+}
+
 /*
  * Display a formatted message, using "vstrnfmt()" and "msg_print()".
  */
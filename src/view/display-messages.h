@@ -21,6 +21,7 @@ extern u32b message__head;
 extern u32b message__tail;
 extern u32b *message__ptr;
 extern char *message__buf;
+extern u32b *message__hash;
 
 extern bool msg_flag;
 extern COMMAND_CODE now_message;
@@ -31,3 +32,5 @@ void message_add(concptr msg);
 void msg_erase(void);
 void msg_print(concptr msg);
 void msg_format(concptr fmt, ...);
+void msg_batch_begin(void);
+void msg_batch_end(void);
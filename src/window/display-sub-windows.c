@@ -1,4 +1,5 @@
 ﻿#include "window/display-sub-windows.h"
+#include "core/turn-profiler.h"
 #include "core/window-redrawer.h"
 #include "flavor/flavor-describer.h"
 #include "floor/cave.h"
@@ -30,8 +31,10 @@
 #include "view/display-messages.h"
 #include "view/display-player.h"
 #include "view/object-describer.h"
+#include "window/item-line-cache.h"
 #include "window/main-window-equipments.h"
 #include "window/main-window-util.h"
+#include "window/overhead-map.h"
 #include "world/world.h"
 
 /*!
@@ -194,6 +197,7 @@ void fix_monster_list(player_type *player_ptr)
  * @brief 装備アイテム一覧を表示する /
  * Choice window "shadow" of the "show_equip()" function
  * @return なし
+ * @details 前回から表示内容が変わった行だけを描き直す。
  */
 static void display_equipment(player_type *owner_ptr, tval_type tval)
 {
@@ -202,20 +206,22 @@ static void display_equipment(player_type *owner_ptr, tval_type tval)
 
     TERM_LEN wid, hgt;
     term_get_size(&wid, &hgt);
+    item_line_memo *memo = get_item_line_memo(ITEM_LINE_EQUIP);
 
     TERM_COLOR attr = TERM_WHITE;
     char tmp_val[80];
+    char wgt_val[80];
     GAME_TEXT o_name[MAX_NLEN];
     for (inventory_slot_type i = INVEN_RARM; i < INVEN_TOTAL; i++) {
         object_type *o_ptr;
         o_ptr = &owner_ptr->inventory_list[i];
         tmp_val[0] = tmp_val[1] = tmp_val[2] = ' ';
+        tmp_val[3] = '\0';
         if (owner_ptr->select_ring_slot ? is_ring_slot(i) : item_tester_okay(owner_ptr, o_ptr, tval)) {
             tmp_val[0] = index_to_label(i);
             tmp_val[1] = ')';
         }
 
-        term_putstr(0, i - INVEN_RARM, 3, TERM_WHITE, tmp_val);
         if ((((i == INVEN_RARM) && has_left_hand_weapon(owner_ptr)) || ((i == INVEN_LARM) && has_right_hand_weapon(owner_ptr))) && has_two_handed_weapons(owner_ptr)) {
             strcpy(o_name, _("(武器を両手持ち)", "(wielding with two-hands)"));
             attr = TERM_WHITE;
@@ -224,26 +230,35 @@ static void display_equipment(player_type *owner_ptr, tval_type tval)
             attr = tval_to_attr[o_ptr->tval % 128];
         }
 
-        int n = strlen(o_name);
         if (o_ptr->timeout)
             attr = TERM_L_DARK;
 
-        term_putstr(3, i - INVEN_RARM, n, attr, o_name);
-        term_erase(3 + n, i - INVEN_RARM, 255);
         if (show_weights) {
             int wgt = o_ptr->weight * o_ptr->number;
-            sprintf(tmp_val, _("%3d.%1d kg", "%3d.%1d lb"), _(lbtokg1(wgt), wgt / 10), _(lbtokg2(wgt), wgt % 10));
-            prt(tmp_val, i - INVEN_RARM, wid - (show_labels ? 28 : 9));
+            sprintf(wgt_val, _("%3d.%1d kg", "%3d.%1d lb"), _(lbtokg1(wgt), wgt / 10), _(lbtokg2(wgt), wgt % 10));
         }
 
+        concptr mention = show_labels ? mention_use(owner_ptr, i) : NULL;
+        if (!is_item_line_changed(memo, i - INVEN_RARM, tmp_val, attr, o_name, show_weights ? wgt_val : NULL, mention))
+            continue;
+
+        term_putstr(0, i - INVEN_RARM, 3, TERM_WHITE, tmp_val);
+        int n = strlen(o_name);
+        term_putstr(3, i - INVEN_RARM, n, attr, o_name);
+        term_erase(3 + n, i - INVEN_RARM, 255);
+        if (show_weights)
+            prt(wgt_val, i - INVEN_RARM, wid - (show_labels ? 28 : 9));
+
         if (show_labels) {
             term_putstr(wid - 20, i - INVEN_RARM, -1, TERM_WHITE, " <-- ");
-            prt(mention_use(owner_ptr, i), i - INVEN_RARM, wid - 15);
+            prt(mention, i - INVEN_RARM, wid - 15);
         }
     }
 
-    for (int i = INVEN_TOTAL - INVEN_RARM; i < hgt; i++)
-        term_erase(0, i, 255);
+    for (int i = INVEN_TOTAL - INVEN_RARM; i < hgt; i++) {
+        if (is_item_blank_line_changed(memo, i))
+            term_erase(0, i, 255);
+    }
 }
 
 /*!
@@ -331,28 +346,36 @@ void fix_message(void)
  * @return なし
  * @details
  * Note that the "player" symbol does NOT appear on the map.
+ * 縮小マップはサブウィンドウごとに保持し、前回の表示以降に変わったグリッドの周りだけを描き直す。
  */
 void fix_overhead(player_type *player_ptr)
 {
+    static overhead_map_type *overhead_maps[8];
     for (int j = 0; j < 8; j++) {
         term_type *old = Term;
         TERM_LEN wid, hgt;
-        if (!angband_term[j])
-            continue;
+        if (!overhead_maps[j])
+            overhead_maps[j] = make_overhead_map();
 
-        if (!(window_flag[j] & (PW_OVERHEAD)))
+        if (!angband_term[j] || !(window_flag[j] & (PW_OVERHEAD))) {
+            forget_overhead_map(overhead_maps[j]);
             continue;
+        }
 
         term_activate(angband_term[j]);
         term_get_size(&wid, &hgt);
         if (wid > COL_MAP + 2 && hgt > ROW_MAP + 2) {
             int cy, cx;
-            display_map(player_ptr, &cy, &cx);
+            draw_overhead_map(player_ptr, overhead_maps[j], &cy, &cx);
             term_fresh();
+        } else {
+            forget_overhead_map(overhead_maps[j]);
         }
 
         term_activate(old);
     }
+
+    flush_overhead_map_changes();
 }
 
 static void display_dungeon(player_type *player_ptr)
@@ -461,6 +484,38 @@ void fix_object(player_type *player_ptr)
     }
 }
 
+#ifdef TURN_PROFILER
+/*!
+ * @brief ターン処理の計測結果をサブウィンドウに表示する / Display the turn profile in sub-windows
+ * @return なし
+ */
+void fix_turn_profile(void)
+{
+    for (int j = 0; j < 8; j++) {
+        term_type *old = Term;
+        if (!angband_term[j])
+            continue;
+
+        if (!(window_flag[j] & (PW_TURN_PROFILE)))
+            continue;
+
+        term_activate(angband_term[j]);
+        term_clear();
+        char buf[160];
+        format_turn_profile_summary(buf, sizeof(buf));
+        term_putstr(0, 0, -1, TERM_WHITE, buf);
+        term_putstr(0, 1, -1, TERM_L_BLUE, turn_profile_header);
+        for (int i = 0; i < MAX_TPS; i++) {
+            format_turn_profile_line((turn_profile_section)i, buf, sizeof(buf));
+            term_putstr(0, i + 2, -1, turn_profile.calls[i] ? TERM_WHITE : TERM_SLATE, buf);
+        }
+
+        term_fresh();
+        term_activate(old);
+    }
+}
+#endif
+
 /*!
  * @brief サブウィンドウに所持品、装備品リストの表示を行う /
  * Flip "inven" and "equip" in any sub-windows
@@ -13,4 +13,7 @@ void fix_overhead(player_type *player_ptr);
 void fix_dungeon(player_type *player_ptr);
 void fix_monster(player_type *player_ptr);
 void fix_object(player_type *player_ptr);
+#ifdef TURN_PROFILER
+void fix_turn_profile(void);
+#endif
 void toggle_inventory_equipment(player_type *owner_ptr);
@@ -0,0 +1,125 @@
+﻿/*!
+ * @brief 所持品・装備品サブウィンドウの行キャッシュ / Per-row cache of the inventory and equipment sub-windows
+ * @date 2026/10/19
+ * @details
+ * 端末ごとに各行へ最後に描いた内容を覚えておき、内容が変わった行だけを描き直す。
+ * アイテムの表記は describe_flavor() のキャッシュから得る。
+ * 行の記憶は、その端末に所持品か装備品の一覧しか表示していない時だけ使い、大きさや表示内容が変わったら捨てる。
+ */
+
+#include "window/item-line-cache.h"
+#include "core/window-redrawer.h"
+#include "game-option/option-flags.h"
+#include "term/gameterm.h"
+#include "term/z-form.h"
+#include "util/string-processor.h"
+
+#define ITEM_LINE_MAX_ROWS 64 /*!< 行の内容を覚えておく最大の行数 */
+#define ITEM_LINE_TEXT_MAX (MAX_NLEN + 128) /*!< 覚えておく1行の内容の最大長 */
+
+/*! 端末ごとの行の記憶 */
+struct item_line_memo {
+    term_type *term; /*!< 記憶を作った端末 */
+    item_line_kind kind; /*!< 表示している一覧の種類 (0なら記憶なし) */
+    TERM_LEN wid; /*!< 記憶を作った時の端末の幅 */
+    TERM_LEN hgt; /*!< 記憶を作った時の端末の高さ */
+    bool row_ready[ITEM_LINE_MAX_ROWS]; /*!< 行の内容を覚えているか */
+    char row_text[ITEM_LINE_MAX_ROWS][ITEM_LINE_TEXT_MAX]; /*!< 行に最後に描いた内容 (空行は空文字列) */
+};
+
+static item_line_memo item_line_memos[8]; /*!< 端末ごとの行の記憶 */
+
+/*!
+ * @brief 端末ごとの行の記憶を捨てる / Forget what was drawn on every sub-window
+ * @return なし
+ * @details 端末の表示内容が他の処理で書き換えられたかもしれない時に呼ぶ。
+ */
+void forget_item_line_memos(void)
+{
+    for (int j = 0; j < 8; j++)
+        item_line_memos[j].kind = 0;
+}
+
+/*!
+ * @brief 現在の端末の行の記憶を得る / Get the row memo of the active sub-window
+ * @param kind 表示する一覧の種類
+ * @return 行の記憶への参照ポインタ。記憶を使えない時はNULL
+ * @details
+ * 端末が他の内容も表示している時は、その内容に上書きされうるので記憶を使わない。
+ * 端末の大きさや表示する一覧が記憶を作った時と違う時は、記憶を捨てて作り直す。
+ */
+item_line_memo *get_item_line_memo(item_line_kind kind)
+{
+    for (int j = 0; j < 8; j++) {
+        if (!angband_term[j] || (angband_term[j] != Term))
+            continue;
+
+        item_line_memo *memo = &item_line_memos[j];
+        BIT_FLAGS flag = (kind == ITEM_LINE_INVEN) ? PW_INVEN : PW_EQUIP;
+        if (window_flag[j] != flag) {
+            memo->kind = 0;
+            return NULL;
+        }
+
+        TERM_LEN wid, hgt;
+        term_get_size(&wid, &hgt);
+        if ((memo->kind != kind) || (memo->term != Term) || (memo->wid != wid) || (memo->hgt != hgt)) {
+            memo->term = Term;
+            memo->kind = kind;
+            memo->wid = wid;
+            memo->hgt = hgt;
+            for (int y = 0; y < ITEM_LINE_MAX_ROWS; y++)
+                memo->row_ready[y] = FALSE;
+        }
+
+        return memo;
+    }
+
+    return NULL;
+}
+
+/*!
+ * @brief 行の内容を前回と比べ、描く内容を覚える / Compare the contents of a row with the last ones and remember them
+ * @param memo 行の記憶への参照ポインタ (NULLなら常に描き直す)
+ * @param y 行
+ * @param text 描く内容
+ * @return 描き直す必要があればTRUE
+ */
+static bool remember_item_line(item_line_memo *memo, TERM_LEN y, concptr text)
+{
+    if (!memo || (y < 0) || (y >= ITEM_LINE_MAX_ROWS))
+        return TRUE;
+
+    if (memo->row_ready[y] && streq(memo->row_text[y], text))
+        return FALSE;
+
+    memo->row_ready[y] = TRUE;
+    angband_strcpy(memo->row_text[y], text, ITEM_LINE_TEXT_MAX);
+    return TRUE;
+}
+
+/*!
+ * @brief アイテムの行を描き直す必要があるかを調べ、描く内容を覚える / Check whether an item row needs redrawing and remember it
+ * @param memo 行の記憶への参照ポインタ (NULLなら常に描き直す)
+ * @param y 行
+ * @param label 選択記号
+ * @param attr アイテム名の色
+ * @param name アイテム名
+ * @param weight 重さの表記 (表示しないならNULL)
+ * @param mention 装備部位の表記 (表示しないならNULL)
+ * @return 描き直す必要があればTRUE
+ */
+bool is_item_line_changed(item_line_memo *memo, TERM_LEN y, concptr label, TERM_COLOR attr, concptr name, concptr weight, concptr mention)
+{
+    char text[ITEM_LINE_TEXT_MAX];
+    strnfmt(text, sizeof(text), "%d\n%s\n%s\n%s\n%s", (int)attr, label, name, weight ? weight : "", mention ? mention : "");
+    return remember_item_line(memo, y, text);
+}
+
+/*!
+ * @brief 空行を描き直す必要があるかを調べ、空行にしたことを覚える / Check whether a blank row needs erasing and remember it
+ * @param memo 行の記憶への参照ポインタ (NULLなら常に消す)
+ * @param y 行
+ * @return 消す必要があればTRUE
+ */
+bool is_item_blank_line_changed(item_line_memo *memo, TERM_LEN y) { return remember_item_line(memo, y, ""); }
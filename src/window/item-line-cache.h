@@ -0,0 +1,17 @@
+﻿#pragma once
+
+#include "system/angband.h"
+#include "term/term-color-types.h"
+
+/*! サブウィンドウに行単位でキャッシュして表示する一覧の種類 */
+typedef enum item_line_kind {
+    ITEM_LINE_INVEN = 1, /*!< 所持品一覧 */
+    ITEM_LINE_EQUIP = 2, /*!< 装備品一覧 */
+} item_line_kind;
+
+typedef struct item_line_memo item_line_memo;
+
+void forget_item_line_memos(void);
+item_line_memo *get_item_line_memo(item_line_kind kind);
+bool is_item_line_changed(item_line_memo *memo, TERM_LEN y, concptr label, TERM_COLOR attr, concptr name, concptr weight, concptr mention);
+bool is_item_blank_line_changed(item_line_memo *memo, TERM_LEN y);
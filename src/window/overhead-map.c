@@ -0,0 +1,557 @@
+﻿/*!
+ * @brief 縮小マップの表示 / Small-scale map of the dungeon
+ * @date 2026/10/19
+ * @details
+ * 縮小マップは各グリッドのシンボルをmap_info()で求め、縮小後の1文字ごとに優先度の高いシンボルを選んで表示する。
+ * 表示用のバッファはサブウィンドウごとに保持し、lite_spot()/note_spot()で通知されたグリッドを含む
+ * 縮小セルだけを計算し直す。端末の大きさ・フロアが変わった時やメインマップを全て描き直した時は全体を作り直す。
+ */
+
+#include "window/overhead-map.h"
+#include "flavor/flavor-describer.h"
+#include "flavor/object-flavor-types.h"
+#include "floor/geometry.h"
+#include "game-option/map-screen-options.h"
+#include "game-option/special-options.h"
+#include "grid/grid.h"
+#include "system/floor-type-definition.h"
+#include "system/object-type-definition.h"
+#include "term/gameterm.h"
+#include "term/screen-processor.h"
+#include "term/term-color-types.h"
+#include "view/display-map.h"
+#include "window/main-window-util.h"
+#include "world/world.h"
+
+#define OVERHEAD_MAP_CHANGE_MAX 512 /*!< 差分更新で扱うグリッド数の上限 (超えたら全体を作り直す) */
+
+/*!
+ * @brief 縮小マップの表示用バッファ / Buffers of a small-scale map
+ * @details
+ * big* はフロアの大きさ+2、それ以外は縮小後の大きさ+2の配列で、外周は枠として使う。
+ */
+struct overhead_map_type {
+    bool valid; /*!< バッファの内容が現在のフロアと一致しているか */
+    POSITION floor_hgt; /*!< 作成時のフロアの高さ */
+    POSITION floor_wid; /*!< 作成時のフロアの幅 */
+    TERM_LEN hgt; /*!< 縮小マップの高さ */
+    TERM_LEN wid; /*!< 縮小マップの幅 */
+    POSITION yrat; /*!< 縦の縮小率 */
+    POSITION xrat; /*!< 横の縮小率 */
+    byte display_autopick; /*!< 作成時の自動拾い表示モード */
+
+    TERM_COLOR **bigma; /*!< グリッドごとのシンボルの色 */
+    SYMBOL_CODE **bigmc; /*!< グリッドごとのシンボル */
+    byte **bigmp; /*!< グリッドごとの表示優先度 (自動拾いの一致を反映後) */
+    byte **big_priority; /*!< グリッドごとの地形・アイテム・モンスターの表示優先度 */
+    int **big_autopick; /*!< グリッドごとに一致した自動拾い登録番号 */
+    object_type ***big_autopick_obj; /*!< グリッドごとに自動拾い登録に一致したアイテム */
+
+    TERM_COLOR **ma; /*!< 縮小セルごとのシンボルの色 */
+    SYMBOL_CODE **mc; /*!< 縮小セルごとのシンボル */
+    byte **mp; /*!< 縮小セルごとの表示優先度 */
+    int **match_autopick_yx; /*!< 縮小セルごとに一致した自動拾い登録番号 */
+    object_type ***object_autopick_yx; /*!< 縮小セルごとに自動拾い登録に一致したアイテム */
+    bool **cell_dirty; /*!< 差分更新で計算し直す縮小セルか */
+    int *dirty_cells; /*!< 計算し直す縮小セルの一覧 (y * (wid + 2) + x) */
+};
+
+static POSITION changed_y[OVERHEAD_MAP_CHANGE_MAX]; /*!< 前回の表示以降に変わったグリッドのY座標 */
+static POSITION changed_x[OVERHEAD_MAP_CHANGE_MAX]; /*!< 前回の表示以降に変わったグリッドのX座標 */
+static int changed_num = 0; /*!< 前回の表示以降に変わったグリッド数 */
+static bool changed_overflow = FALSE; /*!< 全体を作り直す必要があるか */
+static bool changed_grid[MAX_HGT][MAX_WID]; /*!< 変わったグリッドとして登録済か */
+
+static concptr simplify_list[][2] = {
+#ifdef JP
+    { "の魔法書", "" }, { NULL, NULL }
+#else
+    { "^Ring of ", "=" }, { "^Amulet of ", "\"" }, { "^Scroll of ", "?" }, { "^Scroll titled ", "?" }, { "^Wand of ", "-" }, { "^Rod of ", "-" },
+    { "^Staff of ", "_" }, { "^Potion of ", "!" }, { " Spellbook ", "" }, { "^Book of ", "" }, { " Magic [", "[" }, { " Book [", "[" }, { " Arts [", "[" },
+    { "^Set of ", "" }, { "^Pair of ", "" }, { NULL, NULL }
+#endif
+};
+
+static void display_shortened_item_name(player_type *player_ptr, object_type *o_ptr, int y)
+{
+    char buf[MAX_NLEN];
+    describe_flavor(player_ptr, buf, o_ptr, (OD_NO_FLAVOR | OD_OMIT_PREFIX | OD_NAME_ONLY));
+    TERM_COLOR attr = tval_to_attr[o_ptr->tval % 128];
+
+    if (player_ptr->image) {
+        attr = TERM_WHITE;
+        strcpy(buf, _("何か奇妙な物", "something strange"));
+    }
+
+    char *c = buf;
+    for (c = buf; *c; c++) {
+        for (int i = 0; simplify_list[i][1]; i++) {
+            concptr org_w = simplify_list[i][0];
+
+            if (*org_w == '^') {
+                if (c == buf)
+                    org_w++;
+                else
+                    continue;
+            }
+
+            if (strncmp(c, org_w, strlen(org_w)))
+                continue;
+
+            char *s = c;
+            concptr tmp = simplify_list[i][1];
+            while (*tmp)
+                *s++ = *tmp++;
+            tmp = c + strlen(org_w);
+            while (*tmp)
+                *s++ = *tmp++;
+            *s = '\0';
+        }
+    }
+
+    c = buf;
+    int len = 0;
+    /* 半角 12 文字分で切る */
+    while (*c) {
+#ifdef JP
+        if (iskanji(*c)) {
+            if (len + 2 > 12)
+                break;
+            c += 2;
+            len += 2;
+        } else
+#endif
+        {
+            if (len + 1 > 12)
+                break;
+            c++;
+            len++;
+        }
+    }
+
+    *c = '\0';
+    term_putstr(0, y, 12, attr, buf);
+}
+
+/*!
+ * @brief 縮小マップのバッファを確保する / Allocate the buffers for the given sizes
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ */
+static void alloc_overhead_map_buffers(overhead_map_type *om_ptr)
+{
+    TERM_LEN hgt = om_ptr->hgt;
+    TERM_LEN wid = om_ptr->wid;
+    C_MAKE(om_ptr->ma, (hgt + 2), TERM_COLOR *);
+    C_MAKE(om_ptr->mc, (hgt + 2), char_ptr);
+    C_MAKE(om_ptr->mp, (hgt + 2), byte_ptr);
+    C_MAKE(om_ptr->match_autopick_yx, (hgt + 2), int *);
+    C_MAKE(om_ptr->object_autopick_yx, (hgt + 2), object_type **);
+    C_MAKE(om_ptr->cell_dirty, (hgt + 2), bool *);
+    for (int y = 0; y < (hgt + 2); y++) {
+        C_MAKE(om_ptr->ma[y], (wid + 2), TERM_COLOR);
+        C_MAKE(om_ptr->mc[y], (wid + 2), char);
+        C_MAKE(om_ptr->mp[y], (wid + 2), byte);
+        C_MAKE(om_ptr->match_autopick_yx[y], (wid + 2), int);
+        C_MAKE(om_ptr->object_autopick_yx[y], (wid + 2), object_type *);
+        C_MAKE(om_ptr->cell_dirty[y], (wid + 2), bool);
+    }
+
+    C_MAKE(om_ptr->dirty_cells, (hgt + 2) * (wid + 2), int);
+
+    POSITION floor_hgt = om_ptr->floor_hgt;
+    POSITION floor_wid = om_ptr->floor_wid;
+    C_MAKE(om_ptr->bigma, (floor_hgt + 2), TERM_COLOR *);
+    C_MAKE(om_ptr->bigmc, (floor_hgt + 2), char_ptr);
+    C_MAKE(om_ptr->bigmp, (floor_hgt + 2), byte_ptr);
+    C_MAKE(om_ptr->big_priority, (floor_hgt + 2), byte_ptr);
+    C_MAKE(om_ptr->big_autopick, (floor_hgt + 2), int *);
+    C_MAKE(om_ptr->big_autopick_obj, (floor_hgt + 2), object_type **);
+    for (int y = 0; y < (floor_hgt + 2); y++) {
+        C_MAKE(om_ptr->bigma[y], (floor_wid + 2), TERM_COLOR);
+        C_MAKE(om_ptr->bigmc[y], (floor_wid + 2), char);
+        C_MAKE(om_ptr->bigmp[y], (floor_wid + 2), byte);
+        C_MAKE(om_ptr->big_priority[y], (floor_wid + 2), byte);
+        C_MAKE(om_ptr->big_autopick[y], (floor_wid + 2), int);
+        C_MAKE(om_ptr->big_autopick_obj[y], (floor_wid + 2), object_type *);
+        for (int x = 0; x < floor_wid + 2; ++x) {
+            om_ptr->bigma[y][x] = TERM_WHITE;
+            om_ptr->bigmc[y][x] = ' ';
+            om_ptr->big_autopick[y][x] = -1;
+        }
+    }
+}
+
+/*!
+ * @brief 縮小マップのバッファを解放する / Free the buffers
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ */
+static void free_overhead_map_buffers(overhead_map_type *om_ptr)
+{
+    if (!om_ptr->ma)
+        return;
+
+    TERM_LEN hgt = om_ptr->hgt;
+    TERM_LEN wid = om_ptr->wid;
+    for (int y = 0; y < (hgt + 2); y++) {
+        C_KILL(om_ptr->ma[y], (wid + 2), TERM_COLOR);
+        C_KILL(om_ptr->mc[y], (wid + 2), SYMBOL_CODE);
+        C_KILL(om_ptr->mp[y], (wid + 2), byte);
+        C_KILL(om_ptr->match_autopick_yx[y], (wid + 2), int);
+        C_KILL(om_ptr->object_autopick_yx[y], (wid + 2), object_type *);
+        C_KILL(om_ptr->cell_dirty[y], (wid + 2), bool);
+    }
+
+    C_KILL(om_ptr->ma, (hgt + 2), TERM_COLOR *);
+    C_KILL(om_ptr->mc, (hgt + 2), char_ptr);
+    C_KILL(om_ptr->mp, (hgt + 2), byte_ptr);
+    C_KILL(om_ptr->match_autopick_yx, (hgt + 2), int *);
+    C_KILL(om_ptr->object_autopick_yx, (hgt + 2), object_type **);
+    C_KILL(om_ptr->cell_dirty, (hgt + 2), bool *);
+    C_KILL(om_ptr->dirty_cells, (hgt + 2) * (wid + 2), int);
+
+    POSITION floor_hgt = om_ptr->floor_hgt;
+    POSITION floor_wid = om_ptr->floor_wid;
+    for (int y = 0; y < (floor_hgt + 2); y++) {
+        C_KILL(om_ptr->bigma[y], (floor_wid + 2), TERM_COLOR);
+        C_KILL(om_ptr->bigmc[y], (floor_wid + 2), SYMBOL_CODE);
+        C_KILL(om_ptr->bigmp[y], (floor_wid + 2), byte);
+        C_KILL(om_ptr->big_priority[y], (floor_wid + 2), byte);
+        C_KILL(om_ptr->big_autopick[y], (floor_wid + 2), int);
+        C_KILL(om_ptr->big_autopick_obj[y], (floor_wid + 2), object_type *);
+    }
+
+    C_KILL(om_ptr->bigma, (floor_hgt + 2), TERM_COLOR *);
+    C_KILL(om_ptr->bigmc, (floor_hgt + 2), char_ptr);
+    C_KILL(om_ptr->bigmp, (floor_hgt + 2), byte_ptr);
+    C_KILL(om_ptr->big_priority, (floor_hgt + 2), byte_ptr);
+    C_KILL(om_ptr->big_autopick, (floor_hgt + 2), int *);
+    C_KILL(om_ptr->big_autopick_obj, (floor_hgt + 2), object_type **);
+}
+
+/*!
+ * @brief 縮小マップを確保する / Create an empty small-scale map
+ * @return 縮小マップへの参照ポインタ
+ * @details バッファは最初の表示の時に端末とフロアの大きさに合わせて確保する。
+ */
+overhead_map_type *make_overhead_map(void)
+{
+    overhead_map_type *om_ptr;
+    MAKE(om_ptr, overhead_map_type);
+    return om_ptr;
+}
+
+/*!
+ * @brief 縮小マップを解放する / Free a small-scale map
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ */
+void kill_overhead_map(overhead_map_type *om_ptr)
+{
+    free_overhead_map_buffers(om_ptr);
+    KILL(om_ptr, overhead_map_type);
+}
+
+/*!
+ * @brief 縮小マップを次の表示で作り直させる / Force a full rebuild on the next display
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ * @details 表示されていない間のグリッドの変化は追跡されないため、表示を飛ばした縮小マップに対して呼ぶ。
+ */
+void forget_overhead_map(overhead_map_type *om_ptr) { om_ptr->valid = FALSE; }
+
+/*!
+ * @brief グリッドのシンボルと表示優先度を求め直す / Recompute the symbol of a grid
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @param y グリッドのY座標
+ * @param x グリッドのX座標
+ * @return なし
+ */
+static void update_overhead_map_grid(player_type *player_ptr, overhead_map_type *om_ptr, POSITION y, POSITION x)
+{
+    TERM_COLOR ta;
+    SYMBOL_CODE tc;
+    match_autopick = -1;
+    autopick_obj = NULL;
+    feat_priority = -1;
+    map_info(player_ptr, y, x, &ta, &tc, &ta, &tc);
+    om_ptr->bigmc[y + 1][x + 1] = tc;
+    om_ptr->bigma[y + 1][x + 1] = ta;
+    om_ptr->big_priority[y + 1][x + 1] = (byte)feat_priority;
+    om_ptr->big_autopick[y + 1][x + 1] = match_autopick;
+    om_ptr->big_autopick_obj[y + 1][x + 1] = autopick_obj;
+}
+
+/*!
+ * @brief 縮小セル1つに表示するシンボルを選び直す / Choose the symbol of a cell from the grids it covers
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @param y 縮小セルのY座標 (1～hgt)
+ * @param x 縮小セルのX座標 (1～wid)
+ * @return なし
+ * @details
+ * 自動拾い登録は列ごと、表示優先度は行ごとの順に走査し、
+ * 同じ優先度なら周囲と異なるシンボルを優先する (フロア全体を一度に走査した時と同じ結果になる)。
+ */
+static void update_overhead_map_cell(overhead_map_type *om_ptr, TERM_LEN y, TERM_LEN x)
+{
+    POSITION y0 = (y - 1) * om_ptr->yrat;
+    POSITION x0 = (x - 1) * om_ptr->xrat;
+    POSITION y1 = MIN(y0 + om_ptr->yrat, om_ptr->floor_hgt);
+    POSITION x1 = MIN(x0 + om_ptr->xrat, om_ptr->floor_wid);
+    om_ptr->ma[y][x] = TERM_WHITE;
+    om_ptr->mc[y][x] = ' ';
+    om_ptr->mp[y][x] = 0;
+    om_ptr->match_autopick_yx[y][x] = -1;
+    om_ptr->object_autopick_yx[y][x] = NULL;
+    for (POSITION i = x0; i < x1; i++) {
+        for (POSITION j = y0; j < y1; j++) {
+            byte tp = om_ptr->big_priority[j + 1][i + 1];
+            int match = om_ptr->big_autopick[j + 1][i + 1];
+            if (match != -1 && (om_ptr->match_autopick_yx[y][x] == -1 || om_ptr->match_autopick_yx[y][x] > match)) {
+                om_ptr->match_autopick_yx[y][x] = match;
+                om_ptr->object_autopick_yx[y][x] = om_ptr->big_autopick_obj[j + 1][i + 1];
+                tp = 0x7f;
+            }
+
+            om_ptr->bigmp[j + 1][i + 1] = tp;
+        }
+    }
+
+    for (POSITION j = y0; j < y1; j++) {
+        for (POSITION i = x0; i < x1; i++) {
+            SYMBOL_CODE tc = om_ptr->bigmc[j + 1][i + 1];
+            TERM_COLOR ta = om_ptr->bigma[j + 1][i + 1];
+            byte tp = om_ptr->bigmp[j + 1][i + 1];
+            if (om_ptr->mp[y][x] == tp) {
+                int cnt = 0;
+                for (int t = 0; t < 8; t++) {
+                    if (tc == om_ptr->bigmc[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]] && ta == om_ptr->bigma[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]])
+                        cnt++;
+                }
+
+                if (cnt <= 4)
+                    tp++;
+            }
+
+            if (om_ptr->mp[y][x] < tp) {
+                om_ptr->mc[y][x] = tc;
+                om_ptr->ma[y][x] = ta;
+                om_ptr->mp[y][x] = tp;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief 縮小マップ全体を作り直す / Rebuild every grid and cell
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ */
+static void rebuild_overhead_map(player_type *player_ptr, overhead_map_type *om_ptr)
+{
+    for (POSITION y = 0; y < om_ptr->floor_hgt; y++)
+        for (POSITION x = 0; x < om_ptr->floor_wid; x++)
+            update_overhead_map_grid(player_ptr, om_ptr, y, x);
+
+    for (TERM_LEN y = 1; y <= om_ptr->hgt; y++)
+        for (TERM_LEN x = 1; x <= om_ptr->wid; x++)
+            update_overhead_map_cell(om_ptr, y, x);
+
+    TERM_LEN x = om_ptr->wid + 1;
+    TERM_LEN y = om_ptr->hgt + 1;
+    for (int i = 0; i <= x; i++) {
+        om_ptr->ma[0][i] = om_ptr->ma[y][i] = TERM_WHITE;
+        om_ptr->mc[0][i] = om_ptr->mc[y][i] = '-';
+    }
+
+    for (int j = 0; j <= y; j++) {
+        om_ptr->ma[j][0] = om_ptr->ma[j][x] = TERM_WHITE;
+        om_ptr->mc[j][0] = om_ptr->mc[j][x] = '|';
+    }
+
+    om_ptr->mc[0][0] = om_ptr->mc[0][x] = om_ptr->mc[y][0] = om_ptr->mc[y][x] = '+';
+}
+
+/*!
+ * @brief 変わったグリッドとその周囲を含む縮小セルだけを選び直す / Update the cells around the changed grids
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @return なし
+ * @details 縮小セルの選択は周囲8グリッドのシンボルにも依存するので、隣接グリッドを含む縮小セルも選び直す。
+ */
+static void update_changed_overhead_map(player_type *player_ptr, overhead_map_type *om_ptr)
+{
+    int dirty_num = 0;
+    for (int k = 0; k < changed_num; k++) {
+        POSITION y = changed_y[k];
+        POSITION x = changed_x[k];
+        if ((y >= om_ptr->floor_hgt) || (x >= om_ptr->floor_wid))
+            continue;
+
+        update_overhead_map_grid(player_ptr, om_ptr, y, x);
+        for (int d = 0; d < 9; d++) {
+            POSITION ny = y + ddy_ddd[d];
+            POSITION nx = x + ddx_ddd[d];
+            if ((ny < 0) || (ny >= om_ptr->floor_hgt) || (nx < 0) || (nx >= om_ptr->floor_wid))
+                continue;
+
+            TERM_LEN cy = ny / om_ptr->yrat + 1;
+            TERM_LEN cx = nx / om_ptr->xrat + 1;
+            if (om_ptr->cell_dirty[cy][cx])
+                continue;
+
+            om_ptr->cell_dirty[cy][cx] = TRUE;
+            om_ptr->dirty_cells[dirty_num++] = cy * (om_ptr->wid + 2) + cx;
+        }
+    }
+
+    for (int k = 0; k < dirty_num; k++) {
+        TERM_LEN cy = om_ptr->dirty_cells[k] / (om_ptr->wid + 2);
+        TERM_LEN cx = om_ptr->dirty_cells[k] % (om_ptr->wid + 2);
+        om_ptr->cell_dirty[cy][cx] = FALSE;
+        update_overhead_map_cell(om_ptr, cy, cx);
+    }
+}
+
+/*!
+ * @brief 縮小マップを現在の端末とフロアに合わせる / Bring the buffers up to date with the floor
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @param hgt 縮小マップの高さ
+ * @param wid 縮小マップの幅
+ * @return なし
+ */
+static void update_overhead_map(player_type *player_ptr, overhead_map_type *om_ptr, TERM_LEN hgt, TERM_LEN wid)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    if (!om_ptr->ma || (om_ptr->hgt != hgt) || (om_ptr->wid != wid) || (om_ptr->floor_hgt != floor_ptr->height) || (om_ptr->floor_wid != floor_ptr->width)) {
+        free_overhead_map_buffers(om_ptr);
+        om_ptr->hgt = hgt;
+        om_ptr->wid = wid;
+        om_ptr->floor_hgt = floor_ptr->height;
+        om_ptr->floor_wid = floor_ptr->width;
+        alloc_overhead_map_buffers(om_ptr);
+        om_ptr->valid = FALSE;
+    }
+
+    if ((om_ptr->display_autopick != display_autopick) || changed_overflow)
+        om_ptr->valid = FALSE;
+
+    bool old_view_special_lite = view_special_lite;
+    bool old_view_granite_lite = view_granite_lite;
+    view_special_lite = FALSE;
+    view_granite_lite = FALSE;
+    if (om_ptr->valid) {
+        update_changed_overhead_map(player_ptr, om_ptr);
+    } else {
+        om_ptr->display_autopick = display_autopick;
+        om_ptr->yrat = (floor_ptr->height + hgt - 1) / hgt;
+        om_ptr->xrat = (floor_ptr->width + wid - 1) / wid;
+        rebuild_overhead_map(player_ptr, om_ptr);
+        om_ptr->valid = TRUE;
+    }
+
+    view_special_lite = old_view_special_lite;
+    view_granite_lite = old_view_granite_lite;
+}
+
+/*!
+ * @brief 縮小マップを現在の端末に描画する / Display a "small-scale" map of the dungeon in the active Term
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param om_ptr 縮小マップへの参照ポインタ
+ * @param cy プレイヤーの表示位置 (Y) の格納先
+ * @param cx プレイヤーの表示位置 (X) の格納先
+ * @return なし
+ */
+void draw_overhead_map(player_type *player_ptr, overhead_map_type *om_ptr, int *cy, int *cx)
+{
+    TERM_LEN hgt, wid;
+    term_get_size(&wid, &hgt);
+    hgt -= 2;
+    wid -= 14;
+    if (use_bigtile)
+        wid /= 2;
+
+    update_overhead_map(player_ptr, om_ptr, hgt, wid);
+    for (TERM_LEN y = 0; y < hgt + 2; ++y) {
+        term_gotoxy(COL_MAP, y);
+        for (TERM_LEN x = 0; x < wid + 2; ++x) {
+            TERM_COLOR ta = om_ptr->ma[y][x];
+            SYMBOL_CODE tc = om_ptr->mc[y][x];
+            if (!use_graphics) {
+                if (current_world_ptr->timewalk_m_idx)
+                    ta = TERM_DARK;
+                else if (is_invuln(player_ptr) || player_ptr->timewalk)
+                    ta = TERM_WHITE;
+                else if (player_ptr->wraith_form)
+                    ta = TERM_L_DARK;
+            }
+
+            term_add_bigch(ta, tc);
+        }
+    }
+
+    for (TERM_LEN y = 1; y < hgt + 1; ++y) {
+        match_autopick = -1;
+        for (TERM_LEN x = 1; x <= wid; x++) {
+            if (om_ptr->match_autopick_yx[y][x] != -1 && (match_autopick > om_ptr->match_autopick_yx[y][x] || match_autopick == -1)) {
+                match_autopick = om_ptr->match_autopick_yx[y][x];
+                autopick_obj = om_ptr->object_autopick_yx[y][x];
+            }
+        }
+
+        term_putstr(0, y, 12, 0, "            ");
+        if (match_autopick != -1)
+            display_shortened_item_name(player_ptr, autopick_obj, y);
+    }
+
+    (*cy) = player_ptr->y / om_ptr->yrat + 1 + ROW_MAP;
+    if (!use_bigtile)
+        (*cx) = player_ptr->x / om_ptr->xrat + 1 + COL_MAP;
+    else
+        (*cx) = (player_ptr->x / om_ptr->xrat + 1) * 2 + COL_MAP;
+}
+
+/*!
+ * @brief グリッドの表示が変わったことを縮小マップに通知する / Note that the symbol of a grid may have changed
+ * @param y グリッドのY座標
+ * @param x グリッドのX座標
+ * @return なし
+ */
+void note_overhead_map_grid(POSITION y, POSITION x)
+{
+    if (changed_overflow || (y < 0) || (y >= MAX_HGT) || (x < 0) || (x >= MAX_WID) || changed_grid[y][x])
+        return;
+
+    if (changed_num == OVERHEAD_MAP_CHANGE_MAX) {
+        changed_overflow = TRUE;
+        return;
+    }
+
+    changed_grid[y][x] = TRUE;
+    changed_y[changed_num] = y;
+    changed_x[changed_num] = x;
+    changed_num++;
+}
+
+/*!
+ * @brief 全ての縮小マップを次の表示で作り直させる / Force every small-scale map to be rebuilt
+ * @return なし
+ */
+void invalidate_overhead_map(void) { changed_overflow = TRUE; }
+
+/*!
+ * @brief 全ての縮小マップを表示し終えた後に変化の記録を消す / Forget the changes once every map has consumed them
+ * @return なし
+ */
+void flush_overhead_map_changes(void)
+{
+    for (int k = 0; k < changed_num; k++)
+        changed_grid[changed_y[k]][changed_x[k]] = FALSE;
+
+    changed_num = 0;
+    changed_overflow = FALSE;
+}
@@ -0,0 +1,13 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+typedef struct overhead_map_type overhead_map_type;
+
+overhead_map_type *make_overhead_map(void);
+void kill_overhead_map(overhead_map_type *om_ptr);
+void forget_overhead_map(overhead_map_type *om_ptr);
+void draw_overhead_map(player_type *player_ptr, overhead_map_type *om_ptr, int *cy, int *cx);
+void note_overhead_map_grid(POSITION y, POSITION x);
+void invalidate_overhead_map(void);
+void flush_overhead_map_changes(void);
@@ -9,6 +9,7 @@
 #include "birth/inventory-initializer.h"
 #include "cmd-io/cmd-help.h"
 #include "core/asking-player.h"
+#include "core/player-update-types.h"
 #include "dungeon/quest.h"
 #include "grid/grid.h"
 #include "info-reader/fixed-map-parser.h"
@@ -19,6 +20,7 @@
 #include "mutation/mutation-investor-remover.h"
 #include "player-info/self-info.h"
 #include "player/patron.h"
+#include "player/player-bonus-tracker.h"
 #include "spell-kind/spells-detection.h"
 #include "spell-kind/spells-perception.h"
 #include "spell-kind/spells-floor.h"
@@ -30,6 +32,7 @@
 #include "system/floor-type-definition.h"
 #include "util/int-char-converter.h"
 #include "view/display-messages.h"
+#include "wizard/wizard-benchmark.h"
 #include "wizard/wizard-item-modifier.h"
 #include "wizard/wizard-special-process.h"
 #include "wizard/wizard-spells.h"
@@ -60,7 +63,7 @@
  * h：新生 / Hitpoint rerating
  * H：モンスターの群れ生成 / Generate monster group
  * i：鑑定 / Identification
- * I：なし / Nothing
+ * I：ターン処理の計測結果をダンプ出力 (--enable-profiler時のみ) / Dump turn profile
  * j：ダンジョンの指定フロアへテレポート (ウィザードあり) / Jump to dungeon
  * J：なし / Nothing
  * k：自己分析 / Self info
@@ -74,7 +77,7 @@
  * o：アイテムのtval等を編集する / Edit object
  * O：現在のオプション設定をダンプ出力 / Output option settings
  * p：ショートテレポ / Blink
- * P：なし / Nothing
+ * P：性能計測 / Run benchmarks
  * q：クエストを完了させる / Finish quest
  * Q：クエストに突入する (ウィザードあり) / Jump to quest
  * r：カオスパトロンから報酬を貰う / Gain reward from chaos patron
@@ -92,7 +95,7 @@
  * x：経験値を得る / Gain experience
  * X：アイテムを初期状態に戻す / Return items to the initial ones
  * y：なし / Nothing
- * Y：なし / Nothing
+ * Y：能力値の差分計算を全計算で検証する (切替) / Toggle cross-checking incremental bonuses
  * z：近隣のモンスター消去 / Zap monsters around
  * Z：フロア中のモンスター消去 / Zap all monsters in the floor
  * @：特殊スペルの発動 / Special spell
@@ -162,6 +165,11 @@ void do_cmd_debug(player_type *creature_ptr)
     case 'i':
         (void)ident_spell(creature_ptr, FALSE, 0);
         break;
+#ifdef TURN_PROFILER
+    case 'I':
+        wiz_dump_turn_profile();
+        break;
+#endif
     case 'j':
         wiz_jump_to_dungeon(creature_ptr);
         break;
@@ -198,6 +206,9 @@ void do_cmd_debug(player_type *creature_ptr)
     case 'p':
         teleport_player(creature_ptr, 10, TELEPORT_SPONTANEOUS);
         break;
+    case 'P':
+        wiz_benchmark(creature_ptr);
+        break;
     case 'Q': {
         char ppp[30];
         char tmp_val[5];
@@ -276,6 +287,11 @@ void do_cmd_debug(player_type *creature_ptr)
 
         player_outfit(creature_ptr);
         break;
+    case 'Y':
+        cross_check_bonuses = !cross_check_bonuses;
+        msg_format("Bonus cross-check %s.", cross_check_bonuses ? "on" : "off");
+        creature_ptr->update |= PU_BONUS;
+        break;
     case 'z':
         wiz_zap_surrounding_monsters(creature_ptr);
         break;
@@ -0,0 +1,1267 @@
+﻿/*!
+ * @brief デバッグコマンドによる性能計測 / Micro-benchmarks for the debug command
+ * @date 2026/10/19
+ * @details
+ * 実際の呼び出し元と同じデータ (現在のフロアやr_info等) で実際の処理を繰り返し呼んで時間を計り、
+ * 結果をlib/user/benchmark.txt へ追記する。
+ * キャッシュを持つ処理は、キャッシュを切った場合と使った場合をそれぞれ計り、結果が一致するかも確かめる。
+ * 計測で書き換わるゲームの状態 (乱数・フロア・モンスター等) は計測の後で元に戻す。
+ */
+
+#include "wizard/wizard-benchmark.h"
+#include "action/travel-execution.h"
+#include "action/travel-planner.h"
+#include "artifact/fixed-art-generator.h"
+#include "core/asking-player.h"
+#include "core/object-compressor.h"
+#include "core/player-redraw-types.h"
+#include "core/player-update-types.h"
+#include "core/speed-table.h"
+#include "core/window-redrawer.h"
+#include "flavor/flavor-cache.h"
+#include "flavor/flavor-describer.h"
+#include "floor/cave.h"
+#include "floor/feature-plane.h"
+#include "floor/floor-slot-list.h"
+#include "floor/floor-town.h"
+#include "floor/geometry-table.h"
+#include "floor/geometry.h"
+#include "floor/teleport-index.h"
+#include "grid/grid.h"
+#include "inventory/inventory-slot-types.h"
+#include "io/files-util.h"
+#include "lore/lore-journal.h"
+#include "monster-race/monster-race.h"
+#include "monster-race/race-flags2.h"
+#include "monster-race/race-flags3.h"
+#include "monster/monster-compaction.h"
+#include "monster/monster-desc-cache.h"
+#include "monster/monster-describer.h"
+#include "monster/monster-description-types.h"
+#include "monster/monster-flag-types.h"
+#include "monster/monster-processor.h"
+#include "monster/monster-status.h"
+#include "monster/monster-timed-effect-types.h"
+#include "monster/monster-update.h"
+#include "object-enchant/object-ego.h"
+#include "object/object-generator.h"
+#include "object/object-kind.h"
+#include "player/player-bonus-tracker.h"
+#include "player/player-status.h"
+#include "spell-kind/spells-detection.h"
+#include "spell/spells-util.h"
+#include "store/store-util.h"
+#include "system/floor-type-definition.h"
+#include "system/gamevalue.h"
+#include "system/monster-race-definition.h"
+#include "system/monster-type-definition.h"
+#include "system/object-type-definition.h"
+#include "target/projection-path-calculator.h"
+#include "term/z-form.h"
+#include "util/angband-files.h"
+#include "util/sort.h"
+#include "util/usec-timer.h"
+#include "view/display-messages.h"
+#include "world/world.h"
+
+/*!< 1項目あたりの計測反復回数 */
+#define BENCH_REPEAT 200
+
+/*!
+ * @brief 計測する処理 / A routine timed by run_bench()
+ */
+typedef void (*bench_func)(player_type *player_ptr, vptr arg);
+
+/*!
+ * @brief 処理を繰り返し呼んで1回あたりの時間を出力する / Time a routine and report the time per run
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param fff 出力先
+ * @param name 計測項目名
+ * @param n 1回の処理で扱う数 (報告用)
+ * @param func 計測する処理
+ * @param arg 処理に渡す値
+ * @return 1回あたりの時間 (マイクロ秒)
+ */
+static double run_bench(player_type *player_ptr, FILE *fff, concptr name, int n, bench_func func, vptr arg)
+{
+    double start = get_usec_time();
+    for (int r = 0; r < BENCH_REPEAT; r++)
+        (*func)(player_ptr, arg);
+
+    double usec = (get_usec_time() - start) / BENCH_REPEAT;
+    fprintf(fff, "  %-32s n=%5d  %10.2f us/run\n", name, n, usec);
+    msg_format("%s: %.2f us", name, usec);
+    return usec;
+}
+
+/*! ソートの計測対象 / Arrays sorted by the sort benchmarks */
+typedef struct bench_sort_arg {
+    vptr src; /*!< ソート前の配列 */
+    vptr work; /*!< 作業用の配列 */
+    int n; /*!< 要素数 */
+    int why; /*!< 種族リストの並べ方 */
+} bench_sort_arg;
+
+static void sort_bench_races(player_type *player_ptr, vptr arg)
+{
+    (void)player_ptr;
+    bench_sort_arg *sort_ptr = (bench_sort_arg *)arg;
+    (void)C_COPY((MONRACE_IDX *)sort_ptr->work, (MONRACE_IDX *)sort_ptr->src, sort_ptr->n, MONRACE_IDX);
+    sort_race_index((MONRACE_IDX *)sort_ptr->work, sort_ptr->n, sort_ptr->why);
+}
+
+static void sort_bench_templates(player_type *player_ptr, vptr arg)
+{
+    (void)player_ptr;
+    bench_sort_arg *sort_ptr = (bench_sort_arg *)arg;
+    (void)C_COPY((grid_template_type *)sort_ptr->work, (grid_template_type *)sort_ptr->src, sort_ptr->n, grid_template_type);
+    sort_grid_templates((grid_template_type *)sort_ptr->work, sort_ptr->n);
+}
+
+static void sort_bench_positions(player_type *player_ptr, vptr arg)
+{
+    bench_sort_arg *sort_ptr = (bench_sort_arg *)arg;
+    COPY((pos_list *)sort_ptr->work, (pos_list *)sort_ptr->src, pos_list);
+    sort_pos_by_distance(player_ptr, (pos_list *)sort_ptr->work);
+}
+
+/*!
+ * @brief モンスター種族リストのソートを計測する (思い出・スポイラー出力相当)
+ * @details 並べる前のリストは乱数で混ぜるが、乱数の状態は元に戻す。
+ */
+static void bench_sort_race(player_type *player_ptr, FILE *fff)
+{
+    MONRACE_IDX *who, *work;
+    C_MAKE(who, max_r_idx, MONRACE_IDX);
+    C_MAKE(work, max_r_idx, MONRACE_IDX);
+    int n = 0;
+    for (MONRACE_IDX i = 1; i < max_r_idx; i++)
+        if (r_info[i].name)
+            who[n++] = i;
+
+    u32b state[RAND_DEG];
+    Rand_state_backup(state);
+    for (int i = n - 1; i > 0; i--) {
+        int j = randint0(i + 1);
+        MONRACE_IDX tmp = who[i];
+        who[i] = who[j];
+        who[j] = tmp;
+    }
+
+    Rand_state_restore(state);
+    bench_sort_arg arg = { who, work, n, 2 };
+    run_bench(player_ptr, fff, "race list (shuffled)", n, sort_bench_races, &arg);
+    sort_race_index(who, n, arg.why);
+    run_bench(player_ptr, fff, "race list (presorted)", n, sort_bench_races, &arg);
+    C_KILL(work, max_r_idx, MONRACE_IDX);
+    C_KILL(who, max_r_idx, MONRACE_IDX);
+}
+
+/*!
+ * @brief フロア保存時のgridテンプレートのソートを計測する (wr_saved_floor()相当)
+ */
+static void bench_sort_templates(player_type *player_ptr, FILE *fff)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int max_num_temp = floor_ptr->height * floor_ptr->width;
+    int num_temp = 0;
+    grid_template_type *templates, *work;
+    C_MAKE(templates, max_num_temp, grid_template_type);
+    C_MAKE(work, max_num_temp, grid_template_type);
+    for (POSITION y = 0; y < floor_ptr->height; y++) {
+        for (POSITION x = 0; x < floor_ptr->width; x++) {
+            grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+            int i;
+            for (i = 0; i < num_temp; i++) {
+                if (templates[i].info == g_ptr->info && templates[i].feat == g_ptr->feat && templates[i].mimic == g_ptr->mimic
+                    && templates[i].special == g_ptr->special) {
+                    templates[i].occurrence++;
+                    break;
+                }
+            }
+
+            if (i < num_temp)
+                continue;
+
+            templates[num_temp].info = g_ptr->info;
+            templates[num_temp].feat = g_ptr->feat;
+            templates[num_temp].mimic = g_ptr->mimic;
+            templates[num_temp].special = g_ptr->special;
+            templates[num_temp].occurrence = 1;
+            num_temp++;
+        }
+    }
+
+    bench_sort_arg arg = { templates, work, num_temp, 0 };
+    run_bench(player_ptr, fff, "grid templates", num_temp, sort_bench_templates, &arg);
+    sort_grid_templates(templates, num_temp);
+    run_bench(player_ptr, fff, "grid templates (presorted)", num_temp, sort_bench_templates, &arg);
+    C_KILL(work, max_num_temp, grid_template_type);
+    C_KILL(templates, max_num_temp, grid_template_type);
+}
+
+/*!
+ * @brief 座標リストの距離順ソートを計測する (ターゲット選択相当)
+ */
+static void bench_sort_distance(player_type *player_ptr, FILE *fff)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    pos_list *plist, *work;
+    MAKE(plist, pos_list);
+    MAKE(work, pos_list);
+    for (POSITION y = 1; (y < floor_ptr->height - 1) && (plist->n < TEMP_MAX); y++) {
+        for (POSITION x = 1; (x < floor_ptr->width - 1) && (plist->n < TEMP_MAX); x++) {
+            if (distance(player_ptr->y, player_ptr->x, y, x) > MAX_SIGHT)
+                continue;
+
+            plist->y[plist->n] = y;
+            plist->x[plist->n] = x;
+            plist->n++;
+        }
+    }
+
+    bench_sort_arg arg = { plist, work, plist->n, 0 };
+    run_bench(player_ptr, fff, "target grids", plist->n, sort_bench_positions, &arg);
+    sort_pos_by_distance(player_ptr, plist);
+    run_bench(player_ptr, fff, "target grids (presorted)", plist->n, sort_bench_positions, &arg);
+    KILL(work, pos_list);
+    KILL(plist, pos_list);
+}
+
+/*!
+ * @brief 実際の呼び出し元のデータでソートを計測する / Time the sort engine on real call sites
+ * @details 整列済みの配列は旧ang_sort()の最悪の場合 (先頭要素をピボットとする再帰の深さが要素数になる) に当たる。
+ */
+static void bench_sort(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Sort: sort engine on shuffled and presorted keys, %d runs each]\n", BENCH_REPEAT);
+    bench_sort_race(player_ptr, fff);
+    bench_sort_templates(player_ptr, fff);
+    bench_sort_distance(player_ptr, fff);
+}
+
+/*!
+ * @brief 参照表がcalc_distance()の計算と一致するか検証する / Check the geometry tables against calc_distance()
+ * @param fff 出力先
+ * @return 不一致の数
+ * @details 差はフロアの範囲を超えるものまで調べ、表の範囲外でcalc_distance()に回す分岐も確かめる。
+ */
+static int verify_geometry(FILE *fff)
+{
+    int mismatch = 0;
+    for (POSITION dy = -MAX_HGT * 2; dy <= MAX_HGT * 2; dy++)
+        for (POSITION dx = -MAX_WID * 2; dx <= MAX_WID * 2; dx++)
+            if (distance(0, 0, dy, dx) != calc_distance(ABS(dy), ABS(dx)))
+                mismatch++;
+
+    fprintf(fff, "  distance() mismatches: %d\n", mismatch);
+
+    int ring_mismatch = 0;
+    int ring_total = 0;
+    bool *seen;
+    C_MAKE(seen, MAX_HGT * 2 * MAX_WID * 2, bool);
+    for (POSITION d = 0; d <= MAX_GEOMETRY_DISTANCE; d++) {
+        for (int i = 0; dist_offsets_y[d][i] || dist_offsets_x[d][i]; i++) {
+            POSITION y = dist_offsets_y[d][i];
+            POSITION x = dist_offsets_x[d][i];
+            bool *seen_ptr = &seen[(y + MAX_HGT) * MAX_WID * 2 + (x + MAX_WID)];
+            if (*seen_ptr || (calc_distance(ABS(y), ABS(x)) != d))
+                ring_mismatch++;
+
+            *seen_ptr = TRUE;
+            ring_total++;
+        }
+    }
+
+    C_KILL(seen, MAX_HGT * 2 * MAX_WID * 2, bool);
+    if (ring_total != (MAX_HGT * 2 - 1) * (MAX_WID * 2 - 1) - 1)
+        ring_mismatch++;
+
+    fprintf(fff, "  offset ring mismatches: %d (%d offsets)\n", ring_mismatch, ring_total);
+
+    int dir_mismatch = 0;
+    for (DIRECTION dir = 1; dir <= 9; dir++)
+        if (offset_to_dir[ddy[dir] + 1][ddx[dir] + 1] != dir)
+            dir_mismatch++;
+
+    fprintf(fff, "  direction mismatches: %d\n", dir_mismatch);
+    return mismatch + ring_mismatch + dir_mismatch;
+}
+
+static void calc_floor_distances(player_type *player_ptr, vptr arg)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    long *sum_ptr = (long *)arg;
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        for (POSITION x = 0; x < floor_ptr->width; x++)
+            *sum_ptr += calc_distance(ABS(y - player_ptr->y), ABS(x - player_ptr->x));
+}
+
+static void measure_floor_distances(player_type *player_ptr, vptr arg)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    long *sum_ptr = (long *)arg;
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        for (POSITION x = 0; x < floor_ptr->width; x++)
+            *sum_ptr += distance(player_ptr->y, player_ptr->x, y, x);
+}
+
+/*!
+ * @brief 距離の参照表を検証し、計算との速度を比べる / Check the geometry tables and time them against calc_distance()
+ */
+static void bench_geometry(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Geometry: calc_distance() vs lookup tables, %d runs each]\n", BENCH_REPEAT);
+    int mismatch = verify_geometry(fff);
+    if (mismatch)
+        msg_format(_("参照表がcalc_distance()と%d箇所で一致しません！", "The geometry tables differ from calc_distance() in %d places!"), mismatch);
+
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int n = floor_ptr->height * floor_ptr->width;
+    long calc_sum = 0;
+    long table_sum = 0;
+    run_bench(player_ptr, fff, "calc_distance() over the floor", n, calc_floor_distances, &calc_sum);
+    run_bench(player_ptr, fff, "distance() over the floor", n, measure_floor_distances, &table_sum);
+    if (calc_sum != table_sum)
+        fprintf(fff, "  checksum mismatch: %ld\n", table_sum - calc_sum);
+}
+
+/*!
+ * @brief 一時効果を一通りかけた状態にする / Put the character under most of the timed buffs
+ */
+static void buff_bench_player(player_type *player_ptr)
+{
+    player_ptr->fast = player_ptr->hero = player_ptr->shero = player_ptr->blessed = player_ptr->tsuyoshi = 100;
+    player_ptr->shield = player_ptr->magicdef = player_ptr->ult_res = player_ptr->resist_magic = 100;
+    player_ptr->tim_esp = player_ptr->tim_invis = player_ptr->tim_infra = player_ptr->tim_stealth = 100;
+    player_ptr->tim_levitation = player_ptr->tim_regen = player_ptr->tim_sh_fire = 100;
+}
+
+/*!
+ * @brief 一時効果を1つ切り替える / Toggle one timed effect, as the expiry of a buff does
+ * @param r 反復回数 (切り替える効果を選ぶ)
+ */
+static void toggle_bench_buff(player_type *player_ptr, int r)
+{
+    TIME_EFFECT *effects[] = { &player_ptr->tim_esp, &player_ptr->hero, &player_ptr->fast, &player_ptr->shield, &player_ptr->tim_levitation, &player_ptr->stun };
+    TIME_EFFECT *effect_ptr = effects[(r / 2) % (sizeof(effects) / sizeof(effects[0]))];
+    *effect_ptr = *effect_ptr ? 0 : 100;
+}
+
+/*! 能力値更新の計測の設定 / Settings of a bonus benchmark */
+typedef struct bench_bonus_arg {
+    bool full; /*!< 依存関係を捨てて全て計算し直すか */
+    bool toggle; /*!< 毎回一時効果を1つ切り替えるか */
+    int count; /*!< 呼んだ回数 */
+} bench_bonus_arg;
+
+static void update_bench_bonuses(player_type *player_ptr, vptr arg)
+{
+    bench_bonus_arg *bonus_ptr = (bench_bonus_arg *)arg;
+    if (bonus_ptr->toggle)
+        toggle_bench_buff(player_ptr, bonus_ptr->count);
+
+    if (bonus_ptr->full)
+        invalidate_bonus_dependencies();
+
+    calc_bonuses(player_ptr);
+    bonus_ptr->count++;
+}
+
+/*!
+ * @brief PU_BONUSの全計算と差分計算を計測する / Time full and incremental PU_BONUS updates on a heavily buffed character
+ * @details 最後に差分計算を全計算と突き合わせながら一時効果を切り替え、食い違いを数える。
+ */
+static void bench_bonus(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Bonus: calc_bonuses(), %d runs each]\n", BENCH_REPEAT);
+    player_type *saved_ptr;
+    MAKE(saved_ptr, player_type);
+    *saved_ptr = *player_ptr;
+    bool cross_check = cross_check_bonuses;
+    cross_check_bonuses = FALSE;
+    buff_bench_player(player_ptr);
+    calc_bonuses(player_ptr);
+    calc_bonuses(player_ptr);
+
+    bench_bonus_arg full_still = { TRUE, FALSE, 0 };
+    bench_bonus_arg incremental_still = { FALSE, FALSE, 0 };
+    bench_bonus_arg full_toggled = { TRUE, TRUE, 0 };
+    bench_bonus_arg incremental_toggled = { FALSE, TRUE, 0 };
+    run_bench(player_ptr, fff, "full, no change", 1, update_bench_bonuses, &full_still);
+    run_bench(player_ptr, fff, "incremental, no change", 1, update_bench_bonuses, &incremental_still);
+    run_bench(player_ptr, fff, "full, one effect toggled", 1, update_bench_bonuses, &full_toggled);
+    run_bench(player_ptr, fff, "incremental, one effect toggled", 1, update_bench_bonuses, &incremental_toggled);
+
+    int mismatch = bonus_cross_check_mismatches;
+    cross_check_bonuses = TRUE;
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        toggle_bench_buff(player_ptr, r);
+        calc_bonuses(player_ptr);
+    }
+
+    mismatch = bonus_cross_check_mismatches - mismatch;
+    fprintf(fff, "  cross-check mismatches: %d\n", mismatch);
+    if (mismatch)
+        msg_format(_("差分計算が全計算と%d回食い違いました！", "Incremental bonuses differed from full updates %d times!"), mismatch);
+
+    cross_check_bonuses = cross_check;
+    *player_ptr = *saved_ptr;
+    KILL(saved_ptr, player_type);
+    invalidate_bonus_dependencies();
+    player_ptr->update |= PU_BONUS | PU_MONSTERS;
+}
+
+/*! 空き枠の一覧の計測対象 / A nearly full slot list */
+typedef struct bench_slot_arg {
+    slot_list_type slots; /*!< 空き枠の一覧 */
+    bool *used; /*!< 使用中の枠 */
+    int n; /*!< 削除する枠を選ぶ範囲 */
+    int mismatch; /*!< 使用中の枠や0が返された回数 */
+} bench_slot_arg;
+
+static void reuse_bench_slot(player_type *player_ptr, vptr arg)
+{
+    (void)player_ptr;
+    bench_slot_arg *slot_ptr = (bench_slot_arg *)arg;
+    int i = randint1(slot_ptr->n - 1);
+    if (slot_ptr->used[i] && release_slot(&slot_ptr->slots, (s16b)i))
+        slot_ptr->used[i] = FALSE;
+
+    int j = pop_free_slot(&slot_ptr->slots);
+    if (!j || slot_ptr->used[j])
+        slot_ptr->mismatch++;
+
+    slot_ptr->used[j] = TRUE;
+}
+
+/*!
+ * @brief 配列の空き枠探しを計測する / Time the free-list on a nearly full object array
+ * @details 大量のアイテムが落ちたフロアを模して配列をほぼ埋め、ランダムな枠の削除と確保を繰り返す。
+ */
+static void bench_slot_allocation(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Slot allocation: free-list, %d runs each]\n", BENCH_REPEAT);
+    int max = current_world_ptr->max_o_idx;
+    bench_slot_arg arg;
+    arg.n = max - 32;
+    arg.mismatch = 0;
+    C_MAKE(arg.used, max, bool);
+    make_slot_list(&arg.slots, max);
+    for (int i = 1; i < arg.n; i++) {
+        arg.used[i] = TRUE;
+        occupy_slot(&arg.slots, (s16b)i);
+    }
+
+    u32b state_backup[RAND_DEG];
+    Rand_state_backup(state_backup);
+    run_bench(player_ptr, fff, "release and pop on a full array", arg.n, reuse_bench_slot, &arg);
+    Rand_state_restore(state_backup);
+    fprintf(fff, "  free-list mismatches: %d\n", arg.mismatch);
+    if (arg.mismatch)
+        msg_format(_("空き枠の一覧が%d回食い違いました！", "The free-list went wrong %d times!"), arg.mismatch);
+
+    kill_slot_list(&arg.slots, max);
+    C_KILL(arg.used, max, bool);
+    fprintf(fff, "  object compaction:  %d runs, %d deleted, %d moved, %.1f us total, %.1f us max\n", object_compaction.count, object_compaction.deleted,
+        object_compaction.moved, object_compaction.usec, object_compaction.max_usec);
+    fprintf(fff, "  monster compaction: %d runs, %d deleted, %d moved, %.1f us total, %.1f us max\n", monster_compaction.count, monster_compaction.deleted,
+        monster_compaction.moved, monster_compaction.usec, monster_compaction.max_usec);
+}
+
+/*!
+ * @brief 所持品と家の中のアイテムを全て表記する / Describe every item in the pack and the home
+ * @param arg 表記したアイテムの数を返す
+ */
+static void describe_bench_items(player_type *player_ptr, vptr arg)
+{
+    GAME_TEXT buf[MAX_NLEN];
+    int n = 0;
+    for (int i = 0; i < INVEN_TOTAL; i++) {
+        if (!player_ptr->inventory_list[i].k_idx)
+            continue;
+
+        describe_flavor(player_ptr, buf, &player_ptr->inventory_list[i], 0);
+        n++;
+    }
+
+    store_type *store_ptr = &town_info[1].store[STORE_HOME];
+    for (int i = 0; i < store_ptr->stock_num; i++) {
+        describe_flavor(player_ptr, buf, &store_ptr->stock[i], 0);
+        n++;
+    }
+
+    *(int *)arg = n;
+}
+
+/*!
+ * @brief キャッシュした表記が作り直した表記と一致するか検証する / Check the cached descriptions against fresh ones
+ * @return 一致しなかった数
+ */
+static int verify_flavor_cache(player_type *player_ptr)
+{
+    GAME_TEXT cached[MAX_NLEN];
+    GAME_TEXT fresh[MAX_NLEN];
+    int mismatch = 0;
+    store_type *store_ptr = &town_info[1].store[STORE_HOME];
+    for (int i = 0; i < INVEN_TOTAL + store_ptr->stock_num; i++) {
+        object_type *o_ptr = (i < INVEN_TOTAL) ? &player_ptr->inventory_list[i] : &store_ptr->stock[i - INVEN_TOTAL];
+        if (!o_ptr->k_idx)
+            continue;
+
+        use_flavor_cache = TRUE;
+        describe_flavor(player_ptr, cached, o_ptr, 0);
+        use_flavor_cache = FALSE;
+        describe_flavor(player_ptr, fresh, o_ptr, 0);
+        if (strcmp(cached, fresh))
+            mismatch++;
+    }
+
+    return mismatch;
+}
+
+/*!
+ * @brief アイテム表記をキャッシュの有無で計測する / Time describe_flavor() without and with the cache
+ */
+static void bench_flavor(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Flavor: describe_flavor(), %d runs each]\n", BENCH_REPEAT);
+    bool use_cache = use_flavor_cache;
+    int n = 0;
+    describe_bench_items(player_ptr, &n);
+    use_flavor_cache = FALSE;
+    run_bench(player_ptr, fff, "pack and home, no cache", n, describe_bench_items, &n);
+    use_flavor_cache = TRUE;
+    run_bench(player_ptr, fff, "pack and home, cached", n, describe_bench_items, &n);
+    int mismatch = verify_flavor_cache(player_ptr);
+    use_flavor_cache = use_cache;
+    fprintf(fff, "  cache mismatches: %d\n", mismatch);
+    if (mismatch)
+        msg_format(_("キャッシュした表記が%d個食い違いました！", "%d cached descriptions differed from fresh ones!"), mismatch);
+
+    flavor_cache_stats_type *stats_ptr = &flavor_cache_stats;
+    u32b total = stats_ptr->hit + stats_ptr->miss;
+    fprintf(fff, "  cache since start: %lu hits, %lu misses (%.1f%% hit), %lu evictions, %lu resets\n", (unsigned long)stats_ptr->hit,
+        (unsigned long)stats_ptr->miss, total ? (100.0 * stats_ptr->hit / total) : 0.0, (unsigned long)stats_ptr->evict, (unsigned long)stats_ptr->reset);
+}
+
+/*! トラベルの計測の設定 / Settings of a travel benchmark */
+typedef struct bench_travel_arg {
+    POSITION ty; /*!< 目標のY座標 */
+    POSITION tx; /*!< 目標のX座標 */
+    bool to_player; /*!< プレーヤーまでで探索を打ち切るか */
+} bench_travel_arg;
+
+static void plan_bench_travel(player_type *player_ptr, vptr arg)
+{
+    bench_travel_arg *travel_ptr = (bench_travel_arg *)arg;
+    plan_travel_flow(player_ptr, travel_ptr->ty, travel_ptr->tx, travel_ptr->to_player);
+}
+
+/*!
+ * @brief トラベルの経路計算を計測する / Time the travel planner
+ * @details
+ * 目標はプレーヤーから歩いて行ける中で最もコストのかかる地点とする。
+ * 計測前のトラベルの状態は元に戻し、計測中に作った経路計算の状態は捨てる。
+ */
+static void bench_travel(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Travel: plan_travel_flow(), %d runs each]\n", BENCH_REPEAT);
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    travel_type *saved_ptr;
+    MAKE(saved_ptr, travel_type);
+    *saved_ptr = travel;
+    plan_travel_flow(player_ptr, player_ptr->y, player_ptr->x, FALSE);
+    bench_travel_arg arg = { 0, 0, FALSE };
+    int n = 0;
+    for (POSITION y = 0; y < floor_ptr->height; y++) {
+        for (POSITION x = 0; x < floor_ptr->width; x++) {
+            if (travel.cost[y][x] >= MAX_SHORT)
+                continue;
+
+            n++;
+            if (!arg.ty || (travel.cost[y][x] > travel.cost[arg.ty][arg.tx])) {
+                arg.ty = y;
+                arg.tx = x;
+            }
+        }
+    }
+
+    if (!arg.ty) {
+        fprintf(fff, "  no known grid to travel to\n");
+    } else {
+        run_bench(player_ptr, fff, "whole floor (Dijkstra)", n, plan_bench_travel, &arg);
+        int whole_cost = travel.cost[player_ptr->y][player_ptr->x];
+        arg.to_player = TRUE;
+        run_bench(player_ptr, fff, "to the player (A*)", n, plan_bench_travel, &arg);
+        int goal_cost = travel.cost[player_ptr->y][player_ptr->x];
+        fprintf(fff, "  route cost from (%d,%d) to (%d,%d): %d\n", player_ptr->y, player_ptr->x, arg.ty, arg.tx, whole_cost);
+        if (whole_cost != goal_cost) {
+            fprintf(fff, "  A* route cost differs: %d\n", goal_cost);
+            msg_print(_("A*の経路のコストが食い違いました！", "The A* route cost differed!"));
+        }
+    }
+
+    travel = *saved_ptr;
+    KILL(saved_ptr, travel_type);
+    forget_travel_plan();
+}
+
+static void detect_bench_feats(player_type *player_ptr, vptr arg)
+{
+    (void)detect_grids(player_ptr, *(POSITION *)arg, DETECT_GRID_TRAPS | DETECT_GRID_DOORS | DETECT_GRID_STAIRS | DETECT_GRID_QUIET);
+}
+
+static void rebuild_bench_planes(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    invalidate_feat_planes(player_ptr->current_floor_ptr);
+    (void)get_feat_plane_row(player_ptr->current_floor_ptr, FEAT_PLANE_TRAP, 0);
+}
+
+/*!
+ * @brief 地形感知を計測する / Time detect_grids() on the feature bitplanes
+ * @details
+ * 感知は隠しドアを暴き、グリッドを記憶させるので、計測の前にフロアのグリッドを写しておき、後で書き戻す。
+ * グリッドから作る索引 (ビット平面・テレポート先・射線キャッシュ) は作り直させる。
+ */
+static void bench_detection(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Detection: detect_grids(), %d runs each]\n", BENCH_REPEAT);
+    POSITION ranges[] = { DETECT_RAD_DEFAULT, DETECT_RAD_ALL };
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int n = floor_ptr->height * floor_ptr->width;
+    grid_type *saved_grids;
+    C_MAKE(saved_grids, n, grid_type);
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        (void)C_COPY(&saved_grids[y * floor_ptr->width], floor_ptr->grid_array[y], floor_ptr->width, grid_type);
+
+    run_bench(player_ptr, fff, "traps/doors/stairs, r=30", n, detect_bench_feats, &ranges[0]);
+    run_bench(player_ptr, fff, "traps/doors/stairs, r=255", n, detect_bench_feats, &ranges[1]);
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        (void)C_COPY(floor_ptr->grid_array[y], &saved_grids[y * floor_ptr->width], floor_ptr->width, grid_type);
+
+    C_KILL(saved_grids, n, grid_type);
+    invalidate_teleport_index(floor_ptr);
+    invalidate_projection_cache();
+    run_bench(player_ptr, fff, "bitplane rebuild", n, rebuild_bench_planes, NULL);
+    player_ptr->update |= PU_VIEW | PU_LITE | PU_MON_LITE | PU_MONSTERS;
+    player_ptr->redraw |= PR_MAP;
+}
+
+/*!
+ * @brief 計測の前後で戻すモンスターの状態 / Monster state saved across a monster benchmark
+ */
+typedef struct bench_monster_backup {
+    monster_type *m_list; /*!< モンスター配列の写し */
+    bool monster_noise; /*!< フロアの騒音 */
+    s16b *mproc_list[MAX_MTIMED]; /*!< 時限効果の一覧の写し */
+    s16b *mproc_pos[MAX_MTIMED]; /*!< 一覧内の位置の写し */
+    s16b mproc_max[MAX_MTIMED]; /*!< 一覧の長さ */
+    int *wheel_next[MAX_MTIMED]; /*!< 満了する回毎の循環リストの写し (加速・減速・無敵のみ) */
+    int *wheel_prev[MAX_MTIMED]; /*!< 同じく前の要素 */
+    u32b mtimed_tick; /*!< 時限効果を処理した回数 */
+    u32b rand_state[RAND_DEG]; /*!< 乱数の状態 */
+} bench_monster_backup;
+
+/*!
+ * @brief モンスターの状態を退避する / Save the monsters and everything a monster benchmark may change
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param backup_ptr 退避先
+ * @return なし
+ */
+static void backup_bench_monsters(floor_type *floor_ptr, bench_monster_backup *backup_ptr)
+{
+    int max = current_world_ptr->max_m_idx;
+    C_MAKE(backup_ptr->m_list, max, monster_type);
+    (void)C_COPY(backup_ptr->m_list, floor_ptr->m_list, max, monster_type);
+    backup_ptr->monster_noise = floor_ptr->monster_noise;
+    for (int t = 0; t < MAX_MTIMED; t++) {
+        C_MAKE(backup_ptr->mproc_list[t], max, s16b);
+        C_MAKE(backup_ptr->mproc_pos[t], max, s16b);
+        (void)C_COPY(backup_ptr->mproc_list[t], floor_ptr->mproc_list[t], max, s16b);
+        (void)C_COPY(backup_ptr->mproc_pos[t], floor_ptr->mproc_pos[t], max, s16b);
+        backup_ptr->mproc_max[t] = floor_ptr->mproc_max[t];
+        backup_ptr->wheel_next[t] = NULL;
+        backup_ptr->wheel_prev[t] = NULL;
+        if (!floor_ptr->mtimed_wheel_next[t])
+            continue;
+
+        C_MAKE(backup_ptr->wheel_next[t], max + MTIMED_WHEEL_SIZE, int);
+        C_MAKE(backup_ptr->wheel_prev[t], max + MTIMED_WHEEL_SIZE, int);
+        (void)C_COPY(backup_ptr->wheel_next[t], floor_ptr->mtimed_wheel_next[t], max + MTIMED_WHEEL_SIZE, int);
+        (void)C_COPY(backup_ptr->wheel_prev[t], floor_ptr->mtimed_wheel_prev[t], max + MTIMED_WHEEL_SIZE, int);
+    }
+
+    backup_ptr->mtimed_tick = current_world_ptr->mtimed_tick;
+    Rand_state_backup(backup_ptr->rand_state);
+}
+
+/*!
+ * @brief 退避したモンスターの状態を戻す / Restore the monsters saved by backup_bench_monsters()
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param backup_ptr 退避元
+ * @return なし
+ */
+static void restore_bench_monsters(player_type *player_ptr, bench_monster_backup *backup_ptr)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int max = current_world_ptr->max_m_idx;
+    (void)C_COPY(floor_ptr->m_list, backup_ptr->m_list, max, monster_type);
+    C_KILL(backup_ptr->m_list, max, monster_type);
+    floor_ptr->monster_noise = backup_ptr->monster_noise;
+    for (int t = 0; t < MAX_MTIMED; t++) {
+        (void)C_COPY(floor_ptr->mproc_list[t], backup_ptr->mproc_list[t], max, s16b);
+        (void)C_COPY(floor_ptr->mproc_pos[t], backup_ptr->mproc_pos[t], max, s16b);
+        floor_ptr->mproc_max[t] = backup_ptr->mproc_max[t];
+        C_KILL(backup_ptr->mproc_pos[t], max, s16b);
+        C_KILL(backup_ptr->mproc_list[t], max, s16b);
+        if (!backup_ptr->wheel_next[t])
+            continue;
+
+        (void)C_COPY(floor_ptr->mtimed_wheel_next[t], backup_ptr->wheel_next[t], max + MTIMED_WHEEL_SIZE, int);
+        (void)C_COPY(floor_ptr->mtimed_wheel_prev[t], backup_ptr->wheel_prev[t], max + MTIMED_WHEEL_SIZE, int);
+        C_KILL(backup_ptr->wheel_prev[t], max + MTIMED_WHEEL_SIZE, int);
+        C_KILL(backup_ptr->wheel_next[t], max + MTIMED_WHEEL_SIZE, int);
+    }
+
+    current_world_ptr->mtimed_tick = backup_ptr->mtimed_tick;
+    Rand_state_restore(backup_ptr->rand_state);
+    player_ptr->update |= PU_MONSTERS;
+    player_ptr->redraw |= PR_MAP;
+}
+
+/*!
+ * @brief フロアの生きているモンスターを数える / Count the live monsters on the floor
+ * @return モンスター数
+ */
+static int count_bench_monsters(floor_type *floor_ptr)
+{
+    int n = 0;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++)
+        if (monster_is_valid(&floor_ptr->m_list[i]))
+            n++;
+
+    return n;
+}
+
+/*!
+ * @brief 生存モンスターの視認状態を記録する / Record whether each monster is seen
+ * @return なし
+ */
+static void record_monster_sight(floor_type *floor_ptr, byte *sight)
+{
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        monster_type *m_ptr = &floor_ptr->m_list[i];
+        sight[i] = (byte)((m_ptr->ml ? 0x01 : 0x00) | ((m_ptr->mflag & MFLAG_VIEW) ? 0x02 : 0x00));
+    }
+}
+
+static void update_bench_monsters(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    update_monsters(player_ptr, FALSE);
+}
+
+/*!
+ * @brief モンスターの視認判定をキャッシュの有無で計測する / Time update_monsters() without and with the cache
+ * @details
+ * プレーヤーの今の感覚 (視界・テレパシー等) のまま計る。
+ * WEIRD_MINDのモンスターは判定のたびに乱数で見え隠れするので照合から外す。
+ */
+static void bench_monster_sight(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Monster sight: update_monsters(), %d runs each]\n", BENCH_REPEAT);
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int n = count_bench_monsters(floor_ptr);
+    bench_monster_backup backup;
+    backup_bench_monsters(floor_ptr, &backup);
+    byte *full_sight;
+    byte *cached_sight;
+    C_MAKE(full_sight, current_world_ptr->max_m_idx, byte);
+    C_MAKE(cached_sight, current_world_ptr->max_m_idx, byte);
+    bool use_cache = use_monster_sight_cache;
+    use_monster_sight_cache = FALSE;
+    update_monsters(player_ptr, FALSE);
+    run_bench(player_ptr, fff, "full", n, update_bench_monsters, NULL);
+    record_monster_sight(floor_ptr, full_sight);
+    use_monster_sight_cache = TRUE;
+    update_monsters(player_ptr, FALSE);
+    run_bench(player_ptr, fff, "change-driven", n, update_bench_monsters, NULL);
+    record_monster_sight(floor_ptr, cached_sight);
+    use_monster_sight_cache = use_cache;
+
+    int mismatch = 0;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++)
+        if ((full_sight[i] != cached_sight[i]) && !(r_info[floor_ptr->m_list[i].r_idx].flags2 & RF2_WEIRD_MIND))
+            mismatch++;
+
+    fprintf(fff, "  sight mismatches: %d\n", mismatch);
+    if (mismatch)
+        msg_format(_("モンスターの視認状態が%d体食い違いました！", "%d monsters differed in visibility!"), mismatch);
+
+    C_KILL(cached_sight, current_world_ptr->max_m_idx, byte);
+    C_KILL(full_sight, current_world_ptr->max_m_idx, byte);
+    restore_bench_monsters(player_ptr, &backup);
+}
+
+/*! エゴ計測の対象 (apply_magic()が実際に要求する組み合わせ) / Ego requests issued by apply_magic() */
+static const struct {
+    tval_type tval;
+    bool good;
+} bench_ego_requests[] = {
+    { TV_SWORD, TRUE }, { TV_HAFTED, TRUE }, { TV_POLEARM, TRUE }, { TV_BOW, TRUE }, { TV_ARROW, TRUE }, { TV_HARD_ARMOR, TRUE },
+    { TV_SOFT_ARMOR, TRUE }, { TV_SHIELD, TRUE }, { TV_GLOVES, TRUE }, { TV_BOOTS, TRUE }, { TV_CROWN, TRUE }, { TV_HELM, TRUE },
+    { TV_CLOAK, TRUE }, { TV_LITE, TRUE }, { TV_SWORD, FALSE }, { TV_HAFTED, FALSE }, { TV_POLEARM, FALSE }, { TV_ARROW, FALSE },
+    { TV_GLOVES, FALSE }, { TV_BOOTS, FALSE }, { TV_CROWN, FALSE }, { TV_HELM, FALSE }, { TV_CLOAK, FALSE }, { TV_LITE, FALSE },
+};
+
+static void draw_bench_egos(player_type *player_ptr, vptr arg)
+{
+    (void)player_ptr;
+    (void)arg;
+    for (size_t n = 0; n < sizeof(bench_ego_requests) / sizeof(bench_ego_requests[0]); n++)
+        (void)get_random_ego(bench_ego_requests[n].tval, bench_ego_requests[n].good);
+}
+
+/*! 固定アーティファクトの計測対象 / Equipment kinds tried by make_artifact() */
+typedef struct bench_artifact_arg {
+    object_type *kinds; /*!< ベースアイテムごとに作ったアイテム */
+    int num; /*!< ベースアイテムの数 */
+} bench_artifact_arg;
+
+static void make_bench_artifacts(player_type *player_ptr, vptr arg)
+{
+    bench_artifact_arg *artifact_ptr = (bench_artifact_arg *)arg;
+    for (int i = 0; i < artifact_ptr->num; i++) {
+        object_type forge = artifact_ptr->kinds[i];
+        (void)make_artifact(player_ptr, &forge);
+    }
+}
+
+/*!
+ * @brief エゴと固定アーティファクトの候補選択を計測する / Time get_random_ego() and make_artifact()
+ * @details 乱数の状態は計測の前後で元に戻す。
+ */
+static void bench_ego_artifact(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Ego/artifact: candidate tables, %d runs each]\n", BENCH_REPEAT);
+    u32b state[RAND_DEG];
+    Rand_state_backup(state);
+    run_bench(player_ptr, fff, "get_random_ego()", sizeof(bench_ego_requests) / sizeof(bench_ego_requests[0]), draw_bench_egos, NULL);
+    if (!player_ptr->current_floor_ptr->dun_level) {
+        fprintf(fff, "  make_artifact(): skipped on the surface\n");
+        Rand_state_restore(state);
+        return;
+    }
+
+    bench_artifact_arg arg;
+    C_MAKE(arg.kinds, max_k_idx, object_type);
+    arg.num = 0;
+    for (KIND_OBJECT_IDX k = 1; k < max_k_idx; k++)
+        if ((k_info[k].tval >= TV_EQUIP_BEGIN) && (k_info[k].tval <= TV_EQUIP_END))
+            object_prep(player_ptr, &arg.kinds[arg.num++], k);
+
+    run_bench(player_ptr, fff, "make_artifact(), all kinds", arg.num, make_bench_artifacts, &arg);
+    C_KILL(arg.kinds, max_k_idx, object_type);
+    Rand_state_restore(state);
+}
+
+static void flush_bench_lore(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    flush_lore_journal(player_ptr);
+}
+
+/*!
+ * @brief 思い出の更新記録の処理を計測し、これまでの統計を出力する / Time flush_lore_journal() and report the journal statistics
+ * @details 追跡中の種族の思い出を1ビット忘れさせてから覚え直させ、再描画が要求されることを確かめる。
+ */
+static void bench_lore_journal(player_type *player_ptr, FILE *fff)
+{
+    static concptr field_names[LORE_FIELD_MAX] = { "flags1", "flags2", "flags3", "flags4", "flags5", "flags6", "flagsr", "blows", "spells", "kills" };
+    fprintf(fff, "[Lore: flush_lore_journal(), %d runs each]\n", BENCH_REPEAT);
+    lore_journal_stats stats = lore_stats;
+    flush_lore_journal(player_ptr);
+    run_bench(player_ptr, fff, "tracked race, no change", 1, flush_bench_lore, NULL);
+    MONRACE_IDX r_idx = player_ptr->monster_race_idx;
+    if (r_idx) {
+        monster_race *r_ptr = &r_info[r_idx];
+        BIT_FLAGS window = player_ptr->window;
+        u32b r_flags3 = r_ptr->r_flags3;
+        r_ptr->r_flags3 &= ~(RF3_EVIL);
+        lore_race_flags(r_ptr, LORE_FLAGS3, RF3_EVIL);
+        player_ptr->window &= ~(PW_MONSTER);
+        flush_lore_journal(player_ptr);
+        bool redrawn = (player_ptr->window & PW_MONSTER) != 0;
+        r_ptr->r_flags3 = r_flags3;
+        player_ptr->window = window;
+        fprintf(fff, "  redraw on a new flag: %s\n", redrawn ? "yes" : "NO");
+        if (!redrawn)
+            msg_print(_("思い出の更新が再描画されませんでした！", "A lore change was not redrawn!"));
+    }
+
+    lore_stats = stats;
+    fprintf(fff, "  events since start:");
+    for (int i = 0; i < LORE_FIELD_MAX; i++)
+        fprintf(fff, " %s %lu/%lu", field_names[i], (unsigned long)lore_stats.events[i], (unsigned long)lore_stats.bits[i]);
+
+    fprintf(fff, "\n  turns with events: %lu, redraws: %lu, overflows: %lu\n", (unsigned long)lore_stats.flushes, (unsigned long)lore_stats.redraws,
+        (unsigned long)lore_stats.overflows);
+}
+
+/*! 計測の間どのモンスターも行動しないだけの行動エネルギー / Energy that keeps every monster from acting while the sweep is timed */
+#define BENCH_SWEEP_ENERGY (BENCH_REPEAT * SPEED_TO_ENERGY(200) + 1)
+
+static void sweep_bench_monsters(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    process_monsters(player_ptr);
+}
+
+/*!
+ * @brief 現在のフロアでモンスターの毎ターンの走査を計測する / Time the per-turn monster sweeps on the current floor
+ * @details
+ * process_monsters() は行動エネルギーを溜めきったモンスターだけを行動させるので、
+ * 計測の間は全員の行動エネルギーを満たさないようにしておき、走査そのものの時間を計る。
+ * モンスターと乱数の状態は計測の後で元に戻す。
+ */
+static void bench_monster_sweep(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Monster sweep: hot-first monster_type (%d bytes), %d runs each]\n", (int)sizeof(monster_type), BENCH_REPEAT);
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int n = count_bench_monsters(floor_ptr);
+    if (!n) {
+        fprintf(fff, "  no monsters on the floor\n");
+        return;
+    }
+
+    bench_monster_backup backup;
+    backup_bench_monsters(floor_ptr, &backup);
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++)
+        floor_ptr->m_list[i].energy_need = BENCH_SWEEP_ENERGY;
+
+    double sweep_usec = run_bench(player_ptr, fff, "process_monsters(), nobody acts", n, sweep_bench_monsters, NULL);
+    double update_usec = run_bench(player_ptr, fff, "update_monsters()", n, update_bench_monsters, NULL);
+    fprintf(fff, "  per 1000 monsters: sweep %.2f us, update %.2f us\n", sweep_usec * 1000 / n, update_usec * 1000 / n);
+    restore_bench_monsters(player_ptr, &backup);
+}
+
+static void find_bench_mproc_entries(player_type *player_ptr, vptr arg)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int *mismatch_ptr = (int *)arg;
+    for (int t = 0; t < MAX_MTIMED; t++)
+        for (int i = 0; i < floor_ptr->mproc_max[t]; i++)
+            *mismatch_ptr += (get_mproc_idx(floor_ptr, floor_ptr->mproc_list[t][i], t) != i);
+}
+
+static void tick_bench_mtimed(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    process_monsters_mtimed(player_ptr);
+}
+
+/*!
+ * @brief モンスターの時限効果の処理を計測する / Time the process list lookups and the per-tick countdowns
+ * @details
+ * process_monsters_mtimed() は時限効果を実際に進めるので、モンスターと時限効果の一覧・処理回数・乱数を退避しておき、後で戻す。
+ * 計測中は全員を見えていないことにして、目覚めや効果切れのメッセージと思い出の更新を出さない。
+ */
+static void bench_monster_timers(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Monster timers: back-index and timing wheel, %d runs each]\n", BENCH_REPEAT);
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int members = 0;
+    for (int t = 0; t < MAX_MTIMED; t++)
+        members += floor_ptr->mproc_max[t];
+
+    int sleepers = 0;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++)
+        if (monster_is_valid(&floor_ptr->m_list[i]) && monster_csleep_remaining(&floor_ptr->m_list[i]))
+            sleepers++;
+
+    fprintf(fff, "  sleepers: %d on the floor, %d within waking range\n", sleepers, floor_ptr->mproc_max[MTIMED_CSLEEP]);
+    int mismatch = 0;
+    run_bench(player_ptr, fff, "get_mproc_idx()", members, find_bench_mproc_entries, &mismatch);
+    fprintf(fff, "  lookup mismatches: %d\n", mismatch);
+    if (mismatch)
+        msg_format(_("時限効果の一覧の位置が%d件食い違いました！", "%d process list lookups differed!"), mismatch);
+
+    bench_monster_backup backup;
+    backup_bench_monsters(floor_ptr, &backup);
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++)
+        floor_ptr->m_list[i].ml = FALSE;
+
+    run_bench(player_ptr, fff, "process_monsters_mtimed()", members, tick_bench_mtimed, NULL);
+    restore_bench_monsters(player_ptr, &backup);
+}
+
+/*! 1体のモンスターが1ターンに自分とプレーヤーの間の射線を問い合わせる回数 / Repeated projectable() queries per monster turn */
+#define BENCH_PROJECTION_QUERIES 4
+
+/*! 射線の計測の設定 / Settings of a projection benchmark */
+typedef struct bench_projection_arg {
+    bool per_query; /*!< 問い合わせごとに射線キャッシュを捨てるか */
+    int reached; /*!< 直近のターンで射線が通った問い合わせの数 */
+} bench_projection_arg;
+
+/*!
+ * @brief 射線の問い合わせの前に射線キャッシュを捨てるかどうかを必要なら捨てる
+ * @param per_query 問い合わせごとに捨てるか
+ */
+static void refresh_bench_projection(bool per_query)
+{
+    if (per_query)
+        invalidate_projection_cache();
+}
+
+/*!
+ * @brief 1ターン分の射線の問い合わせを再現する
+ * @param arg 計測の設定 (bench_projection_arg)
+ * @details 各モンスターがプレーヤーとの射線を何度か確かめ、さらに周囲3マスの逃げ場をプレーヤーから見通せるか調べる。
+ */
+static void simulate_projection_turn(player_type *player_ptr, vptr arg)
+{
+    bench_projection_arg *projection_ptr = (bench_projection_arg *)arg;
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    int reached = 0;
+    invalidate_projection_cache();
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        monster_type *m_ptr = &floor_ptr->m_list[i];
+        if (!monster_is_valid(m_ptr))
+            continue;
+
+        for (int q = 0; q < BENCH_PROJECTION_QUERIES; q++) {
+            refresh_bench_projection(projection_ptr->per_query);
+            reached += projectable(player_ptr, m_ptr->fy, m_ptr->fx, player_ptr->y, player_ptr->x);
+        }
+
+        POSITION ys[64];
+        POSITION xs[64];
+        bool results[64];
+        for (POSITION d = 1; d <= 3; d++) {
+            int num = 0;
+            for (int k = 0; dist_offsets_y[d][k] || dist_offsets_x[d][k]; k++) {
+                POSITION y = m_ptr->fy + dist_offsets_y[d][k];
+                POSITION x = m_ptr->fx + dist_offsets_x[d][k];
+                if (!in_bounds(floor_ptr, y, x))
+                    continue;
+
+                ys[num] = y;
+                xs[num] = x;
+                num++;
+            }
+
+            refresh_bench_projection(projection_ptr->per_query);
+            projectable_targets(player_ptr, player_ptr->y, player_ptr->x, num, ys, xs, results);
+            for (int k = 0; k < num; k++)
+                reached += results[k];
+        }
+    }
+
+    projection_ptr->reached = reached;
+}
+
+/*!
+ * @brief 射線キャッシュを計測する / Time projectable() with the memo dropped per query and per turn
+ * @details 問い合わせごとにキャッシュを捨てた場合は、どの問い合わせも経路を辿り直す。両者で射線が通った数を突き合わせる。
+ */
+static void bench_projection(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Projection: projectable(), %d runs each]\n", BENCH_REPEAT);
+    int n = count_bench_monsters(player_ptr->current_floor_ptr);
+    if (!n) {
+        fprintf(fff, "  no monsters on the floor\n");
+        return;
+    }
+
+    bench_projection_arg per_query = { TRUE, 0 };
+    bench_projection_arg per_turn = { FALSE, 0 };
+    run_bench(player_ptr, fff, "monster turn, memo per query", n, simulate_projection_turn, &per_query);
+    projection_cache_stats before = projection_stats;
+    run_bench(player_ptr, fff, "monster turn, memo per turn", n, simulate_projection_turn, &per_turn);
+    u32b hits = projection_stats.hits - before.hits;
+    u32b misses = projection_stats.misses - before.misses;
+    fprintf(fff, "  memo hits: %lu, misses: %lu (%.1f%% hit rate)\n", (unsigned long)hits, (unsigned long)misses,
+        (hits + misses) ? 100.0 * hits / (hits + misses) : 0.0);
+    fprintf(fff, "  projectable results per turn: %d vs %d\n", per_query.reached, per_turn.reached);
+    if (per_query.reached != per_turn.reached)
+        msg_print(_("射線の判定が食い違いました！", "The projection results differed!"));
+
+    invalidate_projection_cache();
+}
+
+/*! 戦闘メッセージで使われる呼称オプション / Description modes used by combat messages */
+static const BIT_FLAGS bench_desc_modes[] = { 0, MD_PRON_VISIBLE, MD_POSSESSIVE, MD_WRONGDOER_NAME };
+
+/*!
+ * @brief 範囲攻撃がフロアの全モンスターに当たった時の戦闘メッセージを組み立てる
+ */
+static void compose_combat_messages(player_type *player_ptr, vptr arg)
+{
+    (void)arg;
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    GAME_TEXT m_name[MAX_NLEN];
+    GAME_TEXT m_poss[MAX_NLEN];
+    char buf[1024];
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        monster_type *m_ptr = &floor_ptr->m_list[i];
+        if (!monster_is_valid(m_ptr))
+            continue;
+
+        for (size_t k = 0; k < sizeof(bench_desc_modes) / sizeof(bench_desc_modes[0]); k++)
+            monster_desc(player_ptr, m_name, m_ptr, bench_desc_modes[k]);
+
+        monster_desc(player_ptr, m_name, m_ptr, 0);
+        monster_desc(player_ptr, m_poss, m_ptr, MD_PRON_VISIBLE | MD_POSSESSIVE);
+        strnfmt(buf, sizeof(buf), _("%^sに%dのダメージを与えた。", "%^s takes %d damage."), m_name, m_ptr->hp / 3);
+        strnfmt(buf, sizeof(buf), _("%^sはひどい痛手をうけた。", "%^s is badly wounded."), m_name);
+        strnfmt(buf, sizeof(buf), _("%^sの攻撃は効かなかった。", "%^s attack has no effect (%d/%d)."), m_poss, m_ptr->hp, m_ptr->maxhp);
+        strnfmt(buf, sizeof(buf), "%-20s %5ld %3d%%", m_name, (long)m_ptr->exp, 100 * m_ptr->hp / MAX(m_ptr->maxhp, 1));
+    }
+}
+
+/*!
+ * @brief キャッシュした呼称と書式が作り直したものと一致するか検証する / Check the cached descriptions and formats against fresh ones
+ * @return 一致しなかった数
+ */
+static int verify_combat_caches(player_type *player_ptr)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    GAME_TEXT cached[MAX_NLEN];
+    GAME_TEXT fresh[MAX_NLEN];
+    char cached_buf[1024];
+    char fresh_buf[1024];
+    int mismatch = 0;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        monster_type *m_ptr = &floor_ptr->m_list[i];
+        if (!monster_is_valid(m_ptr))
+            continue;
+
+        for (size_t k = 0; k < sizeof(bench_desc_modes) / sizeof(bench_desc_modes[0]); k++) {
+            use_monster_desc_cache = TRUE;
+            monster_desc(player_ptr, cached, m_ptr, bench_desc_modes[k]);
+            use_monster_desc_cache = FALSE;
+            monster_desc(player_ptr, fresh, m_ptr, bench_desc_modes[k]);
+            mismatch += (strcmp(cached, fresh) != 0);
+        }
+
+        use_format_cache = TRUE;
+        strnfmt(cached_buf, sizeof(cached_buf), "%^s: %d%% (%5.1f) %-8s|%lx|%c", fresh, m_ptr->hp, (double)m_ptr->mspeed, "abc", (unsigned long)m_ptr->r_idx, 'z');
+        use_format_cache = FALSE;
+        strnfmt(fresh_buf, sizeof(fresh_buf), "%^s: %d%% (%5.1f) %-8s|%lx|%c", fresh, m_ptr->hp, (double)m_ptr->mspeed, "abc", (unsigned long)m_ptr->r_idx, 'z');
+        mismatch += (strcmp(cached_buf, fresh_buf) != 0);
+    }
+
+    return mismatch;
+}
+
+/*!
+ * @brief 戦闘メッセージの組み立てを呼称と書式のキャッシュの有無で計測する / Time combat messages without and with the caches
+ */
+static void bench_combat_messages(player_type *player_ptr, FILE *fff)
+{
+    fprintf(fff, "[Combat messages: monster_desc() and vstrnfmt(), %d runs each]\n", BENCH_REPEAT);
+    int n = count_bench_monsters(player_ptr->current_floor_ptr);
+    if (!n) {
+        fprintf(fff, "  no monsters on the floor\n");
+        return;
+    }
+
+    bool use_desc_cache = use_monster_desc_cache;
+    bool use_fmt_cache = use_format_cache;
+    use_monster_desc_cache = FALSE;
+    use_format_cache = FALSE;
+    run_bench(player_ptr, fff, "whole floor, no cache", n, compose_combat_messages, NULL);
+    use_monster_desc_cache = TRUE;
+    use_format_cache = TRUE;
+    monster_desc_cache_stats_type desc_before = monster_desc_cache_stats;
+    format_cache_stats_type format_before = format_cache_stats;
+    run_bench(player_ptr, fff, "whole floor, cached", n, compose_combat_messages, NULL);
+    fprintf(fff, "  monster_desc(): %lu hits, %lu misses, %lu hallucinated\n", (unsigned long)(monster_desc_cache_stats.hit - desc_before.hit),
+        (unsigned long)(monster_desc_cache_stats.miss - desc_before.miss), (unsigned long)(monster_desc_cache_stats.bypass - desc_before.bypass));
+    fprintf(fff, "  vstrnfmt(): %lu compiled hits, %lu compiles, %lu left to the normal path\n", (unsigned long)(format_cache_stats.hit - format_before.hit),
+        (unsigned long)(format_cache_stats.miss - format_before.miss), (unsigned long)(format_cache_stats.skip - format_before.skip));
+
+    int mismatch = verify_combat_caches(player_ptr);
+    use_monster_desc_cache = use_desc_cache;
+    use_format_cache = use_fmt_cache;
+    fprintf(fff, "  cache mismatches: %d\n", mismatch);
+    if (mismatch)
+        msg_format(_("キャッシュした呼称や書式が%d件食い違いました！", "%d cached descriptions or formats differed!"), mismatch);
+}
+
+/*!
+ * @brief 性能計測を行うデバッグコマンドのメインルーチン / Run a benchmark chosen by the user
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+void wiz_benchmark(player_type *player_ptr)
+{
+    char cmd;
+    if (!get_com(_("計測対象 [s]ソート [g]距離 [b]能力値更新 [a]配列確保 [f]アイテム表記 [t]トラベル [d]感知 [m]モンスター視認 [e]エゴ/アーティファクト [r]思い出 [w]モンスター走査 [i]時限効果 [p]射線 [c]戦闘メッセージ: ",
+            "Benchmark [s]ort [g]eometry [b]onus update [a]llocation [f]lavor [t]ravel [d]etection [m]onster sight [e]go/artifact [r]ecall s[w]eep t[i]mers [p]rojection [c]ombat messages: "), &cmd, FALSE))
+        return;
+
+    char buf[1024];
+    path_build(buf, sizeof(buf), ANGBAND_DIR_USER, "benchmark.txt");
+    FILE *fff = angband_fopen(buf, "a");
+    if (fff == NULL) {
+        msg_format(_("ファイル %s を開けませんでした。", "Failed to open file %s."), buf);
+        msg_print(NULL);
+        return;
+    }
+
+    switch (cmd) {
+    case 's':
+        bench_sort(player_ptr, fff);
+        break;
+    case 'g':
+        bench_geometry(player_ptr, fff);
+        break;
+    case 'b':
+        bench_bonus(player_ptr, fff);
+        break;
+    case 'a':
+        bench_slot_allocation(player_ptr, fff);
+        break;
+    case 'f':
+        bench_flavor(player_ptr, fff);
+        break;
+    case 't':
+        bench_travel(player_ptr, fff);
+        break;
+    case 'd':
+        bench_detection(player_ptr, fff);
+        break;
+    case 'm':
+        bench_monster_sight(player_ptr, fff);
+        break;
+    case 'e':
+        bench_ego_artifact(player_ptr, fff);
+        break;
+    case 'r':
+        bench_lore_journal(player_ptr, fff);
+        break;
+    case 'w':
+        bench_monster_sweep(player_ptr, fff);
+        break;
+    case 'i':
+        bench_monster_timers(player_ptr, fff);
+        break;
+    case 'p':
+        bench_projection(player_ptr, fff);
+        break;
+    case 'c':
+        bench_combat_messages(player_ptr, fff);
+        break;
+    default:
+        msg_print(_("そのような計測はありません。", "That is not a valid benchmark."));
+        break;
+    }
+
+    fputc('\n', fff);
+    angband_fclose(fff);
+    msg_format(_("計測結果をファイル %s に書き出しました。", "Benchmark results saved to file %s."), buf);
+}
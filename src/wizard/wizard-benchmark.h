@@ -0,0 +1,5 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+void wiz_benchmark(player_type *player_ptr);
@@ -0,0 +1,266 @@
+﻿/*!
+ * @brief フロア生成の一括計測 / Batch profiling of the floor generation
+ * @date 2026/10/19
+ * @details
+ * 各ダンジョンのフロアを固定シードで大量に生成し、生成段階ごとの時間・やり直し理由・
+ * フロアの中身の分布をbenchmark.txtへ書き出す。
+ * 生成は現在のフロアに上書きし、乱数・クォーク・アーティファクト等の大域状態も書き換えるため、
+ * ゲーム中のコマンドからは呼ばず、コマンドライン引数 -l で起動し、計測後はセーブせずに終了する。
+ */
+
+#include "wizard/wizard-generation-benchmark.h"
+#include "dungeon/dungeon.h"
+#include "floor/floor-generator.h"
+#include "floor/floor-util.h"
+#include "floor/generation-profiler.h"
+#include "grid/grid.h"
+#include "io/files-util.h"
+#include "monster-floor/monster-remover.h"
+#include "system/floor-type-definition.h"
+#include "term/screen-processor.h"
+#include "util/angband-files.h"
+#include "util/usec-timer.h"
+#include "world/world.h"
+
+#define GEN_BENCH_SEED 0x5eed1234UL /*!< 乱数シードの基準値 */
+#define GEN_BENCH_BUCKETS 10 /*!< 分布表示の区間数 */
+
+/*!
+ * @brief 1フロアごとに集計する値 / Values sampled from each generated floor
+ */
+typedef enum gen_sample_type {
+    GEN_SAMPLE_USEC = 0,
+    GEN_SAMPLE_RETRY = 1,
+    GEN_SAMPLE_AREA = 2,
+    GEN_SAMPLE_ROOM = 3,
+    GEN_SAMPLE_VAULT = 4,
+    GEN_SAMPLE_MONSTER = 5,
+    GEN_SAMPLE_OBJECT = 6,
+    MAX_GEN_SAMPLE = 7,
+} gen_sample_type;
+
+static const concptr gen_sample_names[MAX_GEN_SAMPLE] = {
+    "usec/floor",
+    "retries",
+    "area (grids)",
+    "rooms",
+    "vault grids",
+    "monsters",
+    "objects",
+};
+
+/*!
+ * @brief やり直し回数の累計を返す / Total number of restarts recorded so far
+ * @return やり直し回数
+ */
+static int count_generation_retries(void)
+{
+    int sum = 0;
+    for (int i = 0; i < generation_profile.retry_num; i++)
+        sum += generation_profile.retry_count[i];
+
+    return sum;
+}
+
+/*!
+ * @brief 生成済のフロアから集計値を取り出す / Sample the contents of the generated floor
+ * @param floor_ptr 作業用フロアへの参照ポインタ
+ * @param sample 集計値の格納先
+ * @return なし
+ */
+static void sample_floor(floor_type *floor_ptr, int *sample)
+{
+    int vault = 0;
+    for (POSITION y = 0; y < floor_ptr->height; y++)
+        for (POSITION x = 0; x < floor_ptr->width; x++)
+            if (floor_ptr->grid_array[y][x].info & CAVE_ICKY)
+                vault++;
+
+    sample[GEN_SAMPLE_AREA] = floor_ptr->height * floor_ptr->width;
+    sample[GEN_SAMPLE_ROOM] = generation_profile.room_num;
+    sample[GEN_SAMPLE_VAULT] = vault;
+    sample[GEN_SAMPLE_MONSTER] = floor_ptr->m_cnt;
+    sample[GEN_SAMPLE_OBJECT] = floor_ptr->o_cnt;
+}
+
+/*!
+ * @brief 集計値の最小・平均・最大と分布を書き出す / Write min/avg/max and a histogram of a sample
+ * @param fff 出力先
+ * @param name 集計値の名前
+ * @param values フロアごとの値
+ * @param n フロア数
+ * @return なし
+ */
+static void report_distribution(FILE *fff, concptr name, int *values, int n)
+{
+    int min = values[0];
+    int max = values[0];
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        min = MIN(min, values[i]);
+        max = MAX(max, values[i]);
+        sum += values[i];
+    }
+
+    fprintf(fff, "  %-14s min %8d  avg %10.1f  max %8d\n", name, min, sum / n, max);
+    if (min == max)
+        return;
+
+    int width = (max - min) / GEN_BENCH_BUCKETS + 1;
+    int bucket[GEN_BENCH_BUCKETS] = { 0 };
+    for (int i = 0; i < n; i++)
+        bucket[(values[i] - min) / width]++;
+
+    for (int i = 0; i < GEN_BENCH_BUCKETS; i++) {
+        int lo = min + i * width;
+        if (lo > max)
+            break;
+
+        fprintf(fff, "    %8d-%-8d %6d ", lo, lo + width - 1, bucket[i]);
+        for (int j = 0; j < (bucket[i] * 50 + n - 1) / n; j++)
+            fputc('#', fff);
+
+        fputc('\n', fff);
+    }
+}
+
+/*!
+ * @brief 1ダンジョン・1階層のフロアを続けて生成する / Generate a run of floors of a dungeon level
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param fff 出力先
+ * @param d_idx ダンジョンID
+ * @param depth 階層
+ * @param num 生成するフロア数
+ * @param values 集計値ごとの格納先配列
+ * @param count 格納済のフロア数 (生成した分だけ増やす)
+ * @return なし
+ */
+static void generate_floor_run(player_type *player_ptr, FILE *fff, DUNGEON_IDX d_idx, DEPTH depth, int num, int **values, int *count)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    player_ptr->dungeon_idx = d_idx;
+    floor_ptr->dun_level = depth;
+    floor_ptr->inside_quest = 0;
+    floor_ptr->inside_arena = FALSE;
+
+    prt(format("%s %dF ...", d_name + d_info[d_idx].name, depth), 0, 0);
+    term_fresh();
+    double start = get_usec_time();
+    int run_retry = count_generation_retries();
+    for (int i = 0; i < num; i++) {
+        Rand_state_set(GEN_BENCH_SEED + d_idx * 10007UL + depth * 101UL + i);
+        player_ptr->enter_dungeon = FALSE;
+        generation_profile.room_num = 0;
+
+        int sample[MAX_GEN_SAMPLE];
+        double floor_start = get_usec_time();
+        int floor_retry = count_generation_retries();
+        generate_floor(player_ptr);
+        sample[GEN_SAMPLE_USEC] = (int)(get_usec_time() - floor_start);
+        sample[GEN_SAMPLE_RETRY] = count_generation_retries() - floor_retry;
+        sample_floor(floor_ptr, sample);
+        for (int s = 0; s < MAX_GEN_SAMPLE; s++)
+            values[s][*count] = sample[s];
+
+        (*count)++;
+        wipe_o_list(floor_ptr);
+        wipe_monsters_list(player_ptr);
+    }
+
+    fprintf(fff, "  %-24s %3dF: %10.1f usec/floor, %d retries\n", d_name + d_info[d_idx].name, depth, (get_usec_time() - start) / num,
+        count_generation_retries() - run_retry);
+}
+
+/*!
+ * @brief 各ダンジョンのフロア生成を計測する / Profile the floor generation over the dungeons
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param fff 出力先
+ * @param num 1階層あたりの生成数
+ * @param depth 階層 (0なら各ダンジョンの最浅・中間・最深の3階層)
+ * @return なし
+ */
+static void bench_floor_generation(player_type *player_ptr, FILE *fff, int num, DEPTH depth)
+{
+    int max_floors = 0;
+    for (DUNGEON_IDX d_idx = 1; d_idx < current_world_ptr->max_d_idx; d_idx++) {
+        dungeon_type *d_ptr = &d_info[d_idx];
+        if (d_ptr->maxdepth <= 0)
+            continue;
+
+        if (depth == 0)
+            max_floors += num * 3;
+        else if ((depth >= d_ptr->mindepth) && (depth <= d_ptr->maxdepth))
+            max_floors += num;
+    }
+
+    if (max_floors == 0) {
+        fprintf(fff, "[Floor generation: no dungeon has depth %d]\n", depth);
+        return;
+    }
+
+    int *values[MAX_GEN_SAMPLE];
+    for (int s = 0; s < MAX_GEN_SAMPLE; s++)
+        C_MAKE(values[s], max_floors, int);
+
+    fprintf(fff, "[Floor generation: %d floors per level, seed base 0x%08lx]\n", num, (unsigned long)GEN_BENCH_SEED);
+    start_generation_profile();
+    int count = 0;
+    for (DUNGEON_IDX d_idx = 1; d_idx < current_world_ptr->max_d_idx; d_idx++) {
+        dungeon_type *d_ptr = &d_info[d_idx];
+        if (d_ptr->maxdepth <= 0)
+            continue;
+
+        if (depth != 0) {
+            if ((depth >= d_ptr->mindepth) && (depth <= d_ptr->maxdepth))
+                generate_floor_run(player_ptr, fff, d_idx, depth, num, values, &count);
+
+            continue;
+        }
+
+        generate_floor_run(player_ptr, fff, d_idx, d_ptr->mindepth, num, values, &count);
+        generate_floor_run(player_ptr, fff, d_idx, (d_ptr->mindepth + d_ptr->maxdepth) / 2, num, values, &count);
+        generate_floor_run(player_ptr, fff, d_idx, d_ptr->maxdepth, num, values, &count);
+    }
+
+    stop_generation_profile();
+    fprintf(fff, "Stages (%d floors, %.1f usec/floor, longest %.1f usec):\n", generation_profile.floors,
+        generation_profile.total_usec / MAX(generation_profile.floors, 1), generation_profile.max_floor_usec);
+    for (int i = 0; i < MAX_GEN_STAGE; i++) {
+        double usec = generation_profile.stage_usec[i];
+        fprintf(fff, "  %-14s %10.1f usec/floor %6.2f%%\n", gen_stage_names[i], usec / MAX(generation_profile.floors, 1),
+            generation_profile.total_usec > 0 ? usec * 100 / generation_profile.total_usec : 0.0);
+    }
+
+    fprintf(fff, "Restarts (%d):\n", count_generation_retries());
+    for (int i = 0; i < generation_profile.retry_num; i++)
+        fprintf(fff, "  %6d %s\n", generation_profile.retry_count[i], generation_profile.retry_why[i]);
+
+    fprintf(fff, "Distribution per floor:\n");
+    for (int s = 0; s < MAX_GEN_SAMPLE; s++)
+        report_distribution(fff, gen_sample_names[s], values[s], count);
+
+    for (int s = 0; s < MAX_GEN_SAMPLE; s++)
+        C_KILL(values[s], max_floors, int);
+}
+
+/*!
+ * @brief フロア生成を計測してbenchmark.txtへ追記する / Profile the floor generation into benchmark.txt
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param num 1階層あたりの生成数
+ * @param depth 階層 (0なら各ダンジョンの最浅・中間・最深の3階層)
+ * @return なし
+ * @details
+ * 現在のフロアやゲームの状態を壊すので、呼び出し元は計測後にセーブせず終了すること。
+ */
+void profile_floor_generation(player_type *player_ptr, int num, DEPTH depth)
+{
+    char buf[1024];
+    path_build(buf, sizeof(buf), ANGBAND_DIR_USER, "benchmark.txt");
+    FILE *fff = angband_fopen(buf, "a");
+    if (fff == NULL)
+        quit_fmt(_("ファイル %s を開けませんでした。", "Failed to open file %s."), buf);
+
+    bench_floor_generation(player_ptr, fff, num, depth);
+    fputc('\n', fff);
+    angband_fclose(fff);
+}
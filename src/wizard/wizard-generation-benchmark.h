@@ -0,0 +1,5 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+void profile_floor_generation(player_type *player_ptr, int num, DEPTH depth);
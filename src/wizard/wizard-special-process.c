@@ -19,6 +19,7 @@
 #include "core/asking-player.h"
 #include "core/player-update-types.h"
 #include "core/stuff-handler.h"
+#include "core/turn-profiler.h"
 #include "core/window-redrawer.h"
 #include "dungeon/dungeon.h"
 #include "dungeon/quest.h"
@@ -517,6 +518,38 @@ void wiz_dump_options(void)
     msg_format(_("オプションbit使用状況をファイル %s に書き出しました。", "Option bits usage dump saved to file %s."), buf);
 }
 
+#ifdef TURN_PROFILER
+/*!
+ * @brief ターン処理の計測結果をダンプ出力して計測をやり直す / Dump the turn profile and reset it
+ * @return なし
+ */
+void wiz_dump_turn_profile(void)
+{
+    char buf[1024];
+    path_build(buf, sizeof(buf), ANGBAND_DIR_USER, "turn-profile.txt");
+    FILE *fff = angband_fopen(buf, "a");
+    if (fff == NULL) {
+        msg_format(_("ファイル %s を開けませんでした。", "Failed to open file %s."), buf);
+        msg_print(NULL);
+        return;
+    }
+
+    char line[160];
+    format_turn_profile_summary(line, sizeof(line));
+    fprintf(fff, "[Turn profile: %s]\n", line);
+    fprintf(fff, "%s\n", turn_profile_header);
+    for (int i = 0; i < MAX_TPS; i++) {
+        format_turn_profile_line((turn_profile_section)i, line, sizeof(line));
+        fprintf(fff, "%s\n", line);
+    }
+
+    fputc('\n', fff);
+    angband_fclose(fff);
+    reset_turn_profile();
+    msg_format(_("ターン処理の計測結果をファイル %s に書き出しました。", "Turn profile saved to file %s."), buf);
+}
+#endif
+
 /*!
  * @brief プレイ日数を変更する / Set gametime.
  * @return 実際に変更を行ったらTRUEを返す
@@ -12,6 +12,9 @@ void wiz_jump_to_dungeon(player_type *creature_ptr);
 void wiz_learn_items_all(player_type *caster_ptr);
 void wiz_reset_class(player_type *creature_ptr);
 void wiz_dump_options(void);
+#ifdef TURN_PROFILER
+void wiz_dump_turn_profile(void);
+#endif
 void set_gametime(void);
 void wiz_zap_surrounding_monsters(player_type *caster_ptr);
 void wiz_zap_floor_monsters(player_type *caster_ptr);
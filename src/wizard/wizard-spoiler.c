@@ -132,7 +132,7 @@ static void spoil_mon_evol(player_type *player_ptr, concptr fname)
         }
     }
 
-    ang_sort(player_ptr, evol_tree, NULL, max_r_idx, ang_sort_comp_evol_tree, ang_sort_swap_evol_tree);
+    sort_evol_tree(evol_tree, max_r_idx);
     for (i = 0; i < max_r_idx; i++) {
         r_idx = evol_tree[i][0];
         if (!r_idx)
@@ -14,15 +14,26 @@
  * @param floo_ptr 現在フロアへの参照ポインタ
  * @return 開いているオブジェクト要素のID
  * @details
+ * 削除で空いた枠があればそれを使い、なければ使用範囲を広げる。
+ * 空き枠の一覧に載っていながら使われている枠は一覧から外して読み飛ばす。
  * This routine should almost never fail, but in case it does,
  * we must be sure to handle "failure" of this routine.
  */
 OBJECT_IDX o_pop(floor_type *floor_ptr)
 {
+    for (OBJECT_IDX i = pop_free_slot(&floor_ptr->o_slots); i; i = pop_free_slot(&floor_ptr->o_slots)) {
+        if (floor_ptr->o_list[i].k_idx)
+            continue;
+
+        floor_ptr->o_cnt++;
+        return i;
+    }
+
     if (floor_ptr->o_max < current_world_ptr->max_o_idx) {
         OBJECT_IDX i = floor_ptr->o_max;
         floor_ptr->o_max++;
         floor_ptr->o_cnt++;
+        occupy_slot(&floor_ptr->o_slots, i);
         return i;
     }
 
@@ -32,6 +43,7 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
         if (o_ptr->k_idx)
             continue;
         floor_ptr->o_cnt++;
+        occupy_slot(&floor_ptr->o_slots, i);
 
         return i;
     }
@@ -167,12 +167,8 @@ void process_world(player_type *player_ptr)
     if (!(current_world_ptr->game_turn % (TURNS_PER_TICK * 3)))
         regenerate_captured_monsters(player_ptr);
 
-    if (!player_ptr->leaving) {
-        for (int i = 0; i < MAX_MTIMED; i++) {
-            if (floor_ptr->mproc_max[i] > 0)
-                process_monsters_mtimed(player_ptr, i);
-        }
-    }
+    if (!player_ptr->leaving)
+        process_monsters_mtimed(player_ptr);
 
     if (!hour && !min) {
         if (min != prev_min) {
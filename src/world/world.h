@@ -13,6 +13,7 @@ typedef struct world_type {
 	GAME_TURN dungeon_turn;			/*!< NASTY生成の計算に関わる内部ターン値 / Game turn in dungeon */
 	GAME_TURN dungeon_turn_limit;	/*!< dungeon_turnの最大値 / Limit of game_turn in dungeon */
 	GAME_TURN arena_start_turn;		/*!< 闘技場賭博の開始ターン値 */
+	u32b mtimed_tick;				/*!< モンスターの時限効果を処理した回数 (保存しない) / Monster timer ticks processed so far, not saved */
 	u32b start_time;
 	u16b noscore;		  /* Cheating flags */
 	u16b total_winner;	  /* Total winner */